@@ -0,0 +1,146 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+
+#include "mystl/algorithm.h"
+#include "mystl/vector.h"
+
+// --- mystl::sort / stable_sort 与 std 版本在不同输入分布下的对比 ---
+
+enum Distribution : int {
+  kRandom,
+  kSorted,
+  kReversed,
+  kOrganPipe,  // 先升后降
+  kFewUnique,  // 只有 16 种取值
+};
+
+static const char* distribution_name(int d) {
+  switch (d) {
+    case kRandom:
+      return "random";
+    case kSorted:
+      return "sorted";
+    case kReversed:
+      return "reversed";
+    case kOrganPipe:
+      return "organ_pipe";
+    default:
+      return "few_unique";
+  }
+}
+
+static mystl::vector<std::uint64_t> make_input(int d, std::size_t n) {
+  std::mt19937_64 rng(12345);
+  mystl::vector<std::uint64_t> v(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    switch (d) {
+      case kRandom:
+        v[i] = rng();
+        break;
+      case kSorted:
+        v[i] = i;
+        break;
+      case kReversed:
+        v[i] = n - i;
+        break;
+      case kOrganPipe:
+        v[i] = i < n / 2 ? i : n - i;
+        break;
+      default:
+        v[i] = rng() % 16;
+        break;
+    }
+  }
+  return v;
+}
+
+// 每轮先恢复输入再计时排序，Sort 是一个接受 (first, last) 的可调用对象
+template <class Sort>
+static void run_sort(benchmark::State& state, Sort sort) {
+  const int d = int(state.range(0));
+  const std::size_t n = std::size_t(state.range(1));
+  const mystl::vector<std::uint64_t> src = make_input(d, n);
+  mystl::vector<std::uint64_t> v = src;
+  for (auto _ : state) {
+    state.PauseTiming();
+    std::copy(src.begin(), src.end(), v.begin());
+    state.ResumeTiming();
+    sort(v.begin(), v.end());
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.SetLabel(distribution_name(d));
+  state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(n));
+}
+
+static void BM_MystlSort(benchmark::State& state) {
+  run_sort(state, [](auto first, auto last) { mystl::sort(first, last); });
+}
+
+static void BM_StdSort(benchmark::State& state) {
+  run_sort(state, [](auto first, auto last) { std::sort(first, last); });
+}
+
+static void BM_MystlStableSort(benchmark::State& state) {
+  run_sort(state,
+           [](auto first, auto last) { mystl::stable_sort(first, last); });
+}
+
+static void BM_StdStableSort(benchmark::State& state) {
+  run_sort(state, [](auto first, auto last) { std::stable_sort(first, last); });
+}
+
+static void sort_args(benchmark::internal::Benchmark* b) {
+  for (int d = kRandom; d <= kFewUnique; ++d) {
+    b->Args({d, 1 << 10});
+    b->Args({d, 1 << 20});
+  }
+  b->Unit(benchmark::kMicrosecond);
+}
+
+BENCHMARK(BM_MystlSort)->Apply(sort_args);
+BENCHMARK(BM_StdSort)->Apply(sort_args);
+BENCHMARK(BM_MystlStableSort)->Apply(sort_args);
+BENCHMARK(BM_StdStableSort)->Apply(sort_args);
+
+// --- 部分排序与选择：前 1% 与中位数 ---
+
+static void BM_MystlPartialSort(benchmark::State& state) {
+  run_sort(state, [](auto first, auto last) {
+    mystl::partial_sort(first, first + (last - first) / 100, last);
+  });
+}
+
+static void BM_StdPartialSort(benchmark::State& state) {
+  run_sort(state, [](auto first, auto last) {
+    std::partial_sort(first, first + (last - first) / 100, last);
+  });
+}
+
+static void BM_MystlNthElement(benchmark::State& state) {
+  run_sort(state, [](auto first, auto last) {
+    mystl::nth_element(first, first + (last - first) / 2, last);
+  });
+}
+
+static void BM_StdNthElement(benchmark::State& state) {
+  run_sort(state, [](auto first, auto last) {
+    std::nth_element(first, first + (last - first) / 2, last);
+  });
+}
+
+static void select_args(benchmark::internal::Benchmark* b) {
+  b->Args({kRandom, 1 << 20});
+  b->Args({kOrganPipe, 1 << 20});
+  b->Unit(benchmark::kMicrosecond);
+}
+
+BENCHMARK(BM_MystlPartialSort)->Apply(select_args);
+BENCHMARK(BM_StdPartialSort)->Apply(select_args);
+BENCHMARK(BM_MystlNthElement)->Apply(select_args);
+BENCHMARK(BM_StdNthElement)->Apply(select_args);
+
+// 运行 benchmark
+BENCHMARK_MAIN();
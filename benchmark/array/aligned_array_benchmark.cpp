@@ -0,0 +1,89 @@
+#include <benchmark/benchmark.h>
+#include <cstddef>
+
+#include "mystl/aligned_array.h"
+#include "mystl/array.h"
+
+// --- 点积与 axpy：mystl::aligned_array 的整块向量 vs mystl::array 的逐元素循环 ---
+
+template <std::size_t N>
+static float dot(const mystl::array<float, N>& x,
+                 const mystl::array<float, N>& y) {
+  float s = 0;
+  for (std::size_t i = 0; i < N; ++i) {
+    s += x[i] * y[i];
+  }
+  return s;
+}
+
+template <std::size_t N>
+static void axpy(float a, const mystl::array<float, N>& x,
+                 mystl::array<float, N>& y) {
+  for (std::size_t i = 0; i < N; ++i) {
+    y[i] += a * x[i];
+  }
+}
+
+// 填充部分为零，直接按整块向量处理，没有尾部循环
+template <std::size_t N>
+static float dot(const mystl::aligned_array<float, N, 64>& x,
+                 const mystl::aligned_array<float, N, 64>& y) {
+  typename mystl::aligned_array<float, N, 64>::vector_type acc = {};
+  for (std::size_t b = 0; b < x.vector_count(); ++b) {
+    acc += x.load(b) * y.load(b);
+  }
+  float s = 0;
+  for (std::size_t l = 0; l < x.lanes; ++l) {
+    s += acc[l];
+  }
+  return s;
+}
+
+template <std::size_t N>
+static void axpy(float a, const mystl::aligned_array<float, N, 64>& x,
+                 mystl::aligned_array<float, N, 64>& y) {
+  for (std::size_t b = 0; b < x.vector_count(); ++b) {
+    y.store(b, y.load(b) + a * x.load(b));
+  }
+}
+
+template <class A>
+static void BM_Dot(benchmark::State& state) {
+  A x, y;
+  x.fill(1.5f);
+  y.fill(0.5f);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(x);
+    float r = dot(x, y);
+    benchmark::DoNotOptimize(r);
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * x.size());
+}
+
+template <class A>
+static void BM_Axpy(benchmark::State& state) {
+  A x, y;
+  x.fill(1.5f);
+  y.fill(0.5f);
+  for (auto _ : state) {
+    axpy(1e-6f, x, y);
+    benchmark::DoNotOptimize(y.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * x.size());
+}
+
+#define MYSTL_ALIGNED_BENCH(N)                                      \
+  BENCHMARK_TEMPLATE(BM_Dot, mystl::array<float, N>);               \
+  BENCHMARK_TEMPLATE(BM_Dot, mystl::aligned_array<float, N, 64>);   \
+  BENCHMARK_TEMPLATE(BM_Axpy, mystl::array<float, N>);              \
+  BENCHMARK_TEMPLATE(BM_Axpy, mystl::aligned_array<float, N, 64>)
+
+MYSTL_ALIGNED_BENCH(16);
+MYSTL_ALIGNED_BENCH(37);
+MYSTL_ALIGNED_BENCH(256);
+MYSTL_ALIGNED_BENCH(1000);
+MYSTL_ALIGNED_BENCH(4096);
+
+// 运行 benchmark
+BENCHMARK_MAIN();
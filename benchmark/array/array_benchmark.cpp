@@ -1,5 +1,6 @@
 #include <benchmark/benchmark.h>
 #include <array>
+#include <cstdint>
 
 #include "mystl/array.h"
 
@@ -51,5 +52,83 @@ static void BM_StdArray_Iteration(benchmark::State& state) {
 }
 BENCHMARK(BM_StdArray_Iteration);
 
+// --- fill / swap / 比较：mystl::array 的算术类型快速路径 vs std::array ---
+
+constexpr size_t M = 4096;
+
+template <class A>
+static void BM_Fill(benchmark::State& state) {
+  A arr;
+  for (auto _ : state) {
+    arr.fill(typename A::value_type(3));
+    benchmark::DoNotOptimize(arr.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * sizeof(arr));
+}
+BENCHMARK_TEMPLATE(BM_Fill, mystl::array<std::uint8_t, M>);
+BENCHMARK_TEMPLATE(BM_Fill, std::array<std::uint8_t, M>);
+BENCHMARK_TEMPLATE(BM_Fill, mystl::array<std::int16_t, M>);
+BENCHMARK_TEMPLATE(BM_Fill, std::array<std::int16_t, M>);
+BENCHMARK_TEMPLATE(BM_Fill, mystl::array<double, M>);
+BENCHMARK_TEMPLATE(BM_Fill, std::array<double, M>);
+
+template <class A>
+static void BM_Swap(benchmark::State& state) {
+  A a, b;
+  a.fill(typename A::value_type(1));
+  b.fill(typename A::value_type(2));
+  for (auto _ : state) {
+    a.swap(b);
+    benchmark::DoNotOptimize(a.data());
+    benchmark::DoNotOptimize(b.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * 2 * sizeof(a));
+}
+BENCHMARK_TEMPLATE(BM_Swap, mystl::array<int, M>);
+BENCHMARK_TEMPLATE(BM_Swap, std::array<int, M>);
+
+// 两个数组只有最后一个元素不同，比较需要扫描全部数据
+template <class A>
+static void BM_Equal(benchmark::State& state) {
+  A a, b;
+  a.fill(typename A::value_type(1));
+  b = a;
+  b[b.size() - 1] = typename A::value_type(2);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    bool r = a == b;
+    benchmark::DoNotOptimize(r);
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * sizeof(a));
+}
+BENCHMARK_TEMPLATE(BM_Equal, mystl::array<std::uint8_t, M>);
+BENCHMARK_TEMPLATE(BM_Equal, std::array<std::uint8_t, M>);
+BENCHMARK_TEMPLATE(BM_Equal, mystl::array<int, M>);
+BENCHMARK_TEMPLATE(BM_Equal, std::array<int, M>);
+BENCHMARK_TEMPLATE(BM_Equal, mystl::array<float, M>);
+BENCHMARK_TEMPLATE(BM_Equal, std::array<float, M>);
+
+template <class A>
+static void BM_Less(benchmark::State& state) {
+  A a, b;
+  a.fill(typename A::value_type(1));
+  b = a;
+  b[b.size() - 1] = typename A::value_type(2);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    bool r = a < b;
+    benchmark::DoNotOptimize(r);
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * sizeof(a));
+}
+BENCHMARK_TEMPLATE(BM_Less, mystl::array<std::uint8_t, M>);
+BENCHMARK_TEMPLATE(BM_Less, std::array<std::uint8_t, M>);
+BENCHMARK_TEMPLATE(BM_Less, mystl::array<int, M>);
+BENCHMARK_TEMPLATE(BM_Less, std::array<int, M>);
+BENCHMARK_TEMPLATE(BM_Less, mystl::array<std::int64_t, M>);
+BENCHMARK_TEMPLATE(BM_Less, std::array<std::int64_t, M>);
+
 // 运行 benchmark
 BENCHMARK_MAIN();
\ No newline at end of file
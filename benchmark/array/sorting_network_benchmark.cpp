@@ -0,0 +1,96 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <random>
+#include <string>
+#include <utility>
+
+#include "mystl/array.h"
+
+// --- 小数组排序：编译期排序网络 vs std::sort，N = 2..32 ---
+
+constexpr std::size_t kInputs = 256;
+
+// 预先生成一批随机输入，每次迭代拷贝一份再排序
+template <std::size_t N>
+static std::vector<mystl::array<float, N>> make_inputs() {
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+  std::vector<mystl::array<float, N>> in(kInputs);
+  for (auto& a : in) {
+    for (auto& x : a) {
+      x = dist(rng);
+    }
+  }
+  return in;
+}
+
+template <std::size_t N>
+static void BM_NetworkSort(benchmark::State& state) {
+  const auto in = make_inputs<N>();
+  std::size_t k = 0;
+  for (auto _ : state) {
+    mystl::array<float, N> a = in[k++ % kInputs];
+    mystl::sort(a);
+    benchmark::DoNotOptimize(a);
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * N);
+}
+
+template <std::size_t N>
+static void BM_StdSort(benchmark::State& state) {
+  const auto in = make_inputs<N>();
+  std::size_t k = 0;
+  for (auto _ : state) {
+    mystl::array<float, N> a = in[k++ % kInputs];
+    std::sort(a.begin(), a.end());
+    benchmark::DoNotOptimize(a);
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * N);
+}
+
+template <std::size_t N>
+static void BM_NetworkMedian(benchmark::State& state) {
+  const auto in = make_inputs<N>();
+  std::size_t k = 0;
+  for (auto _ : state) {
+    float m = mystl::median(in[k++ % kInputs]);
+    benchmark::DoNotOptimize(m);
+  }
+}
+
+template <std::size_t N>
+static void BM_StdNthElementMedian(benchmark::State& state) {
+  const auto in = make_inputs<N>();
+  std::size_t k = 0;
+  for (auto _ : state) {
+    mystl::array<float, N> a = in[k++ % kInputs];
+    std::nth_element(a.begin(), a.begin() + (N - 1) / 2, a.end());
+    benchmark::DoNotOptimize(a[(N - 1) / 2]);
+  }
+}
+
+template <std::size_t... Is>
+static bool register_all(std::index_sequence<Is...>) {
+  // N 从 2 开始
+  (benchmark::RegisterBenchmark(
+       ("BM_NetworkSort/" + std::to_string(Is + 2)).c_str(),
+       BM_NetworkSort<Is + 2>),
+   ...);
+  (benchmark::RegisterBenchmark(
+       ("BM_StdSort/" + std::to_string(Is + 2)).c_str(), BM_StdSort<Is + 2>),
+   ...);
+  (benchmark::RegisterBenchmark(
+       ("BM_NetworkMedian/" + std::to_string(Is + 2)).c_str(),
+       BM_NetworkMedian<Is + 2>),
+   ...);
+  (benchmark::RegisterBenchmark(
+       ("BM_StdNthElementMedian/" + std::to_string(Is + 2)).c_str(),
+       BM_StdNthElementMedian<Is + 2>),
+   ...);
+  return true;
+}
+
+static const bool registered = register_all(std::make_index_sequence<31>());
+
+// 运行 benchmark
+BENCHMARK_MAIN();
@@ -0,0 +1,420 @@
+#!/usr/bin/env python3
+"""元编程头文件的编译期开销基准，输出 JSON 报告并可与基线对比。
+
+对每个用例和每个元数 N 生成一个翻译单元：
+  tuple          8 个元数为 N 的 mystl::tuple 类型，各自构造、拷贝、赋值、get
+  tuple_cat      tuple_cat 合并 N 个单元素 tuple
+  tuple_compare  8 个元数为 N 的 mystl::tuple 类型，各自实例化 == 和 <
+  get_index      元数为 N 的 tuple 上对每个 I 调用 get<I>
+  get_type       N 个互不相同的类型组成的 tuple 上对每个类型调用 get<T>
+  all_true       在 N 个类型上求 is_all_true_general_v<is_constructible, ...>
+  pair_ctor      N 个不同的 mystl::pair 类型，走遍 SFINAE 约束的各个构造函数
+
+每个翻译单元单独编译，记录：
+  wall_s          墙钟时间，多次编译取最短
+  peak_rss_kb     编译器进程的峰值常驻内存（wait4 的 ru_maxrss）
+  instantiations  -ftime-trace 里 InstantiateClass / InstantiateFunction
+                  事件的个数；编译器不支持 -ftime-trace（如 GCC）时为 null
+
+与基线（--baseline）比较峰值内存和实例化个数：内存依赖编译器，只在编译器
+版本相同时比较；实例化个数是确定的，只要基线和本次运行都有就会比较。
+墙钟时间随机器和负载变化，不与基线里记录的秒数比较。
+
+注意：仓库里的 baseline.json 是用 GCC 录制的，instantiations 全为 null。
+用其他编译器（包括其他版本的 GCC）运行 --baseline 时没有任何可比较的指标，
+检查不会拦截任何回归，脚本会打印警告。要让检查在 clang 上生效，
+用 clang 运行 --update-baseline 重新录制基线。
+
+--against REV 时用 git archive 取出 REV 的 include/ 目录，同样的翻译单元
+在同一次运行里再编译一遍（与当前版本交替编译，负载对两边的影响相同），
+当前版本的墙钟时间和峰值内存超过 REV 的容差时视为回归。
+
+用法：
+    python3 benchmark/compile/compile_bench.py --output report.json
+    python3 benchmark/compile/compile_bench.py --baseline benchmark/compile/baseline.json --against origin/main
+    python3 benchmark/compile/compile_bench.py --update-baseline benchmark/compile/baseline.json
+    python3 benchmark/compile/compile_bench.py --cases tuple_compare,get_index --against HEAD~1
+"""
+
+import argparse
+import json
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+ROOT = os.path.abspath(os.path.join(os.path.dirname(__file__), "..", ".."))
+
+PRELUDE = """#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include "mystl/tuple.h"
+#include "mystl/type_traits.h"
+#include "mystl/utility.h"
+template <int I> struct tag { int v = I; };
+"""
+
+
+def gen_tuple(n):
+    # 8 个宽度为 N 的 tuple 类型，首元素各不相同
+    lines = []
+    for k in range(8):
+        types = ", ".join(["tag<%d>" % (1000 + k)] +
+                          ["tag<%d>" % i for i in range(1, n)])
+        lines.append("using T%d = mystl::tuple<%s>;" % (k, types))
+        lines.append("int f%d() { T%d a; T%d b(a); b = a; "
+                     "return mystl::get<0>(b).v + mystl::get<%d>(b).v; }"
+                     % (k, k, k, n - 1))
+    return "\n".join(lines)
+
+
+def gen_tuple_cat(n):
+    args = ", ".join("mystl::tuple<tag<%d>>()" % i for i in range(n))
+    return "auto f() { return mystl::tuple_cat(%s); }" % args
+
+
+def gen_tuple_compare(n):
+    # 首元素类型不同，其余为 int
+    heads = ["char", "short", "int", "long", "unsigned", "float", "double",
+             "long long"]
+    lines = []
+    for k, head in enumerate(heads):
+        types = ", ".join([head] + ["int"] * (n - 1))
+        lines.append("using T%d = mystl::tuple<%s>;" % (k, types))
+        lines.append("bool f%d(const T%d& a, const T%d& b) "
+                     "{ return a == b || a < b; }" % (k, k, k))
+    return "\n".join(lines)
+
+
+def gen_get_index(n):
+    return ("using T = mystl::tuple<%s>;\n"
+            "template <std::size_t... Is>\n"
+            "int sum(T& t, std::index_sequence<Is...>) "
+            "{ return (0 + ... + mystl::get<Is>(t)); }\n"
+            "int f(T& t) { return sum(t, std::make_index_sequence<%d>{}); }"
+            % (", ".join(["int"] * n), n))
+
+
+def gen_get_type(n):
+    types = ["tag<%d>" % i for i in range(n)]
+    return ("using T = mystl::tuple<%s>;\n"
+            "int f(T& t) { return 0%s; }"
+            % (", ".join(types),
+               "".join(" + mystl::get<%s>(t).v" % ty for ty in types)))
+
+
+def gen_all_true(n):
+    # box<i> 只能由 tag<i> 构造，Trait 对每一对都要真正求值
+    froms = ", ".join("tag<%d>" % i for i in range(n))
+    lines = ["template <int I> struct box { box(const tag<I>&) {} };"]
+    tos = ", ".join("box<%d>" % i for i in range(n))
+    lines.append(
+        "static_assert(mystl::is_all_true_general_v<std::is_constructible,\n"
+        "    mystl::TypeLists<%s>,\n    mystl::TypeLists<%s>>);" % (tos, froms))
+    lines.append(
+        "static_assert(mystl::is_all_true_general_v<std::is_convertible,\n"
+        "    mystl::TypeLists<%s>,\n    mystl::TypeLists<%s>>);" % (froms, tos))
+    return "\n".join(lines)
+
+
+def gen_pair_ctor(n):
+    lines = ["template <int I> struct conv {\n"
+             "  conv() = default;\n"
+             "  conv(int x) : v(x) {}\n"
+             "  explicit conv(long x) : v(int(x)) {}\n"
+             "  int v = I;\n"
+             "};"]
+    for i in range(n):
+        lines.append(
+            "int f%d() {\n"
+            "  using P = mystl::pair<conv<%d>, long>;\n"
+            "  P a;\n"
+            "  P b(conv<%d>(1), 2L);\n"
+            "  P c(1, 2);\n"
+            "  P d(mystl::pair<int, int>(1, 2));\n"
+            "  const mystl::pair<int, short> e(1, 2);\n"
+            "  P f(e);\n"
+            "  P g(std::piecewise_construct, mystl::make_tuple(1),\n"
+            "      mystl::make_tuple(2L));\n"
+            "  a = b;\n"
+            "  return a.first.v + c.first.v + d.first.v + f.first.v + g.first.v;\n"
+            "}" % (i, i, i))
+    return "\n".join(lines)
+
+
+CASES = {
+    "tuple": gen_tuple,
+    "tuple_cat": gen_tuple_cat,
+    "tuple_compare": gen_tuple_compare,
+    "get_index": gen_get_index,
+    "get_type": gen_get_type,
+    "all_true": gen_all_true,
+    "pair_ctor": gen_pair_ctor,
+}
+
+
+def compiler_version(cxx):
+    out = subprocess.run([cxx, "--version"], stdout=subprocess.PIPE,
+                         stderr=subprocess.STDOUT, universal_newlines=True)
+    if not out.stdout:
+        return cxx
+    # 去掉开头的程序名，使 c++ / g++ / 绝对路径调用同一个编译器时结果一致
+    first = out.stdout.splitlines()[0].strip()
+    name, _, rest = first.partition(" ")
+    return rest if name == os.path.basename(cxx) and rest else first
+
+
+def supports_time_trace(cxx, workdir):
+    src = os.path.join(workdir, "probe.cpp")
+    with open(src, "w") as f:
+        f.write("int main() { return 0; }\n")
+    result = subprocess.run([cxx, "-ftime-trace", "-c", src, "-o",
+                             os.path.join(workdir, "probe.o")],
+                            stdout=subprocess.PIPE, stderr=subprocess.PIPE)
+    return result.returncode == 0
+
+
+def count_instantiations(trace_path):
+    with open(trace_path) as f:
+        events = json.load(f).get("traceEvents", [])
+    counts = {"class": 0, "function": 0}
+    for event in events:
+        if event.get("name") == "InstantiateClass":
+            counts["class"] += 1
+        elif event.get("name") == "InstantiateFunction":
+            counts["function"] += 1
+    return counts
+
+
+def export_include(rev, dest):
+    archive = subprocess.run(["git", "-C", ROOT, "archive", rev, "include"],
+                             stdout=subprocess.PIPE, check=True).stdout
+    subprocess.run(["tar", "-x", "-C", dest], input=archive, check=True)
+    return os.path.join(dest, "include")
+
+
+def measure(cxx, includes, source, flags, repeat, time_trace, workdir):
+    """用每个 include 目录编译同一个翻译单元，返回与 includes 对应的结果列表。
+
+    各版本交替编译 repeat 轮，时间和内存都取最小值；编译失败的版本结果为 None。
+    只有第一个版本记录 -ftime-trace。
+    """
+    src = os.path.join(workdir, "tu.cpp")
+    with open(src, "w") as f:
+        f.write(source)
+    results = [None] * len(includes)
+    failed = [False] * len(includes)
+    for _ in range(repeat):
+        for k, include in enumerate(includes):
+            if failed[k]:
+                continue
+            m = measure_once(cxx, include, src, flags, time_trace and k == 0,
+                             workdir)
+            if m is None:
+                failed[k] = True
+                results[k] = None
+            elif results[k] is None:
+                results[k] = m
+            else:
+                results[k]["wall_s"] = min(results[k]["wall_s"], m["wall_s"])
+                results[k]["peak_rss_kb"] = min(results[k]["peak_rss_kb"],
+                                                m["peak_rss_kb"])
+    return results
+
+
+def measure_once(cxx, include, src, flags, time_trace, workdir):
+    obj = os.path.join(workdir, "tu.o")
+    cmd = [cxx, "-std=c++17", "-I", include, "-c", src, "-o", obj] + flags
+    if time_trace:
+        cmd.append("-ftime-trace")
+
+    start = time.perf_counter()
+    proc = subprocess.Popen(cmd, stdout=subprocess.DEVNULL,
+                            stderr=subprocess.PIPE, universal_newlines=True)
+    err = proc.stderr.read()
+    proc.stderr.close()
+    # 用 wait4 回收子进程，拿到只属于这一次编译的 rusage
+    _, status, usage = os.wait4(proc.pid, 0)
+    elapsed = time.perf_counter() - start
+    proc.returncode = 0  # 已经回收，避免 Popen 析构时再 wait
+    if not os.WIFEXITED(status) or os.WEXITSTATUS(status) != 0:
+        sys.stderr.write(err[:4000])
+        return None
+
+    instantiations = None
+    if time_trace:
+        trace = os.path.splitext(obj)[0] + ".json"
+        if os.path.exists(trace):
+            instantiations = count_instantiations(trace)
+    return {"wall_s": round(elapsed, 4), "peak_rss_kb": usage.ru_maxrss,
+            "instantiations": instantiations}
+
+
+def compare(report, baseline, rss_tol, inst_tol):
+    """与基线比较峰值内存和实例化个数，返回回归描述的列表，空列表表示没有回归。"""
+    same_compiler = report["compiler"] == baseline.get("compiler")
+    if not same_compiler:
+        print("note: baseline compiler is %r, current is %r; "
+              "only instantiation counts are compared"
+              % (baseline.get("compiler"), report["compiler"]))
+    old = {(r["case"], r["arity"]): r for r in baseline.get("results", [])}
+    if not same_compiler and not (report.get("time_trace") and
+                                  baseline.get("time_trace")):
+        print("warning: baseline %s instantiation counts and current "
+              "compiler %s; nothing is compared against the baseline"
+              % ("has" if baseline.get("time_trace") else "has no",
+                 "can record them" if report.get("time_trace")
+                 else "cannot record them"))
+    regressions = []
+    for r in report["results"]:
+        base = old.get((r["case"], r["arity"]))
+        if base is None:
+            continue
+        name = "%s/%d" % (r["case"], r["arity"])
+        if r.get("failed"):
+            if not base.get("failed"):
+                regressions.append("%s: no longer compiles" % name)
+            continue
+        if base.get("failed"):
+            continue
+        if same_compiler and r["peak_rss_kb"] > base["peak_rss_kb"] * (1 + rss_tol):
+            regressions.append("%s: rss %d KB > baseline %d KB"
+                               % (name, r["peak_rss_kb"], base["peak_rss_kb"]))
+        now_inst, old_inst = r["instantiations"], base.get("instantiations")
+        if now_inst and old_inst:
+            now_total = now_inst["class"] + now_inst["function"]
+            old_total = old_inst["class"] + old_inst["function"]
+            if now_total > old_total * (1 + inst_tol):
+                regressions.append("%s: %d instantiations > baseline %d"
+                                   % (name, now_total, old_total))
+    return regressions
+
+
+def compare_against(report, time_tol, rss_tol):
+    """与同一次运行里编译的 --against 版本比较墙钟时间和峰值内存。"""
+    regressions = []
+    rev = report["against"]
+    for r in report["results"]:
+        # 旧版本编译不了的用例没有对照
+        if r.get("failed") or r.get("against_wall_s") is None:
+            continue
+        name = "%s/%d" % (r["case"], r["arity"])
+        # 很小的用例受进程启动抖动影响，另加 50ms 的绝对余量
+        if r["wall_s"] > r["against_wall_s"] * (1 + time_tol) + 0.05:
+            regressions.append("%s: wall %.3fs > %s %.3fs"
+                               % (name, r["wall_s"], rev, r["against_wall_s"]))
+        if r["peak_rss_kb"] > r["against_peak_rss_kb"] * (1 + rss_tol):
+            regressions.append("%s: rss %d KB > %s %d KB"
+                               % (name, r["peak_rss_kb"], rev,
+                                  r["against_peak_rss_kb"]))
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--cxx", default=os.environ.get("CXX", "g++"))
+    parser.add_argument("--arities", default="8,32,128")
+    parser.add_argument("--cases", default=",".join(CASES))
+    parser.add_argument("--repeat", type=int, default=3,
+                        help="每个配置编译几次，取最小值")
+    parser.add_argument("--flags", default="-O0")
+    parser.add_argument("--output", help="JSON 报告写到这个文件")
+    parser.add_argument("--baseline",
+                        help="与这个 JSON 基线比较内存和实例化个数，回归时返回 1")
+    parser.add_argument("--update-baseline", metavar="PATH",
+                        help="把本次结果写成新的基线")
+    parser.add_argument("--time-tolerance", type=float, default=0.25)
+    parser.add_argument("--rss-tolerance", type=float, default=0.15)
+    parser.add_argument("--inst-tolerance", type=float, default=0.0)
+    parser.add_argument("--against", metavar="REV",
+                        help="同时编译 git 版本 REV 的头文件作为对照，"
+                             "时间或内存超过它时返回 1")
+    args = parser.parse_args()
+
+    arities = [int(a) for a in args.arities.split(",")]
+    cases = args.cases.split(",")
+    for case in cases:
+        if case not in CASES:
+            parser.error("unknown case %r" % case)
+    flags = args.flags.split()
+
+    workdir = tempfile.mkdtemp()
+    try:
+        time_trace = supports_time_trace(args.cxx, workdir)
+        current = os.path.join(ROOT, "include")
+        against = (export_include(args.against, workdir) if args.against
+                   else None)
+        includes = [current] + ([against] if against else [])
+        report = {"compiler": compiler_version(args.cxx), "flags": flags,
+                  "time_trace": time_trace, "results": []}
+        header = "%-13s %6s %9s %12s %14s" % ("case", "arity", "wall (s)",
+                                              "rss (KB)", "instantiations")
+        if against:
+            report["against"] = args.against
+            header += " %12s %8s" % (args.against[:12], "speedup")
+        print(header)
+        for case in cases:
+            for n in arities:
+                source = PRELUDE + CASES[case](n) + "\n"
+                results = measure(args.cxx, includes, source, flags,
+                                  args.repeat, time_trace, workdir)
+                m = results[0]
+                old = results[1] if against else None
+                entry = {"case": case, "arity": n}
+                if m is None:
+                    entry["failed"] = True
+                    line = "%-13s %6d %9s %12s %14s" % (case, n, "failed",
+                                                        "-", "-")
+                else:
+                    entry.update(m)
+                    inst = m["instantiations"]
+                    line = ("%-13s %6d %9.3f %12d %14s"
+                            % (case, n, m["wall_s"], m["peak_rss_kb"],
+                               "-" if inst is None
+                               else inst["class"] + inst["function"]))
+                if against:
+                    # 旧版本可能编译不了很宽的 tuple（模板深度限制）
+                    entry["against_wall_s"] = old and old["wall_s"]
+                    entry["against_peak_rss_kb"] = old and old["peak_rss_kb"]
+                    line += " %12s %8s" % (
+                        "failed" if old is None else "%.3f" % old["wall_s"],
+                        "%.2f" % (old["wall_s"] / m["wall_s"])
+                        if old and m else "-")
+                print(line)
+                report["results"].append(entry)
+    finally:
+        shutil.rmtree(workdir)
+
+    text = json.dumps(report, indent=2) + "\n"
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write(text)
+    if args.update_baseline:
+        with open(args.update_baseline, "w") as f:
+            f.write(text)
+
+    regressions = []
+    checked = []
+    if args.baseline:
+        with open(args.baseline) as f:
+            baseline = json.load(f)
+        regressions += compare(report, baseline, args.rss_tolerance,
+                               args.inst_tolerance)
+        checked.append(args.baseline)
+    if args.against:
+        regressions += compare_against(report, args.time_tolerance,
+                                       args.rss_tolerance)
+        checked.append(args.against)
+    for r in regressions:
+        print("REGRESSION " + r)
+    if regressions:
+        return 1
+    if checked:
+        print("no compile-time regressions against " + ", ".join(checked))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,118 @@
+#include <benchmark/benchmark.h>
+
+#include "mystl/mdspan.h"
+#include "mystl/vector.h"
+
+// --- 不同布局下的矩阵转置与五点模板计算 ---
+
+constexpr std::size_t N = 1024;
+constexpr std::size_t kTile = 8;
+using Ext = mystl::extents<N, N>;
+
+template <class Layout>
+using View = mystl::mdspan<float, Ext, Layout>;
+
+template <class Layout>
+static mystl::vector<float> make_storage() {
+  mystl::vector<float> v(View<Layout>::required_span_size());
+  for (std::size_t i = 0; i < v.size(); ++i) {
+    v[i] = float(i % 97);
+  }
+  return v;
+}
+
+// 逐行遍历：对行主序友好
+template <class Layout>
+static void transpose_rows(View<Layout> dst, View<Layout> src) {
+  for (std::size_t i = 0; i < N; ++i) {
+    for (std::size_t j = 0; j < N; ++j) {
+      dst(j, i) = src(i, j);
+    }
+  }
+}
+
+// 按 kTile x kTile 的块遍历：每次只触及少量缓存行
+template <class Layout>
+static void transpose_tiles(View<Layout> dst, View<Layout> src) {
+  for (std::size_t ti = 0; ti < N; ti += kTile) {
+    for (std::size_t tj = 0; tj < N; tj += kTile) {
+      for (std::size_t i = ti; i < ti + kTile; ++i) {
+        for (std::size_t j = tj; j < tj + kTile; ++j) {
+          dst(j, i) = src(i, j);
+        }
+      }
+    }
+  }
+}
+
+template <class Layout>
+static inline void stencil_point(View<Layout> dst, View<Layout> src,
+                                 std::size_t i, std::size_t j) {
+  dst(i, j) = 0.2f * (src(i, j) + src(i - 1, j) + src(i + 1, j) +
+                      src(i, j - 1) + src(i, j + 1));
+}
+
+template <class Layout>
+static void stencil_rows(View<Layout> dst, View<Layout> src) {
+  for (std::size_t i = 1; i < N - 1; ++i) {
+    for (std::size_t j = 1; j < N - 1; ++j) {
+      stencil_point<Layout>(dst, src, i, j);
+    }
+  }
+}
+
+template <class Layout>
+static void stencil_tiles(View<Layout> dst, View<Layout> src) {
+  for (std::size_t ti = 0; ti < N; ti += kTile) {
+    for (std::size_t tj = 0; tj < N; tj += kTile) {
+      const std::size_t i0 = ti == 0 ? 1 : ti;
+      const std::size_t i1 = ti + kTile == N ? N - 1 : ti + kTile;
+      const std::size_t j0 = tj == 0 ? 1 : tj;
+      const std::size_t j1 = tj + kTile == N ? N - 1 : tj + kTile;
+      for (std::size_t i = i0; i < i1; ++i) {
+        for (std::size_t j = j0; j < j1; ++j) {
+          stencil_point<Layout>(dst, src, i, j);
+        }
+      }
+    }
+  }
+}
+
+template <class Layout, void (*Kernel)(View<Layout>, View<Layout>)>
+static void BM_Kernel(benchmark::State& state) {
+  mystl::vector<float> a = make_storage<Layout>();
+  mystl::vector<float> b = make_storage<Layout>();
+  View<Layout> src(a);
+  View<Layout> dst(b);
+  for (auto _ : state) {
+    Kernel(dst, src);
+    benchmark::DoNotOptimize(b.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * N * N);
+}
+
+using Right = mystl::layout_right;
+using Left = mystl::layout_left;
+using Tiled = mystl::layout_tiled<kTile, kTile>;
+
+BENCHMARK_TEMPLATE(BM_Kernel, Right, transpose_rows<Right>)
+    ->Name("Transpose/layout_right/rows");
+BENCHMARK_TEMPLATE(BM_Kernel, Right, transpose_tiles<Right>)
+    ->Name("Transpose/layout_right/tiles");
+BENCHMARK_TEMPLATE(BM_Kernel, Left, transpose_rows<Left>)
+    ->Name("Transpose/layout_left/rows");
+BENCHMARK_TEMPLATE(BM_Kernel, Tiled, transpose_tiles<Tiled>)
+    ->Name("Transpose/layout_tiled8x8/tiles");
+
+BENCHMARK_TEMPLATE(BM_Kernel, Right, stencil_rows<Right>)
+    ->Name("Stencil5/layout_right/rows");
+BENCHMARK_TEMPLATE(BM_Kernel, Left, stencil_rows<Left>)
+    ->Name("Stencil5/layout_left/rows");
+BENCHMARK_TEMPLATE(BM_Kernel, Tiled, stencil_rows<Tiled>)
+    ->Name("Stencil5/layout_tiled8x8/rows");
+BENCHMARK_TEMPLATE(BM_Kernel, Tiled, stencil_tiles<Tiled>)
+    ->Name("Stencil5/layout_tiled8x8/tiles");
+
+// 运行 benchmark
+BENCHMARK_MAIN();
@@ -0,0 +1,99 @@
+#include <benchmark/benchmark.h>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "mystl/mpmc_queue.h"
+
+// --- P 个生产者、C 个消费者之间传递 kItems 个元素 ---
+// 每次迭代创建线程并全部 join，统计的是端到端吞吐量
+
+constexpr std::size_t kCapacity = 1024;
+constexpr std::uint64_t kItems = 1 << 16;  // 能被 1/2/4/8 整除
+
+// 对照：互斥锁 + 条件变量保护的 std::deque，即原来的任务分发队列
+class locked_queue {
+  std::mutex m;
+  std::condition_variable not_empty;
+  std::condition_variable not_full;
+  std::deque<std::uint64_t> dq;
+  std::size_t cap;
+
+ public:
+  explicit locked_queue(std::size_t capacity) : cap(capacity) {}
+
+  void push(std::uint64_t v) {
+    std::unique_lock<std::mutex> lock(m);
+    not_full.wait(lock, [&] { return dq.size() < cap; });
+    dq.push_back(v);
+    lock.unlock();
+    not_empty.notify_one();
+  }
+
+  std::uint64_t pop() {
+    std::unique_lock<std::mutex> lock(m);
+    not_empty.wait(lock, [&] { return !dq.empty(); });
+    std::uint64_t v = dq.front();
+    dq.pop_front();
+    lock.unlock();
+    not_full.notify_one();
+    return v;
+  }
+};
+
+template <class Queue>
+static void RunTransfer(benchmark::State& state) {
+  const int producers = int(state.range(0));
+  const int consumers = int(state.range(1));
+  Queue q(kCapacity);
+
+  for (auto _ : state) {
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+      threads.emplace_back([&, p] {
+        const std::uint64_t n = kItems / producers;
+        for (std::uint64_t i = 0; i < n; ++i) {
+          q.push(p * n + i);
+        }
+      });
+    }
+    for (int c = 0; c < consumers; ++c) {
+      threads.emplace_back([&] {
+        std::uint64_t sum = 0;
+        for (std::uint64_t i = 0; i < kItems / consumers; ++i) {
+          sum += q.pop();
+        }
+        benchmark::DoNotOptimize(sum);
+      });
+    }
+    for (auto& t : threads) {
+      t.join();
+    }
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * kItems);
+}
+
+static void ProducerConsumerArgs(benchmark::internal::Benchmark* b) {
+  for (int p : {1, 2, 4, 8}) {
+    for (int c : {1, 2, 4, 8}) {
+      b->Args({p, c});
+    }
+  }
+  b->ArgNames({"producers", "consumers"});
+}
+
+static void BM_MpmcQueue(benchmark::State& state) {
+  RunTransfer<mystl::mpmc_queue<std::uint64_t>>(state);
+}
+BENCHMARK(BM_MpmcQueue)->Apply(ProducerConsumerArgs)->UseRealTime();
+
+static void BM_MutexCondvarQueue(benchmark::State& state) {
+  RunTransfer<locked_queue>(state);
+}
+BENCHMARK(BM_MutexCondvarQueue)->Apply(ProducerConsumerArgs)->UseRealTime();
+
+// 运行 benchmark
+BENCHMARK_MAIN();
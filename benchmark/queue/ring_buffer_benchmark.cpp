@@ -0,0 +1,80 @@
+#include <benchmark/benchmark.h>
+#include <cstring>
+#include <deque>
+
+#include "mystl/ring_buffer.h"
+
+// --- 接收窗口：mystl::ring_buffer vs std::deque ---
+
+constexpr std::size_t kWindow = 1 << 16;
+
+// 模拟接收窗口：每次收到 chunk 字节，消费掉同样多的字节
+static void BM_RingBuffer_Window(benchmark::State& state) {
+  const std::size_t chunk = state.range(0);
+  std::vector<char> packet(chunk, 'x');
+  mystl::ring_buffer<char, kWindow> rb;
+  rb.push_n(kWindow / 2);
+  for (auto _ : state) {
+    auto w = rb.push_n(chunk);
+    std::memcpy(w.first.data(), packet.data(), w.first.size());
+    std::memcpy(w.second.data(), packet.data() + w.first.size(),
+                w.second.size());
+    auto r = rb.pop_n(chunk);
+    benchmark::DoNotOptimize(r.first.data());
+    benchmark::DoNotOptimize(r.second.data());
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * chunk);
+}
+BENCHMARK(BM_RingBuffer_Window)->Range(64, 16 << 10);
+
+static void BM_Deque_Window(benchmark::State& state) {
+  const std::size_t chunk = state.range(0);
+  std::vector<char> packet(chunk, 'x');
+  std::vector<char> out(chunk);
+  std::deque<char> dq(kWindow / 2);
+  for (auto _ : state) {
+    dq.insert(dq.end(), packet.begin(), packet.end());
+    std::copy(dq.begin(), dq.begin() + chunk, out.begin());
+    dq.erase(dq.begin(), dq.begin() + chunk);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * chunk);
+}
+BENCHMARK(BM_Deque_Window)->Range(64, 16 << 10);
+
+// 逐个元素的 push/pop
+static void BM_RingBuffer_PushPop(benchmark::State& state) {
+  mystl::ring_buffer<int, 1024> rb;
+  int x = 0;
+  for (auto _ : state) {
+    for (int i = 0; i < 512; ++i) {
+      rb.push(i);
+    }
+    for (int i = 0; i < 512; ++i) {
+      rb.pop(x);
+    }
+    benchmark::DoNotOptimize(x);
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * 512);
+}
+BENCHMARK(BM_RingBuffer_PushPop);
+
+static void BM_Deque_PushPop(benchmark::State& state) {
+  std::deque<int> dq;
+  int x = 0;
+  for (auto _ : state) {
+    for (int i = 0; i < 512; ++i) {
+      dq.push_back(i);
+    }
+    for (int i = 0; i < 512; ++i) {
+      x = dq.front();
+      dq.pop_front();
+    }
+    benchmark::DoNotOptimize(x);
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * 512);
+}
+BENCHMARK(BM_Deque_PushPop);
+
+// 运行 benchmark
+BENCHMARK_MAIN();
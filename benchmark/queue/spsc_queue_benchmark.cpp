@@ -0,0 +1,163 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "mystl/spsc_queue.h"
+
+// --- 两个线程之间的 SPSC 传递：吞吐量与往返延迟 ---
+// 自旋等待时让出 CPU，单核机器上也能推进
+
+constexpr std::size_t kCapacity = 1024;
+constexpr std::uint64_t kOpsPerIteration = 1 << 16;
+
+using Queue = mystl::spsc_queue<std::uint64_t, kCapacity>;
+
+// 每次迭代传递 kOpsPerIteration 个元素，批量大小为 range(0)
+static void BM_Spsc_Throughput(benchmark::State& state) {
+  const std::size_t batch = state.range(0);
+  auto q = std::make_unique<Queue>();
+  std::atomic<bool> done{false};
+
+  std::thread consumer([&] {
+    std::vector<std::uint64_t> buf(batch);
+    std::uint64_t sum = 0;
+    for (;;) {
+      std::size_t n = q->try_pop_n(buf.data(), batch);
+      if (n == 0) {
+        if (done.load(std::memory_order_acquire) && q->empty_approx()) {
+          break;
+        }
+        std::this_thread::yield();
+      }
+      for (std::size_t i = 0; i < n; ++i) {
+        sum += buf[i];
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  });
+
+  std::vector<std::uint64_t> src(batch);
+  for (auto _ : state) {
+    for (std::uint64_t sent = 0; sent < kOpsPerIteration;) {
+      std::size_t n = std::min<std::uint64_t>(batch, kOpsPerIteration - sent);
+      for (std::size_t i = 0; i < n; ++i) {
+        src[i] = sent + i;
+      }
+      std::size_t pushed = batch == 1 ? std::size_t(q->try_push(src[0]))
+                                      : q->try_push_n(src.data(), n);
+      if (pushed == 0) {
+        std::this_thread::yield();
+      }
+      sent += pushed;
+    }
+  }
+  done.store(true, std::memory_order_release);
+  consumer.join();
+  state.SetItemsProcessed(int64_t(state.iterations()) * kOpsPerIteration);
+}
+BENCHMARK(BM_Spsc_Throughput)->Arg(1)->Arg(8)->Arg(64)->UseRealTime();
+
+// 对照：互斥锁保护的 std::deque
+static void BM_MutexDeque_Throughput(benchmark::State& state) {
+  std::mutex m;
+  std::deque<std::uint64_t> dq;
+  std::atomic<bool> done{false};
+
+  std::thread consumer([&] {
+    std::uint64_t sum = 0;
+    for (;;) {
+      bool got = false;
+      {
+        std::lock_guard<std::mutex> lock(m);
+        if (!dq.empty()) {
+          sum += dq.front();
+          dq.pop_front();
+          got = true;
+        }
+      }
+      if (!got) {
+        if (done.load(std::memory_order_acquire)) {
+          std::lock_guard<std::mutex> lock(m);
+          if (dq.empty()) {
+            break;
+          }
+        }
+        std::this_thread::yield();
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  });
+
+  for (auto _ : state) {
+    for (std::uint64_t i = 0; i < kOpsPerIteration; ++i) {
+      std::lock_guard<std::mutex> lock(m);
+      dq.push_back(i);
+    }
+  }
+  done.store(true, std::memory_order_release);
+  consumer.join();
+  state.SetItemsProcessed(int64_t(state.iterations()) * kOpsPerIteration);
+}
+BENCHMARK(BM_MutexDeque_Throughput)->UseRealTime();
+
+/*
+ * 往返延迟：主线程把时间戳放进 ping 队列，回声线程原样放回 pong 队列，
+ * 主线程记录每一次往返的耗时，报告 p50 / p99 / p99.9
+ */
+static void BM_Spsc_RoundTrip(benchmark::State& state) {
+  auto ping = std::make_unique<Queue>();
+  auto pong = std::make_unique<Queue>();
+  std::atomic<bool> done{false};
+
+  std::thread echo([&] {
+    std::uint64_t v = 0;
+    while (!done.load(std::memory_order_acquire)) {
+      if (ping->try_pop(v)) {
+        while (!pong->try_push(v)) {
+          std::this_thread::yield();
+        }
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  });
+
+  std::vector<double> samples;
+  samples.reserve(1 << 20);
+  for (auto _ : state) {
+    const auto start = std::chrono::steady_clock::now();
+    while (!ping->try_push(1)) {
+      std::this_thread::yield();
+    }
+    std::uint64_t v = 0;
+    while (!pong->try_pop(v)) {
+      std::this_thread::yield();
+    }
+    const auto stop = std::chrono::steady_clock::now();
+    samples.push_back(
+        std::chrono::duration<double, std::nano>(stop - start).count());
+  }
+  done.store(true, std::memory_order_release);
+  echo.join();
+
+  if (!samples.empty()) {
+    std::sort(samples.begin(), samples.end());
+    auto pct = [&](double p) {
+      return samples[std::size_t(p * double(samples.size() - 1))];
+    };
+    state.counters["p50_ns"] = pct(0.50);
+    state.counters["p99_ns"] = pct(0.99);
+    state.counters["p999_ns"] = pct(0.999);
+  }
+}
+BENCHMARK(BM_Spsc_RoundTrip)->UseRealTime();
+
+// 运行 benchmark
+BENCHMARK_MAIN();
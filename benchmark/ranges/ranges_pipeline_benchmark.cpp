@@ -0,0 +1,106 @@
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <random>
+
+#include "mystl/ranges.h"
+#include "mystl/vector.h"
+
+// --- 四阶段 ETL 管道：惰性视图（一个循环、无分配）vs 每一步物化一个临时 vector ---
+// 阶段：过滤无效记录 -> 解析/换算 -> 跳过表头 -> 取前一半
+
+struct Record {
+  std::int32_t raw;
+  std::uint32_t flags;
+};
+
+static mystl::vector<Record> make_records(std::size_t n) {
+  std::mt19937 rng(7);
+  mystl::vector<Record> v(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    v[i].raw = std::int32_t(rng() % 100000);
+    v[i].flags = rng() % 4;  // 约四分之三的记录有效
+  }
+  return v;
+}
+
+static bool is_valid(const Record& r) { return r.flags != 0; }
+
+static double parse(const Record& r) { return r.raw * 0.01 + 1.5; }
+
+static void BM_EagerTemporaries(benchmark::State& state) {
+  const std::size_t n = std::size_t(state.range(0));
+  const auto input = make_records(n);
+  for (auto _ : state) {
+    mystl::vector<Record> valid;
+    for (const Record& r : input) {
+      if (is_valid(r)) {
+        valid.push_back(r);
+      }
+    }
+    mystl::vector<double> parsed;
+    parsed.reserve(valid.size());
+    for (const Record& r : valid) {
+      parsed.push_back(parse(r));
+    }
+    mystl::vector<double> body;
+    for (std::size_t i = 1; i < parsed.size(); ++i) {
+      body.push_back(parsed[i]);
+    }
+    mystl::vector<double> head;
+    for (std::size_t i = 0; i < body.size() && i < n / 2; ++i) {
+      head.push_back(body[i]);
+    }
+    double sum = 0;
+    for (double x : head) {
+      sum += x;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(n));
+}
+BENCHMARK(BM_EagerTemporaries)->Range(1 << 12, 1 << 22);
+
+static void BM_LazyPipeline(benchmark::State& state) {
+  namespace views = mystl::views;
+  const std::size_t n = std::size_t(state.range(0));
+  const auto input = make_records(n);
+  for (auto _ : state) {
+    double sum = 0;
+    for (double x : input | views::filter(is_valid) |
+                        views::transform(parse) | views::drop(1) |
+                        views::take(std::ptrdiff_t(n / 2))) {
+      sum += x;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(n));
+}
+BENCHMARK(BM_LazyPipeline)->Range(1 << 12, 1 << 22);
+
+// 手写的单循环，作为惰性管道的下限参考
+static void BM_HandFused(benchmark::State& state) {
+  const std::size_t n = std::size_t(state.range(0));
+  const auto input = make_records(n);
+  for (auto _ : state) {
+    double sum = 0;
+    std::size_t seen = 0;
+    for (const Record& r : input) {
+      if (!is_valid(r)) {
+        continue;
+      }
+      if (seen++ == 0) {
+        continue;
+      }
+      if (seen > n / 2 + 1) {
+        break;
+      }
+      sum += parse(r);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(n));
+}
+BENCHMARK(BM_HandFused)->Range(1 << 12, 1 << 22);
+
+// 运行 benchmark
+BENCHMARK_MAIN();
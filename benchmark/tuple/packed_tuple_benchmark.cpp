@@ -0,0 +1,69 @@
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "mystl/packed_tuple.h"
+#include "mystl/tuple.h"
+
+// --- 大量小记录：按对齐重排的 packed_tuple vs 按声明顺序存储的 tuple ---
+
+// 典型的行记录：标志位、价格、类型、数量
+using Tuple = mystl::tuple<char, double, char, std::int32_t>;
+using Packed = mystl::packed_tuple<char, double, char, std::int32_t>;
+
+static_assert(sizeof(Tuple) == 24, "");
+static_assert(sizeof(Packed) == 16, "");
+
+template <class Record>
+static std::vector<Record> make_records(std::size_t n) {
+  std::vector<Record> data;
+  data.reserve(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    data.emplace_back(char('a' + i % 26), double(i) * 0.5, char(i & 1),
+                      std::int32_t(i));
+  }
+  return data;
+}
+
+// 填充 n 条记录，内存占用直接决定写入的字节数
+template <class Record>
+static void BM_Fill(benchmark::State& state) {
+  const std::size_t n = std::size_t(state.range(0));
+  for (auto _ : state) {
+    auto data = make_records<Record>(n);
+    benchmark::DoNotOptimize(data.data());
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(n));
+  state.counters["bytes_per_elem"] = double(sizeof(Record));
+  state.counters["footprint_mb"] = double(n * sizeof(Record)) / (1 << 20);
+}
+
+// 扫描：按条件累加，每条记录访问全部字段
+template <class Record>
+static void BM_Scan(benchmark::State& state) {
+  const std::size_t n = std::size_t(state.range(0));
+  const auto data = make_records<Record>(n);
+  for (auto _ : state) {
+    double sum = 0;
+    for (const Record& r : data) {
+      if (mystl::get<2>(r) != 0 && mystl::get<0>(r) != 'z') {
+        sum += mystl::get<1>(r) * mystl::get<3>(r);
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(n));
+  state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(n) *
+                          int64_t(sizeof(Record)));
+  state.counters["bytes_per_elem"] = double(sizeof(Record));
+}
+
+// 10K 条在缓存内，10M 条远超缓存，差距来自内存带宽
+BENCHMARK_TEMPLATE(BM_Fill, Tuple)->Arg(10000)->Arg(10000000)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_Fill, Packed)->Arg(10000)->Arg(10000000)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_Scan, Tuple)->Arg(10000)->Arg(10000000)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_Scan, Packed)->Arg(10000)->Arg(10000000)->Unit(benchmark::kMicrosecond);
+
+// 运行 benchmark
+BENCHMARK_MAIN();
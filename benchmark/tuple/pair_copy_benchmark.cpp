@@ -0,0 +1,71 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "mystl/tuple.h"
+#include "mystl/utility.h"
+
+// --- 平凡可拷贝的 pair/tuple：mystl vs std（libstdc++ 的 std::pair 赋值不是平凡的）---
+
+static_assert(std::is_trivially_copyable<mystl::pair<int, int>>::value, "");
+
+template <class Pair>
+static std::vector<Pair> make_pairs(std::size_t n) {
+  std::vector<Pair> v;
+  v.reserve(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    v.emplace_back(int(i), int(i * 3));
+  }
+  return v;
+}
+
+// std::copy 对平凡可拷贝赋值的类型退化为 memmove，否则逐个调用 operator=
+template <class Pair>
+static void BM_Copy(benchmark::State& state) {
+  const std::size_t n = std::size_t(state.range(0));
+  const auto src = make_pairs<Pair>(n);
+  std::vector<Pair> dst(n);
+  for (auto _ : state) {
+    std::copy(src.begin(), src.end(), dst.begin());
+    benchmark::DoNotOptimize(dst.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(n));
+  state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(n) *
+                          int64_t(sizeof(Pair)));
+  state.counters["trivial"] =
+      std::is_trivially_copy_assignable<Pair>::value ? 1 : 0;
+}
+
+// 按值传递：平凡可拷贝的 8 字节 pair 放在一个寄存器里传递和返回
+template <class Pair>
+__attribute__((noinline)) static Pair swap_halves(Pair p) {
+  return Pair(p.second, p.first);
+}
+
+template <class Pair>
+static void BM_PassByValue(benchmark::State& state) {
+  Pair p(1, 2);
+  for (auto _ : state) {
+    for (int i = 0; i < 1024; ++i) {
+      p = swap_halves(p);
+    }
+    benchmark::DoNotOptimize(p);
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * 1024);
+}
+
+using MyPair = mystl::pair<int, int>;
+using StdPair = std::pair<int, int>;
+using MyTuple = mystl::tuple<int, int>;
+
+BENCHMARK_TEMPLATE(BM_Copy, MyPair)->Arg(10000000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Copy, StdPair)->Arg(10000000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Copy, MyTuple)->Arg(10000000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_PassByValue, MyPair);
+BENCHMARK_TEMPLATE(BM_PassByValue, StdPair);
+
+// 运行 benchmark
+BENCHMARK_MAIN();
@@ -0,0 +1,122 @@
+#include <benchmark/benchmark.h>
+#include <string>
+#include <tuple>
+#include <utility>
+
+#include "mystl/tuple.h"
+#include "utils/test_types.h"
+
+// --- tuple_cat：一次构造结果，每个元素只移动/拷贝一次 ---
+
+using mystl::test::Perfect;
+
+// 每次调用的移动和拷贝次数由 Perfect 的计数器统计，作为 counter 输出
+struct CatCounts {
+  long moves = 0;
+  long copies = 0;
+
+  // 只累计 before 之后发生的构造
+  void add_since(const mystl::test::SMF_Counter& before) {
+    moves += Perfect::counter.move_constructor - before.move_constructor;
+    copies += Perfect::counter.copy_constructor - before.copy_constructor;
+  }
+
+  void report(benchmark::State& state) const {
+    const double n = double(state.iterations());
+    state.counters["moves/op"] = double(moves) / n;
+    state.counters["copies/op"] = double(copies) / n;
+  }
+};
+
+// 4 个右值 tuple，共 8 个元素
+static void BM_MystlTupleCatRvalue(benchmark::State& state) {
+  CatCounts counts;
+  for (auto _ : state) {
+    state.PauseTiming();
+    mystl::tuple<Perfect, Perfect> a(Perfect(1), Perfect(2));
+    mystl::tuple<Perfect, Perfect> b(Perfect(3), Perfect(4));
+    mystl::tuple<Perfect, Perfect> c(Perfect(5), Perfect(6));
+    mystl::tuple<Perfect, Perfect> d(Perfect(7), Perfect(8));
+    const auto before = Perfect::counter;
+    state.ResumeTiming();
+    auto r = mystl::tuple_cat(std::move(a), std::move(b), std::move(c),
+                              std::move(d));
+    benchmark::DoNotOptimize(&r);
+    state.PauseTiming();
+    counts.add_since(before);
+    state.ResumeTiming();
+  }
+  counts.report(state);
+}
+BENCHMARK(BM_MystlTupleCatRvalue);
+
+static void BM_StdTupleCatRvalue(benchmark::State& state) {
+  CatCounts counts;
+  for (auto _ : state) {
+    state.PauseTiming();
+    std::tuple<Perfect, Perfect> a(Perfect(1), Perfect(2));
+    std::tuple<Perfect, Perfect> b(Perfect(3), Perfect(4));
+    std::tuple<Perfect, Perfect> c(Perfect(5), Perfect(6));
+    std::tuple<Perfect, Perfect> d(Perfect(7), Perfect(8));
+    const auto before = Perfect::counter;
+    state.ResumeTiming();
+    auto r = std::tuple_cat(std::move(a), std::move(b), std::move(c),
+                            std::move(d));
+    benchmark::DoNotOptimize(&r);
+    state.PauseTiming();
+    counts.add_since(before);
+    state.ResumeTiming();
+  }
+  counts.report(state);
+}
+BENCHMARK(BM_StdTupleCatRvalue);
+
+// 左值参数：每个元素应当恰好拷贝一次
+static void BM_MystlTupleCatLvalue(benchmark::State& state) {
+  const mystl::tuple<Perfect, Perfect> a(Perfect(1), Perfect(2));
+  const mystl::tuple<Perfect, Perfect> b(Perfect(3), Perfect(4));
+  const mystl::tuple<Perfect, Perfect> c(Perfect(5), Perfect(6));
+  const mystl::tuple<Perfect, Perfect> d(Perfect(7), Perfect(8));
+  CatCounts counts;
+  const auto before = Perfect::counter;
+  for (auto _ : state) {
+    auto r = mystl::tuple_cat(a, b, c, d);
+    benchmark::DoNotOptimize(&r);
+  }
+  counts.add_since(before);
+  counts.report(state);
+}
+BENCHMARK(BM_MystlTupleCatLvalue);
+
+// 实际的搬运代价：长字符串的移动只交换指针，多一次中间移动就多一轮写入
+template <template <class...> class Tuple, class Cat>
+static void run_string_cat(benchmark::State& state, Cat cat) {
+  const std::string s(64, 'x');
+  for (auto _ : state) {
+    state.PauseTiming();
+    Tuple<std::string, std::string> a(s, s);
+    Tuple<std::string, std::string> b(s, s);
+    Tuple<std::string, std::string> c(s, s);
+    Tuple<std::string, std::string> d(s, s);
+    state.ResumeTiming();
+    auto r = cat(std::move(a), std::move(b), std::move(c), std::move(d));
+    benchmark::DoNotOptimize(&r);
+  }
+}
+
+static void BM_MystlTupleCatStrings(benchmark::State& state) {
+  run_string_cat<mystl::tuple>(state, [](auto&&... ts) {
+    return mystl::tuple_cat(std::forward<decltype(ts)>(ts)...);
+  });
+}
+BENCHMARK(BM_MystlTupleCatStrings);
+
+static void BM_StdTupleCatStrings(benchmark::State& state) {
+  run_string_cat<std::tuple>(state, [](auto&&... ts) {
+    return std::tuple_cat(std::forward<decltype(ts)>(ts)...);
+  });
+}
+BENCHMARK(BM_StdTupleCatStrings);
+
+// 运行 benchmark
+BENCHMARK_MAIN();
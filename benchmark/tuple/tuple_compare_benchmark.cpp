@@ -0,0 +1,112 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "mystl/tuple.h"
+
+// --- 排序 tuple 数组：折叠表达式的比较 vs 旧的逐元素递归 vs std::tuple ---
+
+// 旧实现：每个元素实例化一层 is_less_impl<I>
+template <std::size_t I, class... Types>
+static bool recursive_less(const mystl::tuple<Types...>& lhs,
+                           const mystl::tuple<Types...>& rhs) {
+  if constexpr (I == sizeof...(Types)) {
+    return false;
+  } else {
+    if (mystl::get<I>(lhs) < mystl::get<I>(rhs)) {
+      return true;
+    } else if (mystl::get<I>(rhs) < mystl::get<I>(lhs)) {
+      return false;
+    }
+    return recursive_less<I + 1>(lhs, rhs);
+  }
+}
+
+struct RecursiveLess {
+  template <class... Types>
+  bool operator()(const mystl::tuple<Types...>& lhs,
+                  const mystl::tuple<Types...>& rhs) const {
+    return recursive_less<0>(lhs, rhs);
+  }
+};
+
+struct OperatorLess {
+  template <class T>
+  bool operator()(const T& lhs, const T& rhs) const {
+    return lhs < rhs;
+  }
+};
+
+// 前两个字段取值范围很小，大部分比较要看到最后一个字段
+template <class Tuple>
+static std::vector<Tuple> make_ints(std::size_t n) {
+  std::mt19937 rng(42);
+  std::vector<Tuple> v;
+  v.reserve(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    v.emplace_back(int(rng() % 4), int(rng() % 4), int(rng()));
+  }
+  return v;
+}
+
+template <class Tuple>
+static std::vector<Tuple> make_strings(std::size_t n) {
+  std::mt19937 rng(42);
+  std::vector<Tuple> v;
+  v.reserve(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    v.emplace_back("prefix/" + std::to_string(rng() % 1000), int(rng()));
+  }
+  return v;
+}
+
+template <class Tuple, class Less, bool Strings>
+static void BM_Sort(benchmark::State& state) {
+  const std::size_t n = std::size_t(state.range(0));
+  std::vector<Tuple> input;
+  if constexpr (Strings) {
+    input = make_strings<Tuple>(n);
+  } else {
+    input = make_ints<Tuple>(n);
+  }
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto v = input;
+    state.ResumeTiming();
+    std::sort(v.begin(), v.end(), Less());
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(n));
+}
+
+using MyInts = mystl::tuple<int, int, int>;
+using StdInts = std::tuple<int, int, int>;
+using MyStrings = mystl::tuple<std::string, int>;
+using StdStrings = std::tuple<std::string, int>;
+
+BENCHMARK_TEMPLATE(BM_Sort, MyInts, OperatorLess, false)
+    ->Arg(1 << 20)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Sort, MyInts, RecursiveLess, false)
+    ->Arg(1 << 20)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Sort, StdInts, OperatorLess, false)
+    ->Arg(1 << 20)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Sort, MyStrings, OperatorLess, true)
+    ->Arg(1 << 18)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Sort, MyStrings, RecursiveLess, true)
+    ->Arg(1 << 18)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Sort, StdStrings, OperatorLess, true)
+    ->Arg(1 << 18)
+    ->Unit(benchmark::kMillisecond);
+
+// 运行 benchmark
+BENCHMARK_MAIN();
@@ -0,0 +1,99 @@
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "mystl/tuple.h"
+
+// --- 元组数组的缓存占用：空基类优化后的 mystl::tuple vs 空类按普通成员存储 ---
+
+// 无状态的策略对象
+struct Scale {
+  std::uint32_t operator()(std::uint32_t x) const { return x * 3; }
+};
+struct Offset {
+  std::uint32_t operator()(std::uint32_t x) const { return x + 1; }
+};
+
+// 空基类优化之前的布局：每个空类至少 1 个字节，再加上对齐填充
+struct PlainTuple {
+  Scale scale;
+  Offset offset;
+  std::uint32_t value;
+};
+
+using EboTuple = mystl::tuple<Scale, Offset, std::uint32_t>;
+
+static_assert(sizeof(EboTuple) == sizeof(std::uint32_t), "");
+static_assert(sizeof(PlainTuple) == 2 * sizeof(std::uint32_t), "");
+
+static std::uint32_t apply(const PlainTuple& t) {
+  return t.offset(t.scale(t.value));
+}
+
+static std::uint32_t apply(const EboTuple& t) {
+  return mystl::get<1>(t)(mystl::get<0>(t)(mystl::get<2>(t)));
+}
+
+static void make(PlainTuple& t, std::uint32_t v) { t.value = v; }
+
+static void make(EboTuple& t, std::uint32_t v) { mystl::get<2>(t) = v; }
+
+// 顺序扫描整个数组，元素越小，同样的数据量占用的缓存行越少
+template <class Tuple>
+static void BM_Scan(benchmark::State& state) {
+  const std::size_t n = std::size_t(state.range(0));
+  std::vector<Tuple> data(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    make(data[i], std::uint32_t(i));
+  }
+  for (auto _ : state) {
+    std::uint32_t sum = 0;
+    for (const Tuple& t : data) {
+      sum += apply(t);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(n));
+  state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(n) *
+                          int64_t(sizeof(Tuple)));
+  state.counters["bytes_per_elem"] = double(sizeof(Tuple));
+  state.counters["footprint_kb"] = double(n * sizeof(Tuple)) / 1024.0;
+}
+
+// 随机访问：工作集超过某一级缓存时，较小的元素推迟了这个拐点
+template <class Tuple>
+static void BM_RandomAccess(benchmark::State& state) {
+  const std::size_t n = std::size_t(state.range(0));
+  std::vector<Tuple> data(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    make(data[i], std::uint32_t(i));
+  }
+  const std::size_t mask = n - 1;
+  for (auto _ : state) {
+    std::uint32_t sum = 0;
+    std::uint64_t x = 0;
+    for (std::size_t k = 0; k < 1024; ++k) {
+      sum += apply(data[std::size_t(x >> 32) & mask]);
+      // 线性同余取高位作为下标；下一个下标依赖这次读到的值，预取无法掩盖访存延迟
+      x = x * 6364136223846793005ull + 1442695040888963407ull + sum;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * 1024);
+  state.counters["bytes_per_elem"] = double(sizeof(Tuple));
+  state.counters["footprint_kb"] = double(n * sizeof(Tuple)) / 1024.0;
+}
+
+// 元素个数从 4K 到 16M（2 的幂，随机访问用掩码取下标）
+BENCHMARK_TEMPLATE(BM_Scan, PlainTuple)->RangeMultiplier(8)->Range(1 << 12, 1 << 24);
+BENCHMARK_TEMPLATE(BM_Scan, EboTuple)->RangeMultiplier(8)->Range(1 << 12, 1 << 24);
+BENCHMARK_TEMPLATE(BM_RandomAccess, PlainTuple)
+    ->RangeMultiplier(8)
+    ->Range(1 << 12, 1 << 24);
+BENCHMARK_TEMPLATE(BM_RandomAccess, EboTuple)
+    ->RangeMultiplier(8)
+    ->Range(1 << 12, 1 << 24);
+
+// 运行 benchmark
+BENCHMARK_MAIN();
@@ -0,0 +1,116 @@
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "mystl/robin_hood.h"
+
+// --- 高负载因子下 robin_hood_map 与 std::unordered_map 的内存占用和查找延迟 ---
+// 槽位数固定为 2^20，元素个数 = 槽位数 * 负载因子；std::unordered_map 插入同样多的元素
+
+using Key = std::uint64_t;
+
+// 统计分配字节数的分配器，两个容器都用它来计算内存占用
+static std::size_t g_allocated_bytes = 0;
+
+template <class T>
+struct CountingAllocator {
+  using value_type = T;
+
+  CountingAllocator() = default;
+  template <class U>
+  CountingAllocator(const CountingAllocator<U>&) noexcept {}
+
+  T* allocate(std::size_t n) {
+    g_allocated_bytes += n * sizeof(T);
+    return std::allocator<T>().allocate(n);
+  }
+
+  void deallocate(T* p, std::size_t n) noexcept {
+    g_allocated_bytes -= n * sizeof(T);
+    std::allocator<T>().deallocate(p, n);
+  }
+
+  template <class U>
+  bool operator==(const CountingAllocator<U>&) const noexcept {
+    return true;
+  }
+  template <class U>
+  bool operator!=(const CountingAllocator<U>&) const noexcept {
+    return false;
+  }
+};
+
+using RobinHoodMap =
+    mystl::robin_hood_map<Key, Key, std::hash<Key>, std::equal_to<Key>,
+                          CountingAllocator<mystl::pair<Key, Key>>>;
+using StdMap = std::unordered_map<Key, Key, std::hash<Key>, std::equal_to<Key>,
+                                  CountingAllocator<std::pair<const Key, Key>>>;
+
+constexpr std::size_t kSlots = 1 << 20;
+constexpr std::size_t kLookupsPerIteration = 1 << 14;
+
+static Key MixKey(std::uint64_t x) {
+  x += 0x9E3779B97F4A7C15ull;
+  x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+  x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+  return x ^ (x >> 31);
+}
+
+template <class Map>
+static void Prepare(Map&, std::size_t) {}
+
+template <>
+void Prepare(RobinHoodMap& m, std::size_t) {
+  m.max_load_factor(0.95f);
+  m.reserve(std::size_t(kSlots * 0.95));
+}
+
+// range(0) 是负载因子的百分数，range(1) 为 1 时查找已存在的键，为 0 时查找不存在的键
+template <class Map>
+static void BM_Lookup(benchmark::State& state) {
+  const std::size_t n = kSlots * state.range(0) / 100;
+  const bool hit = state.range(1) != 0;
+  std::vector<Key> probes(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    probes[i] = MixKey(2 * i + (hit ? 0 : 1));
+  }
+
+  const std::size_t before = g_allocated_bytes;
+  auto m = std::make_unique<Map>();
+  Prepare(*m, n);
+  for (std::size_t i = 0; i < n; ++i) {
+    (*m)[MixKey(2 * i)] = i;
+  }
+  const std::size_t bytes = g_allocated_bytes - before;
+
+  std::size_t idx = 0;
+  for (auto _ : state) {
+    std::size_t found = 0;
+    for (std::size_t i = 0; i < kLookupsPerIteration; ++i) {
+      found += m->find(probes[idx]) != m->end();
+      idx = idx + 1 == n ? 0 : idx + 1;
+    }
+    benchmark::DoNotOptimize(found);
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * kLookupsPerIteration);
+  state.counters["bytes_per_elem"] = double(bytes) / double(n);
+  state.counters["load"] = double(n) / double(kSlots);
+}
+
+static void LoadFactorArgs(benchmark::internal::Benchmark* b) {
+  for (int load : {50, 75, 90, 95}) {
+    for (int hit : {1, 0}) {
+      b->Args({load, hit});
+    }
+  }
+  b->ArgNames({"load%", "hit"});
+}
+
+BENCHMARK_TEMPLATE(BM_Lookup, RobinHoodMap)->Apply(LoadFactorArgs);
+BENCHMARK_TEMPLATE(BM_Lookup, StdMap)->Apply(LoadFactorArgs);
+
+// 运行 benchmark
+BENCHMARK_MAIN();
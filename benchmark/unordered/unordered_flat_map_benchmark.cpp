@@ -0,0 +1,122 @@
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "mystl/unordered_flat_map.h"
+
+// --- mystl::unordered_flat_map 与 std::unordered_map：插入、命中查找、未命中查找、删除 ---
+// 元素个数从 1K 到 100M；100M 个 uint64 键值对时两个容器各需要约 4~5 GB 内存
+
+using Key = std::uint64_t;
+using FlatMap = mystl::unordered_flat_map<Key, Key>;
+using StdMap = std::unordered_map<Key, Key>;
+
+// splitmix64：生成互不相同、分布均匀的键
+static Key MixKey(std::uint64_t x) {
+  x += 0x9E3779B97F4A7C15ull;
+  x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+  x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+  return x ^ (x >> 31);
+}
+
+// 命中用偶数种子，未命中用奇数种子，两组键不会相交（MixKey 是双射）
+static std::vector<Key> MakeKeys(std::size_t n, std::uint64_t parity) {
+  std::vector<Key> keys(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    keys[i] = MixKey(2 * i + parity);
+  }
+  return keys;
+}
+
+template <class Map>
+static Map BuildMap(const std::vector<Key>& keys) {
+  Map m;
+  for (Key k : keys) {
+    m[k] = k;
+  }
+  return m;
+}
+
+// 每次迭代只做固定次数的查找，大表也能在合理时间内完成
+constexpr std::size_t kLookupsPerIteration = 1 << 14;
+
+template <class Map>
+static void BM_Insert(benchmark::State& state) {
+  const std::vector<Key> keys = MakeKeys(state.range(0), 0);
+  for (auto _ : state) {
+    Map m;
+    for (Key k : keys) {
+      m[k] = k;
+    }
+    benchmark::DoNotOptimize(m.size());
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * keys.size());
+}
+
+template <class Map>
+static void BM_LookupHit(benchmark::State& state) {
+  const std::vector<Key> keys = MakeKeys(state.range(0), 0);
+  const Map m = BuildMap<Map>(keys);
+  std::size_t idx = 0;
+  for (auto _ : state) {
+    Key sum = 0;
+    for (std::size_t i = 0; i < kLookupsPerIteration; ++i) {
+      sum += m.find(keys[idx])->second;
+      idx = idx + 1 == keys.size() ? 0 : idx + 1;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * kLookupsPerIteration);
+}
+
+template <class Map>
+static void BM_LookupMiss(benchmark::State& state) {
+  const Map m = BuildMap<Map>(MakeKeys(state.range(0), 0));
+  const std::vector<Key> misses = MakeKeys(state.range(0), 1);
+  std::size_t idx = 0;
+  for (auto _ : state) {
+    std::size_t found = 0;
+    for (std::size_t i = 0; i < kLookupsPerIteration; ++i) {
+      found += m.find(misses[idx]) != m.end();
+      idx = idx + 1 == misses.size() ? 0 : idx + 1;
+    }
+    benchmark::DoNotOptimize(found);
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * kLookupsPerIteration);
+}
+
+// 删除全部元素；建表不计时
+template <class Map>
+static void BM_Erase(benchmark::State& state) {
+  const std::vector<Key> keys = MakeKeys(state.range(0), 0);
+  for (auto _ : state) {
+    state.PauseTiming();
+    Map m = BuildMap<Map>(keys);
+    state.ResumeTiming();
+    for (Key k : keys) {
+      m.erase(k);
+    }
+    benchmark::DoNotOptimize(m.size());
+    state.PauseTiming();
+    m = Map();  // 释放内存不计时
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * keys.size());
+}
+
+static void SizeRange(benchmark::internal::Benchmark* b) {
+  b->RangeMultiplier(10)->Range(1000, 100000000);
+}
+
+BENCHMARK_TEMPLATE(BM_Insert, FlatMap)->Apply(SizeRange);
+BENCHMARK_TEMPLATE(BM_Insert, StdMap)->Apply(SizeRange);
+BENCHMARK_TEMPLATE(BM_LookupHit, FlatMap)->Apply(SizeRange);
+BENCHMARK_TEMPLATE(BM_LookupHit, StdMap)->Apply(SizeRange);
+BENCHMARK_TEMPLATE(BM_LookupMiss, FlatMap)->Apply(SizeRange);
+BENCHMARK_TEMPLATE(BM_LookupMiss, StdMap)->Apply(SizeRange);
+BENCHMARK_TEMPLATE(BM_Erase, FlatMap)->Apply(SizeRange);
+BENCHMARK_TEMPLATE(BM_Erase, StdMap)->Apply(SizeRange);
+
+// 运行 benchmark
+BENCHMARK_MAIN();
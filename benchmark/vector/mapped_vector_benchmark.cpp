@@ -0,0 +1,74 @@
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+#include "mystl/mapped_vector.h"
+#include "mystl/vector.h"
+
+// 准备一个 state.range(0) MB 的临时数据文件
+static std::string make_table(std::size_t mb) {
+  const std::string path = "/tmp/mystl_mapped_vector_bench_" +
+                           std::to_string(mb) + "mb.bin";
+  mystl::mapped_vector<std::uint64_t> v(path, mystl::map_mode::create);
+  const std::size_t n = (mb << 20) / sizeof(std::uint64_t);
+  v.reserve(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    v.push_back(i);
+  }
+  return path;
+}
+
+// --- 启动时加载整张表：mmap 只建立映射 ---
+
+static void BM_MappedVector_Open(benchmark::State& state) {
+  const std::string path = make_table(state.range(0));
+  for (auto _ : state) {
+    const mystl::mapped_vector<std::uint64_t> v(path,
+                                                mystl::map_mode::read_only);
+    benchmark::DoNotOptimize(v.data());
+  }
+  std::remove(path.c_str());
+}
+BENCHMARK(BM_MappedVector_Open)->Arg(16)->Arg(256)->Unit(benchmark::kMicrosecond);
+
+// 打开后随机访问少量元素，只有被访问的页才会被读入
+static void BM_MappedVector_OpenAndProbe(benchmark::State& state) {
+  const std::string path = make_table(state.range(0));
+  for (auto _ : state) {
+    const mystl::mapped_vector<std::uint64_t> v(path,
+                                                mystl::map_mode::read_only);
+    std::uint64_t sum = 0;
+    for (std::size_t i = 0; i < v.size(); i += v.size() / 64) {
+      sum += v[i];
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  std::remove(path.c_str());
+}
+BENCHMARK(BM_MappedVector_OpenAndProbe)
+    ->Arg(16)
+    ->Arg(256)
+    ->Unit(benchmark::kMicrosecond);
+
+// --- 对比：把整个文件读进 mystl::vector ---
+
+static void BM_Vector_ReadWholeFile(benchmark::State& state) {
+  const std::string path = make_table(state.range(0));
+  const std::size_t n = (std::size_t(state.range(0)) << 20) / 8;
+  for (auto _ : state) {
+    mystl::vector<std::uint64_t> v(n);
+    std::FILE* f = std::fopen(path.c_str(), "rb");
+    std::size_t got = std::fread(v.data(), sizeof(std::uint64_t), n, f);
+    std::fclose(f);
+    benchmark::DoNotOptimize(got);
+  }
+  std::remove(path.c_str());
+}
+BENCHMARK(BM_Vector_ReadWholeFile)
+    ->Arg(16)
+    ->Arg(256)
+    ->Unit(benchmark::kMicrosecond);
+
+// 运行 benchmark
+BENCHMARK_MAIN();
@@ -0,0 +1,100 @@
+#include <benchmark/benchmark.h>
+#include <vector>
+
+#include "mystl/vector.h"
+
+// --- 测试 mystl::vector 的串行构造与并行构造 ---
+
+static void BM_MyVector_FillConstruct(benchmark::State& state) {
+  const std::size_t n = state.range(0);
+  for (auto _ : state) {
+    mystl::vector<int> v(n, 1);
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * n * sizeof(int));
+}
+BENCHMARK(BM_MyVector_FillConstruct)->Range(1 << 16, 1 << 26);
+
+static void BM_MyVector_ParallelFillConstruct(benchmark::State& state) {
+  const std::size_t n = state.range(0);
+  for (auto _ : state) {
+    mystl::vector<int> v(mystl::parallel_construct, n, 1);
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * n * sizeof(int));
+}
+BENCHMARK(BM_MyVector_ParallelFillConstruct)
+    ->Range(1 << 16, 1 << 26)
+    ->UseRealTime();
+
+static void BM_MyVector_ParallelCopyConstruct(benchmark::State& state) {
+  const std::size_t n = state.range(0);
+  mystl::vector<int> src(n, 1);
+  for (auto _ : state) {
+    mystl::vector<int> v(mystl::parallel_construct, src.begin(), src.end());
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * n * sizeof(int));
+}
+BENCHMARK(BM_MyVector_ParallelCopyConstruct)
+    ->Range(1 << 16, 1 << 26)
+    ->UseRealTime();
+
+// --- 测试区间插入与删除（单次移动尾部） ---
+
+static void BM_MyVector_InsertMiddle(benchmark::State& state) {
+  const std::size_t n = state.range(0);
+  mystl::vector<int> src(n / 8, 2);
+  for (auto _ : state) {
+    mystl::vector<int> v(n, 1);
+    v.insert(v.begin() + n / 2, src.begin(), src.end());
+    v.erase(v.begin() + n / 4, v.begin() + n / 4 + n / 8);
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * n);
+}
+BENCHMARK(BM_MyVector_InsertMiddle)->Range(1 << 10, 1 << 22);
+
+static void BM_MyVector_EraseIf(benchmark::State& state) {
+  const std::size_t n = state.range(0);
+  for (auto _ : state) {
+    state.PauseTiming();
+    mystl::vector<int> v(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      v[i] = int(i);
+    }
+    state.ResumeTiming();
+    mystl::erase_if(v, [](int x) { return x % 3 == 0; });
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * n);
+}
+BENCHMARK(BM_MyVector_EraseIf)->Range(1 << 10, 1 << 22);
+
+// --- 对比测试 std::vector ---
+
+static void BM_StdVector_FillConstruct(benchmark::State& state) {
+  const std::size_t n = state.range(0);
+  for (auto _ : state) {
+    std::vector<int> v(n, 1);
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * n * sizeof(int));
+}
+BENCHMARK(BM_StdVector_FillConstruct)->Range(1 << 16, 1 << 26);
+
+static void BM_StdVector_InsertMiddle(benchmark::State& state) {
+  const std::size_t n = state.range(0);
+  std::vector<int> src(n / 8, 2);
+  for (auto _ : state) {
+    std::vector<int> v(n, 1);
+    v.insert(v.begin() + n / 2, src.begin(), src.end());
+    v.erase(v.begin() + n / 4, v.begin() + n / 4 + n / 8);
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * n);
+}
+BENCHMARK(BM_StdVector_InsertMiddle)->Range(1 << 10, 1 << 22);
+
+// 运行 benchmark
+BENCHMARK_MAIN();
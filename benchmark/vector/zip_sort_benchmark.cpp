@@ -0,0 +1,110 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "mystl/vector.h"
+#include "mystl/zip.h"
+
+// --- 按 key 排序两列平行数组：zip 原地排序 vs 拷贝成 pair 排序再写回 ---
+
+struct Columns {
+  mystl::vector<std::uint32_t> keys;
+  mystl::vector<std::uint64_t> values;
+};
+
+static const Columns& source_columns(std::size_t n) {
+  static Columns cols;
+  if (cols.keys.size() != n) {
+    std::mt19937 rng(12345);
+    cols.keys = mystl::vector<std::uint32_t>(n);
+    cols.values = mystl::vector<std::uint64_t>(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      cols.keys[i] = std::uint32_t(rng());
+      cols.values[i] = i;
+    }
+  }
+  return cols;
+}
+
+static void reset(Columns& dst, const Columns& src) {
+  std::copy(src.keys.begin(), src.keys.end(), dst.keys.begin());
+  std::copy(src.values.begin(), src.values.end(), dst.values.begin());
+}
+
+// zip 视图直接交给 std::sort，只比较 key
+static void BM_ZipSort(benchmark::State& state) {
+  const std::size_t n = std::size_t(state.range(0));
+  const Columns& src = source_columns(n);
+  Columns cols{src.keys, src.values};
+  for (auto _ : state) {
+    state.PauseTiming();
+    reset(cols, src);
+    state.ResumeTiming();
+    auto z = mystl::zip(cols.keys, cols.values);
+    std::sort(z.begin(), z.end(), [](const auto& a, const auto& b) {
+      return mystl::get<0>(a) < mystl::get<0>(b);
+    });
+    benchmark::DoNotOptimize(cols.keys.data());
+    benchmark::DoNotOptimize(cols.values.data());
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(n));
+}
+BENCHMARK(BM_ZipSort)
+    ->Arg(1 << 20)
+    ->Arg(10000000)
+    ->Unit(benchmark::kMillisecond);
+
+// 拷贝到 std::vector<std::pair>，排序后分散写回两列（额外 n * 16 字节临时内存）
+static void BM_CopySortScatter(benchmark::State& state) {
+  const std::size_t n = std::size_t(state.range(0));
+  const Columns& src = source_columns(n);
+  Columns cols{src.keys, src.values};
+  for (auto _ : state) {
+    state.PauseTiming();
+    reset(cols, src);
+    state.ResumeTiming();
+    std::vector<std::pair<std::uint32_t, std::uint64_t>> rows(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      rows[i] = {cols.keys[i], cols.values[i]};
+    }
+    std::sort(rows.begin(), rows.end(), [](const auto& a, const auto& b) {
+      return a.first < b.first;
+    });
+    for (std::size_t i = 0; i < n; ++i) {
+      cols.keys[i] = rows[i].first;
+      cols.values[i] = rows[i].second;
+    }
+    benchmark::DoNotOptimize(cols.keys.data());
+    benchmark::DoNotOptimize(cols.values.data());
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(n));
+}
+BENCHMARK(BM_CopySortScatter)
+    ->Arg(1 << 20)
+    ->Arg(10000000)
+    ->Unit(benchmark::kMillisecond);
+
+// 只排序 key 一列，作为下限参考
+static void BM_KeysOnlySort(benchmark::State& state) {
+  const std::size_t n = std::size_t(state.range(0));
+  const Columns& src = source_columns(n);
+  mystl::vector<std::uint32_t> keys = src.keys;
+  for (auto _ : state) {
+    state.PauseTiming();
+    std::copy(src.keys.begin(), src.keys.end(), keys.begin());
+    state.ResumeTiming();
+    std::sort(keys.begin(), keys.end());
+    benchmark::DoNotOptimize(keys.data());
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(n));
+}
+BENCHMARK(BM_KeysOnlySort)
+    ->Arg(1 << 20)
+    ->Arg(10000000)
+    ->Unit(benchmark::kMillisecond);
+
+// 运行 benchmark
+BENCHMARK_MAIN();
@@ -0,0 +1,801 @@
+#ifndef __MYSTL_ALGORITHM_H__
+#define __MYSTL_ALGORITHM_H__
+
+#include <algorithm>  // for std::rotate, std::reverse, std::lower_bound ...
+#include <cstddef>
+#include <functional>  // for std::less, std::greater
+#include <iterator>
+#include <memory>  // for std::uninitialized_move, std::destroy
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "mystl/allocator.h"
+#include "mystl/utility.h"
+
+namespace mystl {
+/*
+ * 排序与选择算法，适用于任意随机访问迭代器（mystl::vector / mystl::array 的迭代器、
+ * 裸指针，以及 zip 之类的代理迭代器）
+ *
+ * sort: pattern-defeating quicksort (pdqsort, Orson Peters)
+ * - 小区间（< 24）用插入排序；大区间用三数取中，超过 128 个元素时用九数取中
+ * - 已经有序的区间在划分时被识别出来，只做一次有限的插入排序就结束，
+ *   所以有序、逆序、几乎有序的输入都是 O(n)
+ * - 与枢轴相等的元素很多时，把等于枢轴的元素一次性划到左边（partition_left），
+ *   少量不同值的输入也是 O(n log k)
+ * - 划分严重不平衡时打乱几个元素破坏对抗性模式，次数超过 log2(n) 退化成堆排序，
+ *   最坏 O(n log n)
+ * - 元素是算术类型且比较器是 std::less / std::greater 时，用 BlockQuicksort 的
+ *   无分支划分：先把一块 64 个元素的比较结果写进偏移数组，再集中交换，
+ *   比较结果不再决定跳转，随机数据上没有分支预测失败
+ *
+ * stable_sort: 自顶向下归并排序，临时缓冲区（n / 2 个元素）由 mystl::allocator 分配，
+ *   分配失败时退化成不需要缓冲区的原地归并（O(n log^2 n)）；
+ *   严格递减的段直接反转，右半整体小于左半时旋转代替归并，逆序输入是 O(n log n) 次移动
+ * partial_sort: 在 [first, middle) 上维护最大堆，最后堆排序
+ * nth_element: 与 sort 相同的枢轴选择、划分和打乱（introselect），
+ *   不平衡次数过多时改用堆选择
+ */
+namespace detail {
+namespace sort_impl {
+constexpr std::ptrdiff_t kInsertionSortThreshold = 24;
+constexpr std::ptrdiff_t kNintherThreshold = 128;
+constexpr std::ptrdiff_t kPartialInsertionSortLimit = 8;
+constexpr std::size_t kBlockSize = 64;
+constexpr std::size_t kCacheLineSize = 64;
+constexpr std::ptrdiff_t kStableSortRun = 32;
+
+template <class Iter>
+using value_t = typename std::iterator_traits<Iter>::value_type;
+
+// 这些比较器对算术类型就是一条比较指令，可以安全地走无分支划分
+template <class Compare, class T>
+struct is_default_compare : std::false_type {};
+template <class T>
+struct is_default_compare<std::less<T>, T> : std::true_type {};
+template <class T>
+struct is_default_compare<std::greater<T>, T> : std::true_type {};
+template <class T>
+struct is_default_compare<std::less<>, T> : std::true_type {};
+template <class T>
+struct is_default_compare<std::greater<>, T> : std::true_type {};
+
+template <class Iter, class Compare>
+constexpr bool use_branchless_v =
+    std::is_arithmetic<value_t<Iter>>::value &&
+    is_default_compare<std::decay_t<Compare>, value_t<Iter>>::value;
+
+inline int log2_floor(std::size_t n) {
+  int log = 0;
+  while (n >>= 1) {
+    ++log;
+  }
+  return log;
+}
+
+template <class Iter, class Compare>
+void insertion_sort(Iter begin, Iter end, Compare& comp) {
+  if (begin == end) {
+    return;
+  }
+  for (Iter cur = begin + 1; cur != end; ++cur) {
+    Iter sift = cur;
+    Iter sift_1 = cur - 1;
+    if (comp(*sift, *sift_1)) {
+      value_t<Iter> tmp = mystl::move(*sift);
+      do {
+        *sift-- = mystl::move(*sift_1);
+      } while (sift != begin && comp(tmp, *--sift_1));
+      *sift = mystl::move(tmp);
+    }
+  }
+}
+
+// 要求 begin 左边有一个不大于 [begin, end) 中任何元素的元素作为哨兵
+template <class Iter, class Compare>
+void unguarded_insertion_sort(Iter begin, Iter end, Compare& comp) {
+  if (begin == end) {
+    return;
+  }
+  for (Iter cur = begin + 1; cur != end; ++cur) {
+    Iter sift = cur;
+    Iter sift_1 = cur - 1;
+    if (comp(*sift, *sift_1)) {
+      value_t<Iter> tmp = mystl::move(*sift);
+      do {
+        *sift-- = mystl::move(*sift_1);
+      } while (comp(tmp, *--sift_1));
+      *sift = mystl::move(tmp);
+    }
+  }
+}
+
+// 插入排序，但元素总共移动超过 kPartialInsertionSortLimit 次就放弃并返回 false
+template <class Iter, class Compare>
+bool partial_insertion_sort(Iter begin, Iter end, Compare& comp) {
+  if (begin == end) {
+    return true;
+  }
+  std::ptrdiff_t limit = 0;
+  for (Iter cur = begin + 1; cur != end; ++cur) {
+    Iter sift = cur;
+    Iter sift_1 = cur - 1;
+    if (comp(*sift, *sift_1)) {
+      value_t<Iter> tmp = mystl::move(*sift);
+      do {
+        *sift-- = mystl::move(*sift_1);
+      } while (sift != begin && comp(tmp, *--sift_1));
+      *sift = mystl::move(tmp);
+      limit += cur - sift;
+    }
+    if (limit > kPartialInsertionSortLimit) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <class Iter, class Compare>
+void sort2(Iter a, Iter b, Compare& comp) {
+  if (comp(*b, *a)) {
+    std::iter_swap(a, b);
+  }
+}
+
+template <class Iter, class Compare>
+void sort3(Iter a, Iter b, Iter c, Compare& comp) {
+  sort2(a, b, comp);
+  sort2(b, c, comp);
+  sort2(a, b, comp);
+}
+
+// 把枢轴放到 *begin；同时保证 [begin + 1, end) 中存在不小于枢轴的元素，
+// 划分时向右扫描不需要边界检查
+template <class Iter, class Compare>
+void choose_pivot(Iter begin, Iter end, Compare& comp) {
+  const std::ptrdiff_t size = end - begin;
+  const std::ptrdiff_t s2 = size / 2;
+  if (size > kNintherThreshold) {
+    sort3(begin, begin + s2, end - 1, comp);
+    sort3(begin + 1, begin + (s2 - 1), end - 2, comp);
+    sort3(begin + 2, begin + (s2 + 1), end - 3, comp);
+    sort3(begin + (s2 - 1), begin + s2, begin + (s2 + 1), comp);
+    std::iter_swap(begin, begin + s2);
+  } else {
+    sort3(begin + s2, begin, end - 1, comp);
+  }
+}
+
+// 交换 num 对错位的元素；两边个数相同时逐对交换，否则用一次循环移位少做一半写入
+template <class Iter>
+void swap_offsets(Iter first, Iter last, const unsigned char* offsets_l,
+                  const unsigned char* offsets_r, std::size_t num,
+                  bool use_swaps) {
+  if (use_swaps) {
+    for (std::size_t i = 0; i < num; ++i) {
+      std::iter_swap(first + offsets_l[i], last - offsets_r[i]);
+    }
+  } else if (num > 0) {
+    Iter l = first + offsets_l[0];
+    Iter r = last - offsets_r[0];
+    value_t<Iter> tmp(mystl::move(*l));
+    *l = mystl::move(*r);
+    for (std::size_t i = 1; i < num; ++i) {
+      l = first + offsets_l[i];
+      *r = mystl::move(*l);
+      r = last - offsets_r[i];
+      *l = mystl::move(*r);
+    }
+    *r = mystl::move(tmp);
+  }
+}
+
+// 以 *begin 为枢轴划分，小于枢轴的放左边，不小于的放右边。
+// 返回枢轴的最终位置，以及划分前是否已经分好（没有发生交换）
+template <class Iter, class Compare>
+mystl::pair<Iter, bool> partition_right(Iter begin, Iter end,
+                                        Compare& comp) {
+  value_t<Iter> pivot(mystl::move(*begin));
+  Iter first = begin;
+  Iter last = end;
+
+  while (comp(*++first, pivot)) {
+  }
+  // 左边第一个就不小于枢轴时，右边可能找不到小于枢轴的元素，需要边界检查
+  if (first - 1 == begin) {
+    while (first < last && !comp(*--last, pivot)) {
+    }
+  } else {
+    while (!comp(*--last, pivot)) {
+    }
+  }
+
+  const bool already_partitioned = first >= last;
+  while (first < last) {
+    std::iter_swap(first, last);
+    while (comp(*++first, pivot)) {
+    }
+    while (!comp(*--last, pivot)) {
+    }
+  }
+
+  Iter pivot_pos = first - 1;
+  *begin = mystl::move(*pivot_pos);
+  *pivot_pos = mystl::move(pivot);
+  return mystl::pair<Iter, bool>(pivot_pos, already_partitioned);
+}
+
+// 与 partition_right 结果相同，但逐块收集需要交换的元素的偏移：
+// num += !comp(...) 把比较结果当作整数使用，循环里没有依赖数据的分支
+template <class Iter, class Compare>
+mystl::pair<Iter, bool> partition_right_branchless(Iter begin, Iter end,
+                                                   Compare& comp) {
+  value_t<Iter> pivot(mystl::move(*begin));
+  Iter first = begin;
+  Iter last = end;
+
+  while (comp(*++first, pivot)) {
+  }
+  if (first - 1 == begin) {
+    while (first < last && !comp(*--last, pivot)) {
+    }
+  } else {
+    while (!comp(*--last, pivot)) {
+    }
+  }
+
+  const bool already_partitioned = first >= last;
+  if (!already_partitioned) {
+    std::iter_swap(first, last);
+    ++first;
+
+    alignas(kCacheLineSize) unsigned char offsets_l[kBlockSize];
+    alignas(kCacheLineSize) unsigned char offsets_r[kBlockSize];
+    Iter offsets_l_base = first;
+    Iter offsets_r_base = last;
+    std::size_t num_l = 0, num_r = 0, start_l = 0, start_r = 0;
+
+    while (first < last) {
+      // 还没归位的元素不足两块时，按剩余的个数分给左右两边
+      const std::size_t num_unknown = std::size_t(last - first);
+      const std::size_t left_split =
+          num_l == 0 ? (num_r == 0 ? num_unknown / 2 : num_unknown) : 0;
+      const std::size_t right_split =
+          num_r == 0 ? (num_unknown - left_split) : 0;
+
+      if (left_split >= kBlockSize) {
+        for (std::size_t i = 0; i < kBlockSize;) {
+          offsets_l[num_l] = static_cast<unsigned char>(i++);
+          num_l += !comp(*first, pivot);
+          ++first;
+          offsets_l[num_l] = static_cast<unsigned char>(i++);
+          num_l += !comp(*first, pivot);
+          ++first;
+          offsets_l[num_l] = static_cast<unsigned char>(i++);
+          num_l += !comp(*first, pivot);
+          ++first;
+          offsets_l[num_l] = static_cast<unsigned char>(i++);
+          num_l += !comp(*first, pivot);
+          ++first;
+        }
+      } else {
+        for (std::size_t i = 0; i < left_split;) {
+          offsets_l[num_l] = static_cast<unsigned char>(i++);
+          num_l += !comp(*first, pivot);
+          ++first;
+        }
+      }
+
+      if (right_split >= kBlockSize) {
+        for (std::size_t i = 0; i < kBlockSize;) {
+          offsets_r[num_r] = static_cast<unsigned char>(++i);
+          num_r += comp(*--last, pivot);
+          offsets_r[num_r] = static_cast<unsigned char>(++i);
+          num_r += comp(*--last, pivot);
+          offsets_r[num_r] = static_cast<unsigned char>(++i);
+          num_r += comp(*--last, pivot);
+          offsets_r[num_r] = static_cast<unsigned char>(++i);
+          num_r += comp(*--last, pivot);
+        }
+      } else {
+        for (std::size_t i = 0; i < right_split;) {
+          offsets_r[num_r] = static_cast<unsigned char>(++i);
+          num_r += comp(*--last, pivot);
+        }
+      }
+
+      const std::size_t num = num_l < num_r ? num_l : num_r;
+      swap_offsets(offsets_l_base, offsets_r_base, offsets_l + start_l,
+                   offsets_r + start_r, num, num_l == num_r);
+      num_l -= num;
+      num_r -= num;
+      start_l += num;
+      start_r += num;
+      if (num_l == 0) {
+        start_l = 0;
+        offsets_l_base = first;
+      }
+      if (num_r == 0) {
+        start_r = 0;
+        offsets_r_base = last;
+      }
+    }
+
+    // 只剩一边有待交换的元素，把它们依次换到分界处
+    if (num_l) {
+      while (num_l--) {
+        std::iter_swap(offsets_l_base + offsets_l[start_l + num_l], --last);
+      }
+      first = last;
+    }
+    if (num_r) {
+      while (num_r--) {
+        std::iter_swap(offsets_r_base - offsets_r[start_r + num_r], first);
+        ++first;
+      }
+      last = first;
+    }
+  }
+
+  Iter pivot_pos = first - 1;
+  *begin = mystl::move(*pivot_pos);
+  *pivot_pos = mystl::move(pivot);
+  return mystl::pair<Iter, bool>(pivot_pos, already_partitioned);
+}
+
+// 把等于枢轴的元素都放到左边，返回枢轴的位置；
+// 调用时左侧哨兵等于枢轴，说明 [begin, end) 中有大量与它相等的元素
+template <class Iter, class Compare>
+Iter partition_left(Iter begin, Iter end, Compare& comp) {
+  value_t<Iter> pivot(mystl::move(*begin));
+  Iter first = begin;
+  Iter last = end;
+
+  while (comp(pivot, *--last)) {
+  }
+  if (last + 1 == end) {
+    while (first < last && !comp(pivot, *++first)) {
+    }
+  } else {
+    while (!comp(pivot, *++first)) {
+    }
+  }
+
+  while (first < last) {
+    std::iter_swap(first, last);
+    while (comp(pivot, *--last)) {
+    }
+    while (!comp(pivot, *++first)) {
+    }
+  }
+
+  Iter pivot_pos = last;
+  *begin = mystl::move(*pivot_pos);
+  *pivot_pos = mystl::move(pivot);
+  return pivot_pos;
+}
+
+template <bool Branchless, class Iter, class Compare>
+mystl::pair<Iter, bool> partition_pivot(Iter begin, Iter end, Compare& comp) {
+  if constexpr (Branchless) {
+    return partition_right_branchless(begin, end, comp);
+  } else {
+    return partition_right(begin, end, comp);
+  }
+}
+
+//===========================================================
+//========================= 堆 ==============================
+//===========================================================
+// 最大堆，堆顶是 comp 意义下最大的元素
+template <class Iter, class Compare>
+void sift_down(Iter first, std::ptrdiff_t len, std::ptrdiff_t hole,
+               value_t<Iter> value, Compare& comp) {
+  std::ptrdiff_t child = 2 * hole + 1;
+  while (child < len) {
+    if (child + 1 < len && comp(first[child], first[child + 1])) {
+      ++child;
+    }
+    if (!comp(value, first[child])) {
+      break;
+    }
+    first[hole] = mystl::move(first[child]);
+    hole = child;
+    child = 2 * hole + 1;
+  }
+  first[hole] = mystl::move(value);
+}
+
+template <class Iter, class Compare>
+void make_max_heap(Iter first, Iter last, Compare& comp) {
+  const std::ptrdiff_t len = last - first;
+  for (std::ptrdiff_t i = len / 2 - 1; i >= 0; --i) {
+    sift_down(first, len, i, value_t<Iter>(mystl::move(first[i])), comp);
+  }
+}
+
+template <class Iter, class Compare>
+void sort_max_heap(Iter first, Iter last, Compare& comp) {
+  for (std::ptrdiff_t len = last - first; len > 1; --len) {
+    value_t<Iter> value = mystl::move(first[len - 1]);
+    first[len - 1] = mystl::move(first[0]);
+    sift_down(first, len - 1, 0, mystl::move(value), comp);
+  }
+}
+
+template <class Iter, class Compare>
+void heap_select(Iter first, Iter middle, Iter last, Compare& comp) {
+  make_max_heap(first, middle, comp);
+  const std::ptrdiff_t len = middle - first;
+  for (Iter it = middle; it < last; ++it) {
+    if (comp(*it, *first)) {
+      value_t<Iter> value = mystl::move(*it);
+      *it = mystl::move(*first);
+      sift_down(first, len, 0, mystl::move(value), comp);
+    }
+  }
+}
+
+//===========================================================
+//======================== pdqsort ==========================
+//===========================================================
+// 划分严重不平衡时交换两侧的几个元素，打乱可能的对抗性模式
+template <class Iter>
+void break_patterns(Iter begin, Iter pivot_pos, Iter end) {
+  const std::ptrdiff_t l_size = pivot_pos - begin;
+  const std::ptrdiff_t r_size = end - (pivot_pos + 1);
+  if (l_size >= kInsertionSortThreshold) {
+    std::iter_swap(begin, begin + l_size / 4);
+    std::iter_swap(pivot_pos - 1, pivot_pos - l_size / 4);
+    if (l_size > kNintherThreshold) {
+      std::iter_swap(begin + 1, begin + (l_size / 4 + 1));
+      std::iter_swap(begin + 2, begin + (l_size / 4 + 2));
+      std::iter_swap(pivot_pos - 2, pivot_pos - (l_size / 4 + 1));
+      std::iter_swap(pivot_pos - 3, pivot_pos - (l_size / 4 + 2));
+    }
+  }
+  if (r_size >= kInsertionSortThreshold) {
+    std::iter_swap(pivot_pos + 1, pivot_pos + (1 + r_size / 4));
+    std::iter_swap(end - 1, end - r_size / 4);
+    if (r_size > kNintherThreshold) {
+      std::iter_swap(pivot_pos + 2, pivot_pos + (2 + r_size / 4));
+      std::iter_swap(pivot_pos + 3, pivot_pos + (3 + r_size / 4));
+      std::iter_swap(end - 2, end - (1 + r_size / 4));
+      std::iter_swap(end - 3, end - (2 + r_size / 4));
+    }
+  }
+}
+
+template <bool Branchless, class Iter, class Compare>
+void pdqsort_loop(Iter begin, Iter end, Compare& comp, int bad_allowed,
+                  bool leftmost = true) {
+  while (true) {
+    const std::ptrdiff_t size = end - begin;
+    if (size < kInsertionSortThreshold) {
+      if (leftmost) {
+        insertion_sort(begin, end, comp);
+      } else {
+        unguarded_insertion_sort(begin, end, comp);
+      }
+      return;
+    }
+
+    choose_pivot(begin, end, comp);
+
+    // 左侧哨兵（上一层的枢轴）不小于这次的枢轴，说明两者相等：
+    // 等于枢轴的元素全部放到左边，它们已经在最终位置，只需继续处理右边
+    if (!leftmost && !comp(*(begin - 1), *begin)) {
+      begin = partition_left(begin, end, comp) + 1;
+      continue;
+    }
+
+    const mystl::pair<Iter, bool> part =
+        partition_pivot<Branchless>(begin, end, comp);
+    const Iter pivot_pos = part.first;
+    const bool already_partitioned = part.second;
+
+    const std::ptrdiff_t l_size = pivot_pos - begin;
+    const std::ptrdiff_t r_size = end - (pivot_pos + 1);
+    const bool highly_unbalanced = l_size < size / 8 || r_size < size / 8;
+
+    if (highly_unbalanced) {
+      // 不平衡次数用完，退化成堆排序保证 O(n log n)
+      if (--bad_allowed == 0) {
+        make_max_heap(begin, end, comp);
+        sort_max_heap(begin, end, comp);
+        return;
+      }
+
+      break_patterns(begin, pivot_pos, end);
+    } else if (already_partitioned &&
+               partial_insertion_sort(begin, pivot_pos, comp) &&
+               partial_insertion_sort(pivot_pos + 1, end, comp)) {
+      // 划分时没有交换，两边又几乎有序：很可能整体已经有序
+      return;
+    }
+
+    // 递归处理左边，循环处理右边，栈深度 O(log n)
+    pdqsort_loop<Branchless>(begin, pivot_pos, comp, bad_allowed, leftmost);
+    begin = pivot_pos + 1;
+    leftmost = false;
+  }
+}
+
+//===========================================================
+//======================= introselect =======================
+//===========================================================
+template <bool Branchless, class Iter, class Compare>
+void introselect(Iter begin, Iter nth, Iter end, Compare& comp) {
+  int bad_allowed = log2_floor(std::size_t(end - begin));
+  while (end - begin >= kInsertionSortThreshold) {
+    choose_pivot(begin, end, comp);
+    const Iter pivot_pos = partition_pivot<Branchless>(begin, end, comp).first;
+    if (pivot_pos == nth) {
+      return;
+    }
+
+    const std::ptrdiff_t size = end - begin;
+    const std::ptrdiff_t l_size = pivot_pos - begin;
+    const std::ptrdiff_t r_size = end - (pivot_pos + 1);
+    if ((l_size < size / 8 || r_size < size / 8) && --bad_allowed == 0) {
+      // 只有 nth 所在的一侧还需要处理，用堆选出前 nth + 1 个再把最大的放到 nth
+      if (nth < pivot_pos) {
+        end = pivot_pos;
+      } else {
+        begin = pivot_pos + 1;
+      }
+      heap_select(begin, nth + 1, end, comp);
+      std::iter_swap(begin, nth);
+      return;
+    }
+    if (l_size < size / 8 || r_size < size / 8) {
+      break_patterns(begin, pivot_pos, end);
+    }
+
+    if (nth < pivot_pos) {
+      end = pivot_pos;
+    } else {
+      begin = pivot_pos + 1;
+    }
+  }
+  insertion_sort(begin, end, comp);
+}
+
+//===========================================================
+//====================== stable_sort ========================
+//===========================================================
+// mystl::allocator 分配的未初始化缓冲区，析构时释放
+template <class T>
+class temporary_buffer {
+  mystl::allocator<T> alloc;
+  T* ptr{nullptr};
+  std::size_t len{0};
+
+ public:
+  explicit temporary_buffer(std::size_t n) {
+    if (n == 0) {
+      return;
+    }
+    try {
+      ptr = alloc.allocate(n);
+      len = n;
+    } catch (const std::bad_alloc&) {
+      // 分配失败时调用方退化成原地归并
+      ptr = nullptr;
+      len = 0;
+    }
+  }
+
+  ~temporary_buffer() {
+    if (ptr) {
+      alloc.deallocate(ptr, len);
+    }
+  }
+
+  temporary_buffer(const temporary_buffer&) = delete;
+  temporary_buffer& operator=(const temporary_buffer&) = delete;
+
+  T* data() const noexcept { return ptr; }
+  std::size_t size() const noexcept { return len; }
+};
+
+// 在 [first, first + n) 上构造过的元素，离开作用域时析构
+template <class T>
+struct destroy_guard {
+  T* first;
+  std::size_t n;
+  ~destroy_guard() { std::destroy(first, first + n); }
+};
+
+// 左半边移进缓冲区，再与右半边归并回原位；相等时取左边的元素保证稳定
+template <class Iter, class Compare>
+void merge_with_buffer(Iter first, Iter middle, Iter last,
+                       value_t<Iter>* buffer, Compare& comp) {
+  using T = value_t<Iter>;
+  const std::size_t n = std::size_t(middle - first);
+  T* buf_end = std::uninitialized_move(first, middle, buffer);
+  destroy_guard<T> guard{buffer, n};
+
+  T* left = buffer;
+  Iter right = middle;
+  Iter out = first;
+  while (left != buf_end && right != last) {
+    if (comp(*right, *left)) {
+      *out = mystl::move(*right);
+      ++right;
+    } else {
+      *out = mystl::move(*left);
+      ++left;
+    }
+    ++out;
+  }
+  // 右边剩下的元素已经在正确的位置
+  while (left != buf_end) {
+    *out = mystl::move(*left);
+    ++left;
+    ++out;
+  }
+}
+
+// 没有缓冲区时的原地归并：二分找切分点，旋转后递归，O(n log n)
+template <class Iter, class Compare>
+void merge_without_buffer(Iter first, Iter middle, Iter last,
+                          std::ptrdiff_t len1, std::ptrdiff_t len2,
+                          Compare& comp) {
+  if (len1 == 0 || len2 == 0) {
+    return;
+  }
+  if (len1 + len2 == 2) {
+    if (comp(*middle, *first)) {
+      std::iter_swap(first, middle);
+    }
+    return;
+  }
+  Iter cut1 = first;
+  Iter cut2 = middle;
+  std::ptrdiff_t len11 = 0;
+  std::ptrdiff_t len22 = 0;
+  if (len1 > len2) {
+    len11 = len1 / 2;
+    cut1 += len11;
+    cut2 = std::lower_bound(middle, last, *cut1, comp);
+    len22 = cut2 - middle;
+  } else {
+    len22 = len2 / 2;
+    cut2 += len22;
+    cut1 = std::upper_bound(first, middle, *cut2, comp);
+    len11 = cut1 - first;
+  }
+  Iter new_middle = std::rotate(cut1, middle, cut2);
+  merge_without_buffer(first, cut1, new_middle, len11, len22, comp);
+  merge_without_buffer(new_middle, cut2, last, len1 - len11, len2 - len22,
+                       comp);
+}
+
+// buffer 为空时使用原地归并
+// 归并排序的最小段：严格递减的段直接反转（没有相等元素，反转是稳定的），
+// 否则插入排序
+template <class Iter, class Compare>
+void sort_run(Iter first, Iter last, Compare& comp) {
+  if (first == last) {
+    return;
+  }
+  Iter it = first + 1;
+  while (it != last && comp(*it, *(it - 1))) {
+    ++it;
+  }
+  if (it == last) {
+    std::reverse(first, last);
+  } else {
+    insertion_sort(first, last, comp);
+  }
+}
+
+template <class Iter, class Compare>
+void merge_sort(Iter first, Iter last, value_t<Iter>* buffer, Compare& comp) {
+  const std::ptrdiff_t len = last - first;
+  if (len <= kStableSortRun) {
+    sort_run(first, last, comp);
+    return;
+  }
+  const Iter middle = first + len / 2;
+  merge_sort(first, middle, buffer, comp);
+  merge_sort(middle, last, buffer, comp);
+  // 两半已经首尾有序时不需要归并
+  if (!comp(*middle, *(middle - 1))) {
+    return;
+  }
+  // 右半整体小于左半（如逆序输入），旋转即可
+  if (comp(*(last - 1), *first)) {
+    std::rotate(first, middle, last);
+    return;
+  }
+  if (buffer) {
+    merge_with_buffer(first, middle, last, buffer, comp);
+  } else {
+    merge_without_buffer(first, middle, last, middle - first, last - middle,
+                         comp);
+  }
+}
+}  // namespace sort_impl
+}  // namespace detail
+
+//===========================================================
+//========================== sort ===========================
+//===========================================================
+template <class RandomIt, class Compare>
+void sort(RandomIt first, RandomIt last, Compare comp) {
+  if (last - first < 2) {
+    return;
+  }
+  namespace impl = detail::sort_impl;
+  impl::pdqsort_loop<impl::use_branchless_v<RandomIt, Compare>>(
+      first, last, comp, impl::log2_floor(std::size_t(last - first)));
+}
+
+template <class RandomIt>
+void sort(RandomIt first, RandomIt last) {
+  mystl::sort(first, last, std::less<>());
+}
+
+//===========================================================
+//======================= stable_sort =======================
+//===========================================================
+template <class RandomIt, class Compare>
+void stable_sort(RandomIt first, RandomIt last, Compare comp) {
+  namespace impl = detail::sort_impl;
+  const std::ptrdiff_t len = last - first;
+  if (len <= impl::kStableSortRun) {
+    impl::sort_run(first, last, comp);
+    return;
+  }
+  // 每次归并只把左半边移进缓冲区，最大的左半边是 len / 2
+  impl::temporary_buffer<impl::value_t<RandomIt>> buffer(std::size_t(len / 2));
+  impl::merge_sort(first, last, buffer.data(), comp);
+}
+
+template <class RandomIt>
+void stable_sort(RandomIt first, RandomIt last) {
+  mystl::stable_sort(first, last, std::less<>());
+}
+
+//===========================================================
+//====================== partial_sort =======================
+//===========================================================
+// [first, middle) 变成整个区间最小的 middle - first 个元素且有序，其余元素顺序不定
+template <class RandomIt, class Compare>
+void partial_sort(RandomIt first, RandomIt middle, RandomIt last,
+                  Compare comp) {
+  if (first == middle) {
+    return;
+  }
+  detail::sort_impl::heap_select(first, middle, last, comp);
+  detail::sort_impl::sort_max_heap(first, middle, comp);
+}
+
+template <class RandomIt>
+void partial_sort(RandomIt first, RandomIt middle, RandomIt last) {
+  mystl::partial_sort(first, middle, last, std::less<>());
+}
+
+//===========================================================
+//====================== nth_element ========================
+//===========================================================
+// *nth 变成排序后位于该位置的元素，左边的都不大于它，右边的都不小于它
+template <class RandomIt, class Compare>
+void nth_element(RandomIt first, RandomIt nth, RandomIt last, Compare comp) {
+  if (nth == last || last - first < 2) {
+    return;
+  }
+  namespace impl = detail::sort_impl;
+  impl::introselect<impl::use_branchless_v<RandomIt, Compare>>(first, nth, last,
+                                                               comp);
+}
+
+template <class RandomIt>
+void nth_element(RandomIt first, RandomIt nth, RandomIt last) {
+  mystl::nth_element(first, nth, last, std::less<>());
+}
+}  // namespace mystl
+
+#endif
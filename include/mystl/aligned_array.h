@@ -0,0 +1,239 @@
+#ifndef __MYSTL_ALIGNED_ARRAY_H__
+#define __MYSTL_ALIGNED_ARRAY_H__
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include "mystl/array.h"
+
+namespace mystl {
+namespace detail {
+// 目标平台一个向量寄存器的字节数
+#if defined(__AVX512F__)
+constexpr std::size_t kNativeVectorBytes = 64;
+#elif defined(__AVX__)
+constexpr std::size_t kNativeVectorBytes = 32;
+#else
+constexpr std::size_t kNativeVectorBytes = 16;
+#endif
+
+#if defined(__GNUC__)
+// GCC/Clang 的向量扩展类型，算术运算符按元素进行；只对算术类型有定义
+template <class T, std::size_t Bytes, bool = std::is_arithmetic<T>::value>
+struct simd_vector {
+  typedef T type __attribute__((vector_size(Bytes)));
+};
+
+// 非算术类型没有向量类型，load/store 只有声明，调用时编译失败
+struct simd_vector_unavailable;
+
+template <class T, std::size_t Bytes>
+struct simd_vector<T, Bytes, false> {
+  using type = simd_vector_unavailable;
+};
+#endif
+}  // namespace detail
+
+/*
+ * aligned_array<T, N, Align>: 起始地址按 Align 字节对齐、长度填充到整块向量的定长数组
+ *
+ *   mystl::aligned_array<float, 10, 32> a;   // 32 字节对齐，存储 16 个 float
+ *   a.clear_padding();                        // 填充部分置零
+ *   for (std::size_t b = 0; b < a.vector_count(); ++b) {
+ *     a.store(b, a.load(b) * 2.0f);           // 没有尾部循环
+ *   }
+ *
+ * 存储长度 padded_size() 向上取整到 Align 字节的整数倍。load/store 使用的向量宽度是
+ * min(Align, 目标平台向量寄存器宽度)，lanes 是一块向量中的元素个数；
+ * padded_size() 总是 lanes 的整数倍，所以逐块处理时不需要处理尾部，
+ * 每次 load/store 都是对齐访问，也不会跨越缓存行（Align <= 64 时）。
+ * size()/begin()/end() 只覆盖前 N 个逻辑元素；填充元素在值初始化、fill()
+ * 或 clear_padding() 之后为 T()，对求和、点积等运算不产生影响。
+ */
+template <class T, std::size_t N, std::size_t Align = 64>
+struct aligned_array {
+  static_assert(Align != 0 && (Align & (Align - 1)) == 0,
+                "Align must be a power of two");
+  static_assert(Align >= alignof(T), "Align must not weaken alignof(T)");
+  static_assert(Align % sizeof(T) == 0,
+                "Align must be a multiple of sizeof(T)");
+
+  // member type
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using pointer = value_type*;
+  using const_pointer = const value_type*;
+  using iterator = value_type*;
+  using const_iterator = const value_type*;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  static constexpr size_type alignment = Align;
+  // load/store 一次处理的字节数和元素个数
+  static constexpr size_type vector_bytes =
+      Align < detail::kNativeVectorBytes ? Align : detail::kNativeVectorBytes;
+  static constexpr size_type lanes =
+      vector_bytes > sizeof(T) ? vector_bytes / sizeof(T) : 1;
+  static constexpr size_type kBlock = Align / sizeof(T);
+  static constexpr size_type kPaddedSize = (N + kBlock - 1) / kBlock * kBlock;
+
+#if defined(__GNUC__)
+  using vector_type = typename detail::simd_vector<T, vector_bytes>::type;
+#endif
+
+  alignas(Align) T m_data[kPaddedSize == 0 ? kBlock : kPaddedSize];
+
+  constexpr bool empty() const noexcept { return N == 0; }
+
+  constexpr size_type size() const noexcept { return N; }
+
+  constexpr size_type max_size() const noexcept { return N; }
+
+  // 包含填充在内的存储长度
+  constexpr size_type padded_size() const noexcept { return kPaddedSize; }
+
+  // 覆盖整个存储需要的向量块数
+  constexpr size_type vector_count() const noexcept {
+    return kPaddedSize / lanes;
+  }
+
+  constexpr reference at(size_type pos) {
+    if (pos >= size()) {
+      throw std::out_of_range("mystl::aligned_array::at");
+    }
+    return m_data[pos];
+  }
+
+  constexpr const_reference at(size_type pos) const {
+    if (pos >= size()) {
+      throw std::out_of_range("mystl::aligned_array::at");
+    }
+    return m_data[pos];
+  }
+
+  constexpr reference operator[](size_type pos) { return m_data[pos]; }
+
+  constexpr const_reference operator[](size_type pos) const {
+    return m_data[pos];
+  }
+
+  constexpr reference front() { return m_data[0]; }
+
+  constexpr const_reference front() const { return m_data[0]; }
+
+  constexpr reference back() { return m_data[N - 1]; }
+
+  constexpr const_reference back() const { return m_data[N - 1]; }
+
+  // [data(), data() + padded_size())，data() 按 Align 对齐
+  constexpr pointer data() noexcept { return m_data; }
+
+  constexpr const_pointer data() const noexcept { return m_data; }
+
+  constexpr iterator begin() noexcept { return m_data; }
+
+  constexpr const_iterator begin() const noexcept { return m_data; }
+
+  constexpr const_iterator cbegin() const noexcept { return m_data; }
+
+  constexpr iterator end() noexcept { return m_data + N; }
+
+  constexpr const_iterator end() const noexcept { return m_data + N; }
+
+  constexpr const_iterator cend() const noexcept { return m_data + N; }
+
+  constexpr reverse_iterator rbegin() noexcept {
+    return reverse_iterator(end());
+  }
+
+  constexpr const_reverse_iterator rbegin() const noexcept {
+    return const_reverse_iterator(end());
+  }
+
+  constexpr reverse_iterator rend() noexcept {
+    return reverse_iterator(begin());
+  }
+
+  constexpr const_reverse_iterator rend() const noexcept {
+    return const_reverse_iterator(begin());
+  }
+
+  // 逻辑元素赋值为 value，填充元素置为 T()
+  constexpr void fill(const T& value) {
+    if (!mystl::is_constant_evaluated()) {
+      detail::array_fill(m_data, N, value);
+    } else {
+      for (size_type i = 0; i < N; ++i) {
+        m_data[i] = value;
+      }
+    }
+    clear_padding();
+  }
+
+  constexpr void clear_padding() {
+    for (size_type i = N; i < kPaddedSize; ++i) {
+      m_data[i] = T();
+    }
+  }
+
+  constexpr void swap(aligned_array& other) noexcept(
+      std::is_nothrow_swappable<T>::value) {
+    if (!mystl::is_constant_evaluated()) {
+      detail::array_swap(m_data, other.m_data, kPaddedSize);
+      return;
+    }
+    for (size_type i = 0; i < kPaddedSize; ++i) {
+      T tmp = std::move(m_data[i]);
+      m_data[i] = std::move(other.m_data[i]);
+      other.m_data[i] = std::move(tmp);
+    }
+  }
+
+#if defined(__GNUC__)
+  // 读取第 block 块向量，即元素 [block * lanes, (block + 1) * lanes)
+  vector_type load(size_type block) const noexcept {
+    return *reinterpret_cast<const vector_type*>(m_data + block * lanes);
+  }
+
+  void store(size_type block, const vector_type& v) noexcept {
+    *reinterpret_cast<vector_type*>(m_data + block * lanes) = v;
+  }
+#endif
+};
+
+// 只比较前 N 个逻辑元素
+template <class T, std::size_t N, std::size_t Align>
+constexpr bool operator==(const mystl::aligned_array<T, N, Align>& lhs,
+                          const mystl::aligned_array<T, N, Align>& rhs) {
+  if (!mystl::is_constant_evaluated()) {
+    return detail::array_equal(lhs.data(), rhs.data(), N);
+  }
+  for (std::size_t i = 0; i < N; ++i) {
+    if (!(lhs[i] == rhs[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <class T, std::size_t N, std::size_t Align>
+constexpr bool operator!=(const mystl::aligned_array<T, N, Align>& lhs,
+                          const mystl::aligned_array<T, N, Align>& rhs) {
+  return !(lhs == rhs);
+}
+}  // namespace mystl
+
+namespace std {
+template <class T, std::size_t N, std::size_t Align>
+constexpr void swap(mystl::aligned_array<T, N, Align>& lhs,
+                    mystl::aligned_array<T, N, Align>& rhs) noexcept(
+    noexcept(lhs.swap(rhs))) {
+  lhs.swap(rhs);
+}
+}  // namespace std
+
+#endif  // __MYSTL_ALIGNED_ARRAY_H__
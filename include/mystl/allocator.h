@@ -164,22 +164,22 @@ struct allocator {
   }
 
   template <class U>
-  void destory(U* p) {
+  void destroy(U* p) {
     p->~U();
   }
-
-  template <class T1, class T2>
-  friend bool operator==(const allocator<T1>& lhs,
-                         const allocator<T2>& rhs) noexcept {
-    return true;
-  }
-
-  template <class T1, class T2>
-  friend bool operator!=(const allocator<T1>& lhs,
-                         const allocator<T2>& rhs) noexcept {
-    return false;
-  }
 };
+
+// 默认分配器无状态，任意两个实例都相等
+// 注意不能写成类内的 friend 模板，否则每实例化一个 allocator<T> 就会重复定义一次
+template <class T1, class T2>
+bool operator==(const allocator<T1>&, const allocator<T2>&) noexcept {
+  return true;
+}
+
+template <class T1, class T2>
+bool operator!=(const allocator<T1>&, const allocator<T2>&) noexcept {
+  return false;
+}
 }  // namespace mystl
 
 #endif  // __MYSTL_ALLOCATOR_H__
\ No newline at end of file
@@ -1,10 +1,274 @@
 #ifndef __MYSTL_ARRAY_H__
 #define __MYSTL_ARRAY_H__
 
+#include <algorithm>
 #include <array>
+#include <cstddef>
+#include <cstring>
+#include <functional>  // for std::less
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
 #include <utility>
+#include "mystl/sorting_network.h"
+#include "mystl/type_traits.h"
+#include "mystl/utility.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
 
 namespace mystl {
+namespace detail {
+/*
+ * array 的 fill / swap / 比较在元素是算术类型时走专门的路径：
+ *   - fill 用 memset 或广播向量写入，swap 直接在向量寄存器中交换
+ *   - 整数：相等比较用 memcmp；无符号单字节类型的字典序也用 memcmp，
+ *     更宽的整数逐 16/32 字节 cmpeq + movemask 找到第一个不同的字节，
+ *     再比较它所在的那个元素
+ *   - float / double：相等比较用 cmpeq_ps/pd（NaN 与 ±0 的语义和 == 一致）；
+ *     字典序仍然逐元素比较，因为 NaN 既不小于也不大于任何值
+ * 其余类型保持原来的 std::fill_n / std::swap_ranges / std::equal 实现。
+ * 这些函数都不是 constexpr 的，array 的成员和运算符在常量求值时改走逐元素循环。
+ */
+#if defined(__AVX2__)
+constexpr std::size_t kArrayVecBytes = 32;
+#elif defined(__SSE2__)
+constexpr std::size_t kArrayVecBytes = 16;
+#else
+constexpr std::size_t kArrayVecBytes = 0;
+#endif
+
+// 按位比较与按值比较等价的类型：整数（含 bool、字符）和 std::byte
+template <class T>
+struct array_bitwise_comparable
+    : std::integral_constant<bool, std::is_integral<T>::value ||
+                                       std::is_same<T, std::byte>::value> {};
+
+// memcmp 的字典序与 operator< 一致的类型
+template <class T>
+struct array_memcmp_orderable
+    : std::integral_constant<bool, sizeof(T) == 1 &&
+                                       (std::is_unsigned<T>::value ||
+                                        std::is_same<T, std::byte>::value)> {};
+
+template <class T>
+void array_fill(T* p, std::size_t n, const T& value) {
+  if constexpr (sizeof(T) == 1 && std::is_arithmetic<T>::value) {
+    unsigned char byte;
+    std::memcpy(&byte, &value, 1);
+    std::memset(p, byte, n);
+  } else if constexpr (kArrayVecBytes != 0 && std::is_arithmetic<T>::value &&
+                       sizeof(T) <= 8) {
+#if defined(__SSE2__)
+    constexpr std::size_t kLanes = kArrayVecBytes / sizeof(T);
+    alignas(kArrayVecBytes) T pattern[kLanes];
+    for (std::size_t i = 0; i < kLanes; ++i) {
+      pattern[i] = value;
+    }
+    const std::size_t body = n - n % kLanes;
+#if defined(__AVX2__)
+    const __m256i v = _mm256_load_si256(reinterpret_cast<const __m256i*>(pattern));
+    for (std::size_t i = 0; i < body; i += kLanes) {
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(p + i), v);
+    }
+#else
+    const __m128i v = _mm_load_si128(reinterpret_cast<const __m128i*>(pattern));
+    for (std::size_t i = 0; i < body; i += kLanes) {
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(p + i), v);
+    }
+#endif
+    for (std::size_t i = body; i < n; ++i) {
+      p[i] = value;
+    }
+#endif
+  } else {
+    std::fill_n(p, n, value);
+  }
+}
+
+template <class T>
+void array_swap(T* a, T* b, std::size_t n) {
+  if constexpr (kArrayVecBytes != 0 && (std::is_arithmetic<T>::value ||
+                                        std::is_pointer<T>::value)) {
+#if defined(__SSE2__)
+    // 两边各读一个向量再交叉写回，不经过中间缓冲区
+    unsigned char* pa = reinterpret_cast<unsigned char*>(a);
+    unsigned char* pb = reinterpret_cast<unsigned char*>(b);
+    constexpr std::size_t kLanes = 16 / sizeof(T);
+    const std::size_t body = n - n % kLanes;
+    const std::size_t bytes = body * sizeof(T);
+    std::size_t i = 0;
+#if defined(__AVX2__)
+    for (; i + 32 <= bytes; i += 32) {
+      const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pa + i));
+      const __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pb + i));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(pa + i), y);
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(pb + i), x);
+    }
+#endif
+    for (; i < bytes; i += 16) {
+      const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pa + i));
+      const __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pb + i));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(pa + i), y);
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(pb + i), x);
+    }
+    for (std::size_t k = body; k < n; ++k) {
+      T tmp = a[k];
+      a[k] = b[k];
+      b[k] = tmp;
+    }
+#endif
+  } else {
+    std::swap_ranges(a, a + n, b);
+  }
+}
+
+// 返回第一个不同字节的偏移，全部相同时返回 n
+inline std::size_t array_mismatch_bytes(const unsigned char* a,
+                                        const unsigned char* b,
+                                        std::size_t n) {
+  std::size_t i = 0;
+#if defined(__AVX2__)
+  for (; i + 32 <= n; i += 32) {
+    const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+    const __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+    const unsigned mask = ~unsigned(_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, y)));
+    if (mask != 0) {
+      return i + unsigned(__builtin_ctz(mask));
+    }
+  }
+#endif
+#if defined(__SSE2__)
+  for (; i + 16 <= n; i += 16) {
+    const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+    const __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+    const unsigned mask =
+        ~unsigned(_mm_movemask_epi8(_mm_cmpeq_epi8(x, y))) & 0xFFFFu;
+    if (mask != 0) {
+      return i + unsigned(__builtin_ctz(mask));
+    }
+  }
+#endif
+  for (; i < n; ++i) {
+    if (a[i] != b[i]) {
+      return i;
+    }
+  }
+  return n;
+}
+
+template <class T>
+bool array_float_equal(const T* a, const T* b, std::size_t n) {
+  std::size_t i = 0;
+#if defined(__AVX2__)
+  if constexpr (std::is_same<T, float>::value) {
+    for (; i + 8 <= n; i += 8) {
+      const __m256 eq = _mm256_cmp_ps(_mm256_loadu_ps(a + i),
+                                      _mm256_loadu_ps(b + i), _CMP_EQ_OQ);
+      if (_mm256_movemask_ps(eq) != 0xFF) {
+        return false;
+      }
+    }
+  } else {
+    for (; i + 4 <= n; i += 4) {
+      const __m256d eq = _mm256_cmp_pd(_mm256_loadu_pd(a + i),
+                                       _mm256_loadu_pd(b + i), _CMP_EQ_OQ);
+      if (_mm256_movemask_pd(eq) != 0xF) {
+        return false;
+      }
+    }
+  }
+#elif defined(__SSE2__)
+  if constexpr (std::is_same<T, float>::value) {
+    for (; i + 4 <= n; i += 4) {
+      const __m128 eq = _mm_cmpeq_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i));
+      if (_mm_movemask_ps(eq) != 0xF) {
+        return false;
+      }
+    }
+  } else {
+    for (; i + 2 <= n; i += 2) {
+      const __m128d eq = _mm_cmpeq_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i));
+      if (_mm_movemask_pd(eq) != 0x3) {
+        return false;
+      }
+    }
+  }
+#endif
+  for (; i < n; ++i) {
+    if (!(a[i] == b[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <class T>
+bool array_equal(const T* a, const T* b, std::size_t n) {
+  if constexpr (array_bitwise_comparable<T>::value) {
+    return std::memcmp(a, b, n * sizeof(T)) == 0;
+  } else if constexpr (std::is_same<T, float>::value ||
+                       std::is_same<T, double>::value) {
+    return array_float_equal(a, b, n);
+  } else {
+    return std::equal(a, a + n, b);
+  }
+}
+
+template <class T>
+bool array_less(const T* a, const T* b, std::size_t n) {
+  if constexpr (array_memcmp_orderable<T>::value) {
+    return std::memcmp(a, b, n) < 0;
+  } else if constexpr (array_bitwise_comparable<T>::value) {
+    // 找到第一个不同的字节，它所在的元素决定大小关系
+    const std::size_t k =
+        array_mismatch_bytes(reinterpret_cast<const unsigned char*>(a),
+                             reinterpret_cast<const unsigned char*>(b),
+                             n * sizeof(T)) /
+        sizeof(T);
+    return k != n && a[k] < b[k];
+  } else {
+    return std::lexicographical_compare(a, a + n, b, b + n);
+  }
+}
+
+// 常量求值时使用的堆排序：不递归，比较次数 O(n log n)
+template <class T, class Compare>
+constexpr void array_sift_down(T* p, std::size_t root, std::size_t n,
+                               Compare& comp) {
+  T value = std::move(p[root]);
+  std::size_t hole = root;
+  for (std::size_t child = 2 * hole + 1; child < n; child = 2 * hole + 1) {
+    if (child + 1 < n && comp(p[child], p[child + 1])) {
+      ++child;
+    }
+    if (!comp(value, p[child])) {
+      break;
+    }
+    p[hole] = std::move(p[child]);
+    hole = child;
+  }
+  p[hole] = std::move(value);
+}
+
+template <class T, class Compare>
+constexpr void array_heap_sort(T* p, std::size_t n, Compare& comp) {
+  for (std::size_t i = n / 2; i > 0; --i) {
+    array_sift_down(p, i - 1, n, comp);
+  }
+  for (std::size_t end = n; end > 1; --end) {
+    T tmp = std::move(p[0]);
+    p[0] = std::move(p[end - 1]);
+    p[end - 1] = std::move(tmp);
+    array_sift_down(p, 0, end - 1, comp);
+  }
+}
+}  // namespace detail
+
 template <class T, std::size_t N>
 struct array {
   T m_data[N];
@@ -101,44 +365,256 @@ struct array {
     return const_reverse_iterator(begin());
   }
 
-  void fill(const T& value) { std::fill_n(begin(), size(), value); }
+  constexpr void fill(const T& value) {
+    if (!mystl::is_constant_evaluated()) {
+      detail::array_fill(m_data, N, value);
+      return;
+    }
+    for (size_type i = 0; i < N; ++i) {
+      m_data[i] = value;
+    }
+  }
 
-  void swap(array& other) noexcept(std::is_nothrow_swappable<T>::value) {
-    std::swap_ranges(begin(), end(), other.begin());
+  constexpr void swap(array& other) noexcept(
+      std::is_nothrow_swappable<T>::value) {
+    if (!mystl::is_constant_evaluated()) {
+      detail::array_swap(m_data, other.m_data, N);
+      return;
+    }
+    // C++17 的 std::swap 不是 constexpr
+    for (size_type i = 0; i < N; ++i) {
+      T tmp = std::move(m_data[i]);
+      m_data[i] = std::move(other.m_data[i]);
+      other.m_data[i] = std::move(tmp);
+    }
   }
 };
 
 template <class T, std::size_t N>
-bool operator==(const mystl::array<T, N>& lhs, const mystl::array<T, N>& rhs) {
-  return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+constexpr bool operator==(const mystl::array<T, N>& lhs,
+                          const mystl::array<T, N>& rhs) {
+  if (!mystl::is_constant_evaluated()) {
+    return detail::array_equal(lhs.data(), rhs.data(), N);
+  }
+  for (std::size_t i = 0; i < N; ++i) {
+    if (!(lhs[i] == rhs[i])) {
+      return false;
+    }
+  }
+  return true;
 }
 
 template <class T, std::size_t N>
-bool operator!=(const mystl::array<T, N>& lhs, const mystl::array<T, N>& rhs) {
+constexpr bool operator!=(const mystl::array<T, N>& lhs,
+                          const mystl::array<T, N>& rhs) {
   return !(lhs == rhs);
 }
 
 template <class T, std::size_t N>
-bool operator<(const mystl::array<T, N>& lhs, const mystl::array<T, N>& rhs) {
-  return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(),
-                                      rhs.end());
+constexpr bool operator<(const mystl::array<T, N>& lhs,
+                         const mystl::array<T, N>& rhs) {
+  if (!mystl::is_constant_evaluated()) {
+    return detail::array_less(lhs.data(), rhs.data(), N);
+  }
+  for (std::size_t i = 0; i < N; ++i) {
+    if (lhs[i] < rhs[i]) {
+      return true;
+    }
+    if (rhs[i] < lhs[i]) {
+      return false;
+    }
+  }
+  return false;
 }
 
 template <class T, std::size_t N>
-bool operator>(const mystl::array<T, N>& lhs, const mystl::array<T, N>& rhs) {
+constexpr bool operator>(const mystl::array<T, N>& lhs,
+                         const mystl::array<T, N>& rhs) {
   return rhs < lhs;
 }
 
 template <class T, std::size_t N>
-bool operator<=(const mystl::array<T, N>& lhs, const mystl::array<T, N>& rhs) {
+constexpr bool operator<=(const mystl::array<T, N>& lhs,
+                          const mystl::array<T, N>& rhs) {
   return !(rhs < lhs);
 }
 
 template <class T, std::size_t N>
-bool operator>=(const mystl::array<T, N>& lhs, const mystl::array<T, N>& rhs) {
+constexpr bool operator>=(const mystl::array<T, N>& lhs,
+                          const mystl::array<T, N>& rhs) {
   return !(lhs < rhs);
 }
 
+/*
+ * constexpr 算法：可以在编译期生成查找表，结果直接放进 .rodata
+ *
+ *   constexpr auto kSquares = mystl::transform(
+ *       mystl::iota<unsigned, 256>(0), [](unsigned i) { return i * i; });
+ */
+
+// 依次填入 value, value + 1, ...
+template <class T, std::size_t N>
+constexpr void iota(mystl::array<T, N>& arr, T value) {
+  for (std::size_t i = 0; i < N; ++i) {
+    arr[i] = value;
+    ++value;
+  }
+}
+
+template <class T, std::size_t N>
+constexpr mystl::array<T, N> iota(T value) {
+  mystl::array<T, N> arr{};
+  mystl::iota(arr, value);
+  return arr;
+}
+
+// 对每个元素调用 op，返回由结果组成的新 array
+template <class T, std::size_t N, class UnaryOp>
+constexpr auto transform(const mystl::array<T, N>& arr, UnaryOp op)
+    -> mystl::array<typename std::decay<decltype(op(arr[0]))>::type, N> {
+  mystl::array<typename std::decay<decltype(op(arr[0]))>::type, N> out{};
+  for (std::size_t i = 0; i < N; ++i) {
+    out[i] = op(arr[i]);
+  }
+  return out;
+}
+
+/*
+ * N <= kSortingNetworkMaxSize 时使用编译期生成的排序网络（见 sorting_network.h）；
+ * 更长的数组运行时使用 std::sort，常量求值时使用堆排序
+ */
+template <class T, std::size_t N, class Compare>
+constexpr void sort(mystl::array<T, N>& arr, Compare comp) {
+  if constexpr (N <= kSortingNetworkMaxSize) {
+    mystl::network_sort<N>(arr.data(), comp);
+  } else {
+    if (!mystl::is_constant_evaluated()) {
+      std::sort(arr.begin(), arr.end(), comp);
+      return;
+    }
+    detail::array_heap_sort(arr.data(), N, comp);
+  }
+}
+
+template <class T, std::size_t N>
+constexpr void sort(mystl::array<T, N>& arr) {
+  mystl::sort(arr, std::less<T>());
+}
+
+// 与 std::nth_element 语义相同：arr[k] 是排序后的第 k 个元素，
+// 它前面的元素都不大于它，后面的元素都不小于它
+template <class T, std::size_t N, class Compare>
+constexpr void nth_element(mystl::array<T, N>& arr, std::size_t k,
+                           Compare comp) {
+  if constexpr (N <= kSortingNetworkMaxSize) {
+    // 小数组上完整的网络比依赖数据的划分更快
+    (void)k;
+    mystl::network_sort<N>(arr.data(), comp);
+  } else {
+    if (!mystl::is_constant_evaluated()) {
+      if (k < N) {
+        std::nth_element(arr.begin(), arr.begin() + k, arr.end(), comp);
+      }
+      return;
+    }
+    detail::array_heap_sort(arr.data(), N, comp);
+  }
+}
+
+template <class T, std::size_t N>
+constexpr void nth_element(mystl::array<T, N>& arr, std::size_t k) {
+  mystl::nth_element(arr, k, std::less<T>());
+}
+
+// 排序后第 K 个元素的值；N <= kSortingNetworkMaxSize 时使用裁剪后的选择网络
+template <std::size_t K, class T, std::size_t N, class Compare>
+constexpr T select(mystl::array<T, N> arr, Compare comp) {
+  static_assert(K < N, "select index out of range");
+  if constexpr (N <= kSortingNetworkMaxSize) {
+    mystl::network_select<N, K>(arr.data(), comp);
+  } else {
+    mystl::nth_element(arr, K, comp);
+  }
+  return arr[K];
+}
+
+template <std::size_t K, class T, std::size_t N>
+constexpr T select(const mystl::array<T, N>& arr) {
+  return mystl::select<K>(arr, std::less<T>());
+}
+
+// 中位数；N 为偶数时返回较小的那个（下中位数）
+template <class T, std::size_t N, class Compare>
+constexpr T median(const mystl::array<T, N>& arr, Compare comp) {
+  return mystl::select<(N - 1) / 2>(arr, comp);
+}
+
+template <class T, std::size_t N>
+constexpr T median(const mystl::array<T, N>& arr) {
+  return mystl::median(arr, std::less<T>());
+}
+
+/*
+ * min / max / minmax：两两归约成一棵平衡树，依赖链长度是 log N，
+ * 算术类型的每一步都是无分支的 min/max。相等的元素返回最靠前的那个。
+ */
+namespace detail {
+template <class T, class Compare>
+constexpr const T& array_select_min(const T& a, const T& b, Compare& comp) {
+  return comp(b, a) ? b : a;
+}
+
+template <class T, class Compare>
+constexpr const T& array_select_max(const T& a, const T& b, Compare& comp) {
+  return comp(a, b) ? b : a;
+}
+
+// 对 [first, first + n) 做二叉树归约
+template <bool Min, class T, class Compare>
+constexpr const T& array_reduce(const T* first, std::size_t n, Compare& comp) {
+  if (n == 1) {
+    return first[0];
+  }
+  const std::size_t half = n / 2;
+  const T& a = array_reduce<Min>(first, half, comp);
+  const T& b = array_reduce<Min>(first + half, n - half, comp);
+  return Min ? array_select_min(a, b, comp) : array_select_max(a, b, comp);
+}
+}  // namespace detail
+
+template <class T, std::size_t N, class Compare>
+constexpr const T& min(const mystl::array<T, N>& arr, Compare comp) {
+  static_assert(N > 0, "min of an empty array");
+  return detail::array_reduce<true>(arr.data(), N, comp);
+}
+
+template <class T, std::size_t N>
+constexpr const T& min(const mystl::array<T, N>& arr) {
+  return mystl::min(arr, std::less<T>());
+}
+
+template <class T, std::size_t N, class Compare>
+constexpr const T& max(const mystl::array<T, N>& arr, Compare comp) {
+  static_assert(N > 0, "max of an empty array");
+  return detail::array_reduce<false>(arr.data(), N, comp);
+}
+
+template <class T, std::size_t N>
+constexpr const T& max(const mystl::array<T, N>& arr) {
+  return mystl::max(arr, std::less<T>());
+}
+
+template <class T, std::size_t N, class Compare>
+constexpr mystl::pair<T, T> minmax(const mystl::array<T, N>& arr,
+                                   Compare comp) {
+  return mystl::pair<T, T>(mystl::min(arr, comp), mystl::max(arr, comp));
+}
+
+template <class T, std::size_t N>
+constexpr mystl::pair<T, T> minmax(const mystl::array<T, N>& arr) {
+  return mystl::minmax(arr, std::less<T>());
+}
+
 // get
 template <std::size_t I, class T, std::size_t N>
 constexpr T& get(mystl::array<T, N>& arr) {
@@ -175,8 +651,8 @@ struct tuple_element<I, mystl::array<T, N>> {
 };
 
 template <class T, std::size_t N>
-void swap(mystl::array<T, N>& lhs,
-          mystl::array<T, N>& rhs) noexcept(noexcept(lhs.swap(rhs))) {
+constexpr void swap(mystl::array<T, N>& lhs,
+                    mystl::array<T, N>& rhs) noexcept(noexcept(lhs.swap(rhs))) {
   lhs.swap(rhs);
 }
 }  // namespace std
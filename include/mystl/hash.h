@@ -0,0 +1,72 @@
+#ifndef __MYSTL_HASH_H__
+#define __MYSTL_HASH_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>  // for std::hash
+#include <type_traits>
+#include <utility>
+#include "mystl/tuple.h"
+#include "mystl/utility.h"
+
+namespace mystl {
+namespace detail {
+/*
+ * std::hash 对整数通常是恒等映射，低位和高位都谈不上均匀。
+ * 哈希表在使用哈希值之前再做一次乘法混合，让每一位都依赖输入的所有位，
+ * 之后取低位作为下标、取高位作为指纹都是均匀的。
+ */
+inline std::size_t hash_mix(std::size_t h) noexcept {
+#if defined(__SIZEOF_INT128__)
+  const __uint128_t m = __uint128_t(h) * 0x9E3779B97F4A7C15ull;
+  return std::size_t(m) ^ std::size_t(m >> 64);
+#else
+  std::uint64_t x = h;
+  x ^= x >> 33;
+  x *= 0xff51afd7ed558ccdull;
+  x ^= x >> 33;
+  return std::size_t(x);
+#endif
+}
+
+// 把一个元素的哈希值并入 seed；seed 每一步都经过混合，所以元素顺序会影响结果
+inline std::size_t hash_combine(std::size_t seed, std::size_t h) noexcept {
+  return hash_mix(seed ^ h);
+}
+}  // namespace detail
+
+// hash<T>: 默认就是 std::hash<T>，另外为 pair 和 tuple 提供特化，可以直接作为哈希表的键
+template <class T>
+struct hash : std::hash<T> {};
+
+template <class T1, class T2>
+struct hash<mystl::pair<T1, T2>> {
+  std::size_t operator()(const mystl::pair<T1, T2>& p) const {
+    std::size_t h = detail::hash_combine(
+        2, mystl::hash<detail::remove_cvref_t<T1>>()(p.first));
+    return detail::hash_combine(
+        h, mystl::hash<detail::remove_cvref_t<T2>>()(p.second));
+  }
+};
+
+template <class... Types>
+struct hash<mystl::tuple<Types...>> {
+  std::size_t operator()(const mystl::tuple<Types...>& t) const {
+    return M_hash(t, std::make_index_sequence<sizeof...(Types)>{});
+  }
+
+ private:
+  // 逗号折叠，按声明顺序依次并入每个元素
+  template <std::size_t... Is>
+  static std::size_t M_hash(const mystl::tuple<Types...>& t,
+                            std::index_sequence<Is...>) {
+    std::size_t h = sizeof...(Types);
+    ((h = detail::hash_combine(
+          h, mystl::hash<detail::remove_cvref_t<Types>>()(mystl::get<Is>(t)))),
+     ...);
+    return h;
+  }
+};
+}  // namespace mystl
+
+#endif  // __MYSTL_HASH_H__
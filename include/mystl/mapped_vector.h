@@ -0,0 +1,379 @@
+#ifndef __MYSTL_MAPPED_VECTOR_H__
+#define __MYSTL_MAPPED_VECTOR_H__
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include "mystl/utility.h"
+
+namespace mystl {
+
+enum class map_mode {
+  read_only,   // 只读打开已有文件，零拷贝加载
+  read_write,  // 读写打开，文件不存在时创建
+  create       // 读写打开，清空已有内容
+};
+
+/*
+ * mapped_vector: 以文件为存储的 vector，元素直接 mmap 到进程地址空间。
+ *
+ * 文件格式就是 size() 个 T 的原始字节，没有任何头部，因此要求 T 是
+ * trivially copyable。打开文件时只建立映射，页面在第一次访问时才由内核读入，
+ * 启动耗时与文件大小无关。
+ *
+ *   file:    | T[0] | T[1] | ... | T[size-1] | <spare capacity> |
+ *            ^                                                   ^
+ *            start                                  start + capacity
+ *
+ * 扩容时先 ftruncate 扩大文件，再 mremap 扩大映射（非 Linux 平台退化为
+ * munmap + mmap），所以扩容后迭代器和指针会失效，这一点与 vector 相同。
+ * 运行期间文件长度等于 capacity()，close() 或析构时把文件截断回 size()。
+ *
+ * read_only 模式的映射不可写，返回可写引用的非 const 访问函数（operator[]、
+ * data()、begin() 等）会抛出 logic_error，只能通过 const 对象读取。
+ */
+template <class T>
+class mapped_vector {
+  static_assert(std::is_trivially_copyable<T>::value,
+                "mapped_vector<T> requires a trivially copyable T");
+
+ public:
+  // member type
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using pointer = value_type*;
+  using const_pointer = const value_type*;
+  using iterator = value_type*;
+  using const_iterator = const value_type*;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+ private:
+  int fd{-1};
+  pointer start{nullptr};
+  size_type count{0};
+  size_type cap{0};
+  map_mode mode{map_mode::read_only};
+
+  [[noreturn]] static void M_throw_errno(const char* what) {
+    throw std::system_error(errno, std::generic_category(), what);
+  }
+
+  void M_check_writable() const {
+    if (mode == map_mode::read_only) {
+      throw std::logic_error("mapped_vector: mapped read-only");
+    }
+  }
+
+  void M_map(size_type n) {
+    const int prot =
+        mode == map_mode::read_only ? PROT_READ : PROT_READ | PROT_WRITE;
+    const int flags = mode == map_mode::read_only ? MAP_PRIVATE : MAP_SHARED;
+    void* p = ::mmap(nullptr, n * sizeof(T), prot, flags, fd, 0);
+    if (p == MAP_FAILED) {
+      M_throw_errno("mapped_vector: mmap");
+    }
+    start = static_cast<pointer>(p);
+  }
+
+  void M_unmap() noexcept {
+    if (start != nullptr) {
+      ::munmap(start, cap * sizeof(T));
+      start = nullptr;
+    }
+  }
+
+  // 把文件和映射都调整为 n 个元素
+  void M_remap(size_type n) {
+    if (::ftruncate(fd, off_t(n * sizeof(T))) != 0) {
+      M_throw_errno("mapped_vector: ftruncate");
+    }
+    if (n == 0) {
+      M_unmap();
+    } else if (start == nullptr) {
+      M_map(n);
+    } else {
+#if defined(__linux__)
+      void* p = ::mremap(start, cap * sizeof(T), n * sizeof(T), MREMAP_MAYMOVE);
+      if (p == MAP_FAILED) {
+        M_throw_errno("mapped_vector: mremap");
+      }
+      start = static_cast<pointer>(p);
+#else
+      M_unmap();
+      M_map(n);
+#endif
+    }
+    cap = n;
+  }
+
+  void M_grow(size_type n) {
+    if (n <= cap) {
+      return;
+    }
+    // 几何增长，保证 push_back 均摊 O(1)
+    size_type new_cap = cap == 0 ? 1 : cap * 2;
+    if (new_cap < n) {
+      new_cap = n;
+    }
+    M_remap(new_cap);
+  }
+
+ public:
+  //===================================================================
+  //======================== constructors =============================
+  //===================================================================
+  mapped_vector() noexcept = default;
+
+  explicit mapped_vector(const std::string& path,
+                         map_mode m = map_mode::read_write) {
+    open(path, m);
+  }
+
+  mapped_vector(const mapped_vector&) = delete;
+  mapped_vector& operator=(const mapped_vector&) = delete;
+
+  mapped_vector(mapped_vector&& other) noexcept
+      : fd(other.fd),
+        start(other.start),
+        count(other.count),
+        cap(other.cap),
+        mode(other.mode) {
+    other.fd = -1;
+    other.start = nullptr;
+    other.count = other.cap = 0;
+  }
+
+  mapped_vector& operator=(mapped_vector&& other) noexcept {
+    if (this != &other) {
+      close();
+      fd = other.fd;
+      start = other.start;
+      count = other.count;
+      cap = other.cap;
+      mode = other.mode;
+      other.fd = -1;
+      other.start = nullptr;
+      other.count = other.cap = 0;
+    }
+    return *this;
+  }
+
+  ~mapped_vector() { close(); }
+
+  //===================================================================
+  //======================== file operations ==========================
+  //===================================================================
+  void open(const std::string& path, map_mode m = map_mode::read_write) {
+    close();
+    mode = m;
+    int flags = O_RDONLY;
+    if (m == map_mode::read_write) {
+      flags = O_RDWR | O_CREAT;
+    } else if (m == map_mode::create) {
+      flags = O_RDWR | O_CREAT | O_TRUNC;
+    }
+    fd = ::open(path.c_str(), flags | O_CLOEXEC, 0644);
+    if (fd < 0) {
+      M_throw_errno("mapped_vector: open");
+    }
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+      int err = errno;
+      ::close(fd);
+      fd = -1;
+      throw std::system_error(err, std::generic_category(),
+                              "mapped_vector: fstat");
+    }
+    const size_type bytes = size_type(st.st_size);
+    if (bytes % sizeof(T) != 0) {
+      ::close(fd);
+      fd = -1;
+      throw std::runtime_error(
+          "mapped_vector: file size is not a multiple of sizeof(T)");
+    }
+    count = cap = bytes / sizeof(T);
+    if (cap != 0) {
+      try {
+        M_map(cap);
+      } catch (...) {
+        ::close(fd);
+        fd = -1;
+        count = cap = 0;
+        throw;
+      }
+    }
+  }
+
+  // 把文件截断为 size() 并关闭，之后对象回到未打开状态
+  void close() noexcept {
+    if (fd < 0) {
+      return;
+    }
+    M_unmap();
+    if (mode != map_mode::read_only && cap != count) {
+      (void)::ftruncate(fd, off_t(count * sizeof(T)));
+    }
+    ::close(fd);
+    fd = -1;
+    count = cap = 0;
+  }
+
+  bool is_open() const noexcept { return fd >= 0; }
+
+  // 同步写回：返回时数据已经落盘
+  void sync() {
+    if (start != nullptr && mode != map_mode::read_only &&
+        ::msync(start, cap * sizeof(T), MS_SYNC) != 0) {
+      M_throw_errno("mapped_vector: msync");
+    }
+  }
+
+  // 异步写回：只发起写回，不等待完成
+  void flush_async() {
+    if (start != nullptr && mode != map_mode::read_only &&
+        ::msync(start, cap * sizeof(T), MS_ASYNC) != 0) {
+      M_throw_errno("mapped_vector: msync");
+    }
+  }
+
+  //===================================================================
+  //======================= elements access ===========================
+  //===================================================================
+  reference at(size_type pos) {
+    M_check_writable();
+    if (pos >= this->size()) {
+      throw std::out_of_range("at: pos is out of range!");
+    }
+    return *(start + pos);
+  }
+  const_reference at(size_type pos) const {
+    if (pos >= this->size()) {
+      throw std::out_of_range("at: pos is out of range!");
+    }
+    return *(start + pos);
+  }
+
+  reference operator[](size_type pos) {
+    M_check_writable();
+    return *(start + pos);
+  }
+  const_reference operator[](size_type pos) const { return *(start + pos); }
+
+  reference front() {
+    M_check_writable();
+    return *start;
+  }
+  const_reference front() const { return *start; }
+
+  reference back() {
+    M_check_writable();
+    return *(start + count - 1);
+  }
+  const_reference back() const { return *(start + count - 1); }
+
+  T* data() {
+    M_check_writable();
+    return start;
+  }
+  const T* data() const noexcept { return start; }
+
+  //===================================================================
+  //=========================== iterators =============================
+  //===================================================================
+  iterator begin() {
+    M_check_writable();
+    return start;
+  }
+  const_iterator begin() const noexcept { return start; }
+  const_iterator cbegin() const noexcept { return start; }
+
+  iterator end() {
+    M_check_writable();
+    return start + count;
+  }
+  const_iterator end() const noexcept { return start + count; }
+  const_iterator cend() const noexcept { return start + count; }
+
+  reverse_iterator rbegin() { return reverse_iterator(end()); }
+  const_reverse_iterator rbegin() const noexcept {
+    return const_reverse_iterator(end());
+  }
+
+  reverse_iterator rend() { return reverse_iterator(begin()); }
+  const_reverse_iterator rend() const noexcept {
+    return const_reverse_iterator(begin());
+  }
+
+  //===================================================================
+  //=========================== capacity ==============================
+  //===================================================================
+  bool empty() const noexcept { return count == 0; }
+
+  size_type size() const noexcept { return count; }
+
+  size_type capacity() const noexcept { return cap; }
+
+  void reserve(size_type n) {
+    M_check_writable();
+    if (n > cap) {
+      M_remap(n);
+    }
+  }
+
+  void shrink_to_fit() {
+    M_check_writable();
+    if (cap != count) {
+      M_remap(count);
+    }
+  }
+
+  //===================================================================
+  //=========================== modifiers =============================
+  //===================================================================
+  void push_back(const T& value) {
+    M_check_writable();
+    if (count == cap) {
+      // value 可能就在映射区里，扩容前先拷贝一份
+      T tmp = value;
+      M_grow(count + 1);
+      start[count++] = tmp;
+    } else {
+      start[count++] = value;
+    }
+  }
+
+  void pop_back() {
+    M_check_writable();
+    --count;
+  }
+
+  // 新增的元素值初始化
+  void resize(size_type n) {
+    M_check_writable();
+    M_grow(n);
+    for (size_type i = count; i < n; ++i) {
+      start[i] = T();
+    }
+    count = n;
+  }
+
+  void clear() {
+    M_check_writable();
+    count = 0;
+  }
+};
+}  // namespace mystl
+
+#endif  // __MYSTL_MAPPED_VECTOR_H__
@@ -0,0 +1,347 @@
+#ifndef __MYSTL_MDSPAN_H__
+#define __MYSTL_MDSPAN_H__
+
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "mystl/array.h"
+#include "mystl/vector.h"
+
+namespace mystl {
+/*
+ * 多维数组视图 mdspan 与拥有存储的 mdarray，所有维度的大小都在编译期确定。
+ *
+ *   mystl::mdarray<float, mystl::extents<64, 64>> a;                 // 行主序
+ *   mystl::mdarray<float, mystl::extents<64, 64>, mystl::layout_tiled<8, 8>> t;
+ *   mystl::mdspan<float, mystl::extents<64, 64>, mystl::layout_left> v(vec);
+ *   a(i, j) = t(j, i);
+ *
+ * 布局（layout）是可替换的策略，layout::mapping<Extents> 负责把多维下标映射成
+ * 一维偏移。由于维度都是编译期常量，各维的步长也都是编译期常量，
+ * 偏移计算在编译期就折叠成常数乘加（分块布局中的除法和取模也都是常数，
+ * 分块大小为 2 的幂时会变成移位和按位与）。
+ */
+
+// extents: 每一维的大小
+template <std::size_t... Es>
+struct extents {
+  static_assert(sizeof...(Es) > 0, "extents must have at least one dimension");
+
+  using index_type = std::size_t;
+
+  static constexpr std::size_t rank() noexcept { return sizeof...(Es); }
+
+  static constexpr std::size_t extent(std::size_t r) noexcept {
+    constexpr std::size_t kExtents[] = {Es...};
+    return kExtents[r];
+  }
+
+  // 元素总数
+  static constexpr std::size_t size() noexcept { return (Es * ... * 1); }
+};
+
+namespace detail {
+// 按编译期步长计算偏移：sum(i_r * stride(r))
+template <class Mapping, std::size_t... Rs, class... Indices>
+constexpr std::size_t strided_offset(std::index_sequence<Rs...>,
+                                     Indices... is) noexcept {
+  return ((std::size_t(is) *
+           std::integral_constant<std::size_t, Mapping::stride(Rs)>::value) +
+          ... + 0);
+}
+}  // namespace detail
+
+// layout_right: 行主序（C 风格），最后一维连续
+struct layout_right {
+  template <class Extents>
+  struct mapping {
+    using extents_type = Extents;
+
+    static constexpr std::size_t stride(std::size_t r) noexcept {
+      std::size_t s = 1;
+      for (std::size_t k = r + 1; k < Extents::rank(); ++k) {
+        s *= Extents::extent(k);
+      }
+      return s;
+    }
+
+    static constexpr std::size_t required_span_size() noexcept {
+      return Extents::size();
+    }
+
+    template <class... Indices>
+    constexpr std::size_t operator()(Indices... is) const noexcept {
+      static_assert(sizeof...(Indices) == Extents::rank(),
+                    "number of indices must equal rank");
+      return detail::strided_offset<mapping>(
+          std::make_index_sequence<Extents::rank()>(), is...);
+    }
+  };
+};
+
+// layout_left: 列主序（Fortran 风格），第一维连续
+struct layout_left {
+  template <class Extents>
+  struct mapping {
+    using extents_type = Extents;
+
+    static constexpr std::size_t stride(std::size_t r) noexcept {
+      std::size_t s = 1;
+      for (std::size_t k = 0; k < r; ++k) {
+        s *= Extents::extent(k);
+      }
+      return s;
+    }
+
+    static constexpr std::size_t required_span_size() noexcept {
+      return Extents::size();
+    }
+
+    template <class... Indices>
+    constexpr std::size_t operator()(Indices... is) const noexcept {
+      static_assert(sizeof...(Indices) == Extents::rank(),
+                    "number of indices must equal rank");
+      return detail::strided_offset<mapping>(
+          std::make_index_sequence<Extents::rank()>(), is...);
+    }
+  };
+};
+
+// layout_stride<S...>: 每一维指定步长，例如隔行访问或者在更大的矩阵中取子块
+template <std::size_t... Strides>
+struct layout_stride {
+  template <class Extents>
+  struct mapping {
+    static_assert(sizeof...(Strides) == Extents::rank(),
+                  "layout_stride needs one stride per dimension");
+
+    using extents_type = Extents;
+
+    static constexpr std::size_t stride(std::size_t r) noexcept {
+      constexpr std::size_t kStrides[] = {Strides...};
+      return kStrides[r];
+    }
+
+    // 最大下标对应的偏移 + 1
+    static constexpr std::size_t required_span_size() noexcept {
+      std::size_t last = 0;
+      for (std::size_t r = 0; r < Extents::rank(); ++r) {
+        if (Extents::extent(r) == 0) {
+          return 0;
+        }
+        last += (Extents::extent(r) - 1) * stride(r);
+      }
+      return last + 1;
+    }
+
+    template <class... Indices>
+    constexpr std::size_t operator()(Indices... is) const noexcept {
+      static_assert(sizeof...(Indices) == Extents::rank(),
+                    "number of indices must equal rank");
+      return detail::strided_offset<mapping>(
+          std::make_index_sequence<Extents::rank()>(), is...);
+    }
+  };
+};
+
+/*
+ * layout_tiled<TR, TC>: 二维分块布局
+ * 矩阵被切成 TR x TC 的小块，块与块之间按行主序排列，块内部也按行主序排列，
+ * 一个块在内存中是连续的。对 8x8 的 float 块来说一块正好是 4 条缓存行，
+ * 按块遍历的模板计算（stencil）和转置只会访问少量缓存行。
+ * 维度不是分块大小的整数倍时，最右/最下的块会被填充到完整大小。
+ */
+template <std::size_t TileRows, std::size_t TileCols>
+struct layout_tiled {
+  static_assert(TileRows > 0 && TileCols > 0, "tile size must be positive");
+
+  static constexpr std::size_t tile_rows = TileRows;
+  static constexpr std::size_t tile_cols = TileCols;
+
+  template <class Extents>
+  struct mapping {
+    static_assert(Extents::rank() == 2, "layout_tiled only supports rank 2");
+
+    using extents_type = Extents;
+
+    static constexpr std::size_t kTilesPerRow =
+        (Extents::extent(1) + TileCols - 1) / TileCols;
+    static constexpr std::size_t kTilesPerCol =
+        (Extents::extent(0) + TileRows - 1) / TileRows;
+    static constexpr std::size_t kTileSize = TileRows * TileCols;
+
+    static constexpr std::size_t required_span_size() noexcept {
+      return kTilesPerRow * kTilesPerCol * kTileSize;
+    }
+
+    template <class I, class J>
+    constexpr std::size_t operator()(I i, J j) const noexcept {
+      const std::size_t r = std::size_t(i);
+      const std::size_t c = std::size_t(j);
+      return (r / TileRows * kTilesPerRow + c / TileCols) * kTileSize +
+             r % TileRows * TileCols + c % TileCols;
+    }
+  };
+};
+
+// mdspan: 不拥有数据的多维视图
+template <class T, class Extents, class Layout = layout_right>
+class mdspan {
+ public:
+  // member type
+  using extents_type = Extents;
+  using layout_type = Layout;
+  using mapping_type = typename Layout::template mapping<Extents>;
+  using element_type = T;
+  using value_type = typename std::remove_cv<T>::type;
+  using index_type = std::size_t;
+  using size_type = std::size_t;
+  using pointer = T*;
+  using reference = T&;
+
+ private:
+  pointer ptr{nullptr};
+
+  template <class... Indices>
+  static constexpr bool M_in_bounds(Indices... is) noexcept {
+    std::size_t r = 0;
+    return ((std::size_t(is) < Extents::extent(r++)) && ...);
+  }
+
+ public:
+  constexpr mdspan() noexcept = default;
+
+  // p 指向至少 required_span_size() 个元素
+  constexpr explicit mdspan(pointer p) noexcept : ptr(p) {}
+
+  // 以 vector 的数据作为底层存储，vector 的长度不能小于 required_span_size()
+  template <class Alloc>
+  explicit mdspan(mystl::vector<value_type, Alloc>& v) : ptr(v.data()) {
+    M_check_size(v.size());
+  }
+
+  template <class Alloc, class U = T,
+            typename = typename std::enable_if<std::is_const<U>::value>::type>
+  explicit mdspan(const mystl::vector<value_type, Alloc>& v) : ptr(v.data()) {
+    M_check_size(v.size());
+  }
+
+  // mdspan<T> 可以隐式转换为 mdspan<const T>
+  template <class U, typename = typename std::enable_if<
+                         std::is_convertible<U (*)[], T (*)[]>::value>::type>
+  constexpr mdspan(const mdspan<U, Extents, Layout>& other) noexcept
+      : ptr(other.data()) {}
+
+  static constexpr std::size_t rank() noexcept { return Extents::rank(); }
+
+  static constexpr std::size_t extent(std::size_t r) noexcept {
+    return Extents::extent(r);
+  }
+
+  // 逻辑上的元素个数
+  static constexpr size_type size() noexcept { return Extents::size(); }
+
+  // 底层存储需要的元素个数（分块布局会有填充，带步长的布局会有空洞）
+  static constexpr size_type required_span_size() noexcept {
+    return mapping_type::required_span_size();
+  }
+
+  static constexpr std::size_t stride(std::size_t r) noexcept {
+    return mapping_type::stride(r);
+  }
+
+  static constexpr mapping_type mapping() noexcept { return mapping_type(); }
+
+  constexpr pointer data() const noexcept { return ptr; }
+
+  template <class... Indices>
+  constexpr reference operator()(Indices... is) const noexcept {
+    return ptr[mapping_type()(is...)];
+  }
+
+  template <class... Indices>
+  constexpr reference at(Indices... is) const {
+    static_assert(sizeof...(Indices) == Extents::rank(),
+                  "number of indices must equal rank");
+    if (!M_in_bounds(is...)) {
+      throw std::out_of_range("mystl::mdspan::at");
+    }
+    return ptr[mapping_type()(is...)];
+  }
+
+ private:
+  void M_check_size(std::size_t n) const {
+    if (n < required_span_size()) {
+      throw std::length_error("mystl::mdspan: vector is too small");
+    }
+  }
+};
+
+// mdarray: 以 mystl::array 为存储、拥有数据的多维数组
+template <class T, class Extents, class Layout = layout_right>
+struct mdarray {
+  // member type
+  using extents_type = Extents;
+  using layout_type = Layout;
+  using mapping_type = typename Layout::template mapping<Extents>;
+  using value_type = T;
+  using index_type = std::size_t;
+  using size_type = std::size_t;
+  using reference = T&;
+  using const_reference = const T&;
+  using pointer = T*;
+  using const_pointer = const T*;
+  using view_type = mdspan<T, Extents, Layout>;
+  using const_view_type = mdspan<const T, Extents, Layout>;
+
+  mystl::array<T, mapping_type::required_span_size()> m_storage;
+
+  static constexpr std::size_t rank() noexcept { return Extents::rank(); }
+
+  static constexpr std::size_t extent(std::size_t r) noexcept {
+    return Extents::extent(r);
+  }
+
+  static constexpr size_type size() noexcept { return Extents::size(); }
+
+  static constexpr size_type required_span_size() noexcept {
+    return mapping_type::required_span_size();
+  }
+
+  constexpr pointer data() noexcept { return m_storage.data(); }
+
+  constexpr const_pointer data() const noexcept { return m_storage.data(); }
+
+  template <class... Indices>
+  constexpr reference operator()(Indices... is) noexcept {
+    return m_storage[mapping_type()(is...)];
+  }
+
+  template <class... Indices>
+  constexpr const_reference operator()(Indices... is) const noexcept {
+    return m_storage[mapping_type()(is...)];
+  }
+
+  template <class... Indices>
+  constexpr reference at(Indices... is) {
+    return view().at(is...);
+  }
+
+  template <class... Indices>
+  constexpr const_reference at(Indices... is) const {
+    return view().at(is...);
+  }
+
+  // 填充用的元素也会被赋值
+  constexpr void fill(const T& value) { m_storage.fill(value); }
+
+  constexpr view_type view() noexcept { return view_type(data()); }
+
+  constexpr const_view_type view() const noexcept {
+    return const_view_type(data());
+  }
+};
+}  // namespace mystl
+
+#endif  // __MYSTL_MDSPAN_H__
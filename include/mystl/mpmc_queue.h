@@ -0,0 +1,310 @@
+#ifndef __MYSTL_MPMC_QUEUE_H__
+#define __MYSTL_MPMC_QUEUE_H__
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include "mystl/allocator.h"
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// 缓存行大小，用来把不同线程写的数据隔开，避免伪共享
+#ifndef MYSTL_CACHE_LINE_SIZE
+#define MYSTL_CACHE_LINE_SIZE 64
+#endif
+
+namespace mystl {
+namespace detail {
+/*
+ * 在 32 位原子量上等待/唤醒。C++20 的 atomic::wait 在 C++17 中不可用，
+ * Linux 上直接使用 futex 系统调用，其他平台退化为让出 CPU 的轮询。
+ */
+inline void futex_wait(std::atomic<std::uint32_t>& word,
+                       std::uint32_t expected) noexcept {
+#if defined(__linux__)
+  // 值已经不等于 expected 时立即返回；被信号打断或虚假唤醒由调用者重新检查条件
+  syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word),
+          FUTEX_WAIT_PRIVATE, expected, nullptr, nullptr, 0);
+#else
+  if (word.load(std::memory_order_acquire) == expected) {
+    std::this_thread::yield();
+  }
+#endif
+}
+
+inline void futex_wake_one(std::atomic<std::uint32_t>& word) noexcept {
+#if defined(__linux__)
+  syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word),
+          FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+#else
+  (void)word;
+#endif
+}
+}  // namespace detail
+
+/*
+ * mpmc_queue<T>: 多生产者多消费者的无锁有界队列（Dmitry Vyukov 的序号设计）
+ *
+ * 每个槽位带一个序号 seq，第 i 个槽位初始时 seq = i。对计数 pos 的槽位：
+ *
+ *   seq == pos       空闲，生产者 CAS 抢到 enqueue_pos 后写入，再发布 seq = pos + 1
+ *   seq == pos + 1   有数据，消费者 CAS 抢到 dequeue_pos 后取出，再发布 seq = pos + N
+ *
+ * 入队和出队各只有一次 CAS（抢下标），数据的发布靠槽位序号的 release/acquire，
+ * 不同线程操作不同槽位时互不等待。seq 比 pos 小说明队列满（入队）或空（出队）。
+ *
+ * 抢到下标后就不能退回：构造元素抛出异常时，槽位作为"空洞"照常发布，
+ * 抢到它的消费者释放槽位后继续取下一个；出队时移动赋值抛出异常，
+ * 元素被销毁、槽位照常释放，然后异常继续向外传播。两种情况下其他线程都不会卡住。
+ *
+ * 容量在运行时给定并向上取整到 2 的幂，存储通过 mystl::allocator 分配。
+ * try_push/try_pop 不阻塞；push/pop 在满/空时先短暂地让出 CPU 重试，
+ * 然后睡眠在 futex 上，直到另一端有进展。
+ * 只有存在睡眠的线程时，另一端才会执行 futex 唤醒的系统调用。
+ */
+template <class T>
+class mpmc_queue {
+ public:
+  // member type
+  using value_type = T;
+  using size_type = std::size_t;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+
+ private:
+  struct cell {
+    std::atomic<size_type> seq;
+    bool hole;  // 构造元素时抛出了异常，槽位里没有对象；由 seq 的发布保护
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+
+    T* value() noexcept { return reinterpret_cast<T*>(&storage); }
+  };
+
+  // 所有线程只读
+  alignas(MYSTL_CACHE_LINE_SIZE) cell* cells{nullptr};
+  size_type mask{0};
+  mystl::allocator<cell> allocator;
+  // 生产者共享
+  alignas(MYSTL_CACHE_LINE_SIZE) std::atomic<size_type> enqueue_pos{0};
+  // 消费者共享
+  alignas(MYSTL_CACHE_LINE_SIZE) std::atomic<size_type> dequeue_pos{0};
+  // 阻塞接口：睡眠线程数和 futex 字，只在队列满/空时写入
+  alignas(MYSTL_CACHE_LINE_SIZE) std::atomic<std::uint32_t> push_waiters{0};
+  std::atomic<std::uint32_t> pop_waiters{0};
+  std::atomic<std::uint32_t> push_epoch{0};  // 每次出队后有线程在等时递增
+  std::atomic<std::uint32_t> pop_epoch{0};   // 每次入队后有线程在等时递增
+
+  static size_type M_round_up(size_type n) noexcept {
+    size_type cap = 2;
+    while (cap < n) {
+      cap <<= 1;
+    }
+    return cap;
+  }
+
+  // 阻塞前先让出 CPU 重试的次数，短暂的满/空不必进入内核
+  static constexpr int kSpinCount = 16;
+
+  /*
+   * 成功入队/出队后调用：有线程睡在另一端时递增 epoch 并唤醒其中一个。
+   * 一次操作只腾出一个槽位或一个元素，唤醒一个就够了，避免惊群。
+   * 栅栏与等待方登记后的栅栏配对，保证"看不到等待者"时等待者一定能看到这次操作
+   */
+  static void M_notify(std::atomic<std::uint32_t>& waiters,
+                       std::atomic<std::uint32_t>& epoch) noexcept {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (waiters.load(std::memory_order_relaxed) != 0) {
+      epoch.fetch_add(1, std::memory_order_seq_cst);
+      detail::futex_wake_one(epoch);
+    }
+  }
+
+  // 消费者处理完位置 pos 的槽位后交还给下一轮的生产者
+  void M_release(cell* c, size_type pos) noexcept {
+    c->seq.store(pos + mask + 1, std::memory_order_release);
+    M_notify(push_waiters, push_epoch);
+  }
+
+  // 反复尝试 attempt()，失败时睡在 epoch 上
+  template <class Attempt>
+  static void M_block(std::atomic<std::uint32_t>& waiters,
+                      std::atomic<std::uint32_t>& epoch, Attempt attempt) {
+    for (int i = 0; i < kSpinCount; ++i) {
+      if (attempt()) {
+        return;
+      }
+      std::this_thread::yield();
+    }
+    while (!attempt()) {
+      waiters.fetch_add(1, std::memory_order_seq_cst);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      const std::uint32_t e = epoch.load(std::memory_order_seq_cst);
+      // 登记之后再试一次，避免错过登记之前发生的唤醒
+      if (attempt()) {
+        waiters.fetch_sub(1, std::memory_order_relaxed);
+        return;
+      }
+      detail::futex_wait(epoch, e);
+      waiters.fetch_sub(1, std::memory_order_relaxed);
+    }
+  }
+
+ public:
+  // capacity 至少为 2，向上取整到 2 的幂
+  explicit mpmc_queue(size_type capacity) {
+    const size_type n = M_round_up(capacity);
+    cells = allocator.allocate(n);
+    mask = n - 1;
+    for (size_type i = 0; i < n; ++i) {
+      ::new (static_cast<void*>(&cells[i].seq)) std::atomic<size_type>(i);
+      cells[i].hole = false;
+    }
+  }
+
+  mpmc_queue(const mpmc_queue&) = delete;
+  mpmc_queue& operator=(const mpmc_queue&) = delete;
+
+  // 析构时不能有其他线程在使用队列
+  ~mpmc_queue() {
+    const size_type tail = enqueue_pos.load(std::memory_order_relaxed);
+    for (size_type pos = dequeue_pos.load(std::memory_order_relaxed);
+         pos != tail; ++pos) {
+      cell& c = cells[pos & mask];
+      if (!c.hole) {
+        allocator.destroy(c.value());
+      }
+    }
+    allocator.deallocate(cells, mask + 1);
+  }
+
+  size_type capacity() const noexcept { return mask + 1; }
+
+  // 只是一个近似值，其他线程可能正在修改
+  size_type size_approx() const noexcept {
+    const size_type h = dequeue_pos.load(std::memory_order_acquire);
+    const size_type t = enqueue_pos.load(std::memory_order_acquire);
+    return t > h ? t - h : 0;
+  }
+
+  bool empty_approx() const noexcept { return size_approx() == 0; }
+
+  // --- 非阻塞接口 ---
+
+  // 队列满时返回 false，不构造元素。构造抛出的异常会传播给调用者
+  template <class... Args>
+  bool try_emplace(Args&&... args) {
+    size_type pos = enqueue_pos.load(std::memory_order_relaxed);
+    cell* c;
+    for (;;) {
+      c = &cells[pos & mask];
+      const size_type seq = c->seq.load(std::memory_order_acquire);
+      const std::ptrdiff_t diff = std::ptrdiff_t(seq - pos);
+      if (diff == 0) {
+        // 失败时 pos 被更新为最新值，直接重试
+        if (enqueue_pos.compare_exchange_weak(pos, pos + 1,
+                                              std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        return false;  // 这个槽位上一轮的数据还没被取走
+      } else {
+        pos = enqueue_pos.load(std::memory_order_relaxed);
+      }
+    }
+    if constexpr (std::is_nothrow_constructible<T, Args&&...>::value) {
+      allocator.construct(c->value(), std::forward<Args>(args)...);
+    } else {
+      try {
+        allocator.construct(c->value(), std::forward<Args>(args)...);
+      } catch (...) {
+        // 等在这个位置上的消费者需要看到 seq 前进，否则会一直等下去
+        c->hole = true;
+        c->seq.store(pos + 1, std::memory_order_release);
+        M_notify(pop_waiters, pop_epoch);
+        throw;
+      }
+    }
+    c->seq.store(pos + 1, std::memory_order_release);
+    M_notify(pop_waiters, pop_epoch);
+    return true;
+  }
+
+  bool try_push(const T& value) { return try_emplace(value); }
+
+  bool try_push(T&& value) { return try_emplace(std::move(value)); }
+
+  // 队列空时返回 false。移动赋值抛出异常时这个元素被丢弃，异常传播给调用者
+  bool try_pop(T& out) {
+    size_type pos = dequeue_pos.load(std::memory_order_relaxed);
+    cell* c;
+    for (;;) {
+      c = &cells[pos & mask];
+      const size_type seq = c->seq.load(std::memory_order_acquire);
+      const std::ptrdiff_t diff = std::ptrdiff_t(seq - (pos + 1));
+      if (diff == 0) {
+        if (dequeue_pos.compare_exchange_weak(pos, pos + 1,
+                                              std::memory_order_relaxed)) {
+          if (!c->hole) {
+            break;
+          }
+          // 空洞：直接交还槽位，继续取下一个位置
+          c->hole = false;
+          M_release(c, pos);
+          pos = dequeue_pos.load(std::memory_order_relaxed);
+        }
+      } else if (diff < 0) {
+        return false;  // 这个槽位还没有写入
+      } else {
+        pos = dequeue_pos.load(std::memory_order_relaxed);
+      }
+    }
+    T* p = c->value();
+    if constexpr (std::is_nothrow_move_assignable<T>::value) {
+      out = std::move(*p);
+    } else {
+      try {
+        out = std::move(*p);
+      } catch (...) {
+        allocator.destroy(p);
+        M_release(c, pos);
+        throw;
+      }
+    }
+    allocator.destroy(p);
+    M_release(c, pos);
+    return true;
+  }
+
+  // --- 阻塞接口 ---
+
+  void push(const T& value) {
+    M_block(push_waiters, push_epoch, [&] { return try_push(value); });
+  }
+
+  // try_push 失败时不会移动 value，所以可以反复尝试
+  void push(T&& value) {
+    M_block(push_waiters, push_epoch,
+            [&] { return try_push(std::move(value)); });
+  }
+
+  void pop(T& out) {
+    M_block(pop_waiters, pop_epoch, [&] { return try_pop(out); });
+  }
+
+  T pop() {
+    T out;
+    pop(out);
+    return out;
+  }
+};
+}  // namespace mystl
+
+#endif  // __MYSTL_MPMC_QUEUE_H__
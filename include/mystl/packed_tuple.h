@@ -0,0 +1,281 @@
+#ifndef __MYSTL_PACKED_TUPLE_H__
+#define __MYSTL_PACKED_TUPLE_H__
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "mystl/tuple.h"
+#include "mystl/utility.h"
+
+namespace mystl {
+namespace detail {
+/*
+ * 元素的存储顺序：按对齐从大到小排列，对齐相同的保持声明顺序。
+ * 这样每个元素的起始位置天然满足对齐，填充只可能出现在最后。
+ *
+ *   声明顺序 <char, double, char, int>            存储顺序 <double, int, char, char>
+ *   | c | pad 7 | double | c | pad 3 | int |      | double | int | c | c | pad 2 |
+ *   24 字节                                         16 字节
+ *
+ * 两个方向的下标映射都是 constexpr 函数，在编译期求值。
+ */
+template <class... Types>
+struct packed_order {
+  static constexpr std::size_t size = sizeof...(Types);
+  static constexpr std::size_t aligns[size == 0 ? 1 : size] = {
+      alignof(Types)...};
+
+  // 声明顺序的第 i 个元素在存储中的位置：排在它前面的元素个数
+  static constexpr std::size_t storage_index(std::size_t i) noexcept {
+    std::size_t pos = 0;
+    for (std::size_t k = 0; k < size; ++k) {
+      if (aligns[k] > aligns[i] || (aligns[k] == aligns[i] && k < i)) {
+        ++pos;
+      }
+    }
+    return pos;
+  }
+
+  // 存储中的第 s 个位置保存的是声明顺序的第几个元素
+  static constexpr std::size_t declared_index(std::size_t s) noexcept {
+    for (std::size_t i = 0; i < size; ++i) {
+      if (storage_index(i) == s) {
+        return i;
+      }
+    }
+    return size;
+  }
+};
+
+// 按存储顺序排列的 TupleImpl
+template <class Seq, class... Types>
+struct packed_storage;
+
+template <std::size_t... S, class... Types>
+struct packed_storage<std::index_sequence<S...>, Types...> {
+  using type = TupleImpl<
+      std::index_sequence<S...>,
+      NthType_t<packed_order<Types...>::declared_index(S), Types...>...>;
+};
+
+template <class... Types>
+using packed_storage_t =
+    typename packed_storage<std::make_index_sequence<sizeof...(Types)>,
+                            Types...>::type;
+}  // namespace detail
+
+template <class... Types>
+class packed_tuple;
+
+template <std::size_t I, class... Types>
+NthType_t<I, Types...>& get(packed_tuple<Types...>& t) noexcept;
+
+template <std::size_t I, class... Types>
+const NthType_t<I, Types...>& get(const packed_tuple<Types...>& t) noexcept;
+
+template <std::size_t I, class... Types>
+NthType_t<I, Types...>&& get(packed_tuple<Types...>&& t) noexcept;
+
+template <std::size_t I, class... Types>
+const NthType_t<I, Types...>&& get(const packed_tuple<Types...>&& t) noexcept;
+
+/*
+ * packed_tuple<Types...>: 接口与 tuple 相同（按声明顺序构造和 get<I>），
+ * 但元素按对齐从大到小存放，尽量消除成员之间的填充。
+ * 适合大量存储的小记录；空类元素同样享受 TupleLeaf 的空基类优化。
+ * 元素不能是引用，引用元组请使用 tuple / tie。
+ */
+template <class... Types>
+class packed_tuple : public detail::packed_storage_t<Types...> {
+  static_assert(!(std::is_reference<Types>::value || ...),
+                "packed_tuple does not support reference members");
+
+  using order = detail::packed_order<Types...>;
+
+ public:
+  using Base = detail::packed_storage_t<Types...>;
+
+  // 声明顺序的第 i 个元素在存储中的位置
+  static constexpr std::size_t storage_index(std::size_t i) noexcept {
+    return order::storage_index(i);
+  }
+
+  template <class Dummy = void,
+            typename std::enable_if<
+                std::is_void<Dummy>::value &&
+                    mystl::is_all_true_v<std::is_default_constructible,
+                                         Types...>,
+                int>::type = 0>
+  constexpr packed_tuple() : Base() {}
+
+  // 参数按声明顺序给出，在内部重排到存储顺序
+  template <
+      class... UTypes,
+      typename std::enable_if<
+          sizeof...(UTypes) >= 1 && sizeof...(UTypes) == sizeof...(Types) &&
+              mystl::is_all_true_general_v<std::is_constructible,
+                                           mystl::TypeLists<Types...>,
+                                           mystl::TypeLists<UTypes&&...>> &&
+              (sizeof...(UTypes) != 1 ||
+               !std::is_same<packed_tuple, typename std::decay<NthType_t<
+                                               0, UTypes...>>::type>::value),
+          int>::type = 0>
+  packed_tuple(UTypes&&... args)
+      : packed_tuple(
+            std::make_index_sequence<sizeof...(Types)>{},
+            mystl::forward_as_tuple(mystl::forward<UTypes>(args)...)) {}
+
+  packed_tuple(const packed_tuple&) = default;
+  packed_tuple(packed_tuple&&) = default;
+  packed_tuple& operator=(const packed_tuple&) = default;
+  packed_tuple& operator=(packed_tuple&&) = default;
+
+  void swap(packed_tuple& other) {
+    swap_elements(other, std::make_index_sequence<sizeof...(Types)>{});
+  }
+
+ private:
+  // 存储位置 S 上的元素取第 declared_index(S) 个参数
+  template <std::size_t... S, class ArgTuple>
+  packed_tuple(std::index_sequence<S...>, ArgTuple&& args)
+      : Base(mystl::get<order::declared_index(S)>(
+            mystl::forward<ArgTuple>(args))...) {}
+
+  template <std::size_t... Is>
+  void swap_elements(packed_tuple& other, std::index_sequence<Is...>) {
+    using std::swap;
+    (swap(mystl::get<Is>(*this), mystl::get<Is>(other)), ...);
+  }
+};
+
+template <std::size_t I, class... Types>
+NthType_t<I, Types...>& get(packed_tuple<Types...>& t) noexcept {
+  using LeafType = TupleLeaf<packed_tuple<Types...>::storage_index(I),
+                             NthType_t<I, Types...>>;
+  return static_cast<LeafType&>(t).get();
+}
+
+template <std::size_t I, class... Types>
+const NthType_t<I, Types...>& get(const packed_tuple<Types...>& t) noexcept {
+  using LeafType = TupleLeaf<packed_tuple<Types...>::storage_index(I),
+                             NthType_t<I, Types...>>;
+  return static_cast<const LeafType&>(t).get();
+}
+
+template <std::size_t I, class... Types>
+NthType_t<I, Types...>&& get(packed_tuple<Types...>&& t) noexcept {
+  using LeafType = TupleLeaf<packed_tuple<Types...>::storage_index(I),
+                             NthType_t<I, Types...>>;
+  return static_cast<LeafType&&>(t).get();
+}
+
+template <std::size_t I, class... Types>
+const NthType_t<I, Types...>&& get(const packed_tuple<Types...>&& t) noexcept {
+  using LeafType = TupleLeaf<packed_tuple<Types...>::storage_index(I),
+                             NthType_t<I, Types...>>;
+  return static_cast<const LeafType&&>(t).get();
+}
+
+template <class... Types>
+packed_tuple<typename std::decay<Types>::type...> make_packed_tuple(
+    Types&&... args) {
+  return packed_tuple<typename std::decay<Types>::type...>(
+      mystl::forward<Types>(args)...);
+}
+
+// 比较按声明顺序进行，与 tuple 的语义一致；和 tuple 一样用折叠表达式展开，
+// 全是标量时不分支
+namespace detail {
+template <class... Types, std::size_t... Is>
+bool packed_equal(const packed_tuple<Types...>& lhs,
+                  const packed_tuple<Types...>& rhs,
+                  std::index_sequence<Is...>) {
+  if constexpr ((is_branchless_comparable_v<Types, Types> && ...)) {
+    return (true & ... & bool(mystl::get<Is>(lhs) == mystl::get<Is>(rhs)));
+  } else {
+    return ((mystl::get<Is>(lhs) == mystl::get<Is>(rhs)) && ...);
+  }
+}
+
+template <class... Types, std::size_t... Is>
+bool packed_less(const packed_tuple<Types...>& lhs,
+                 const packed_tuple<Types...>& rhs,
+                 std::index_sequence<Is...>) {
+  if constexpr ((is_branchless_comparable_v<Types, Types> && ...)) {
+    constexpr std::size_t last = sizeof...(Is) - 1;
+    bool r = false;
+    (void)((r = bool(mystl::get<last - Is>(lhs) < mystl::get<last - Is>(rhs)) |
+                (!bool(mystl::get<last - Is>(rhs) <
+                       mystl::get<last - Is>(lhs)) &
+                 r)),
+           ...);
+    return r;
+  } else {
+    bool r = false;
+    (void)((... ||
+            (bool(mystl::get<Is>(lhs) < mystl::get<Is>(rhs))
+                 ? (r = true)
+                 : bool(mystl::get<Is>(rhs) < mystl::get<Is>(lhs)))));
+    return r;
+  }
+}
+}  // namespace detail
+
+template <class... Types>
+bool operator==(const packed_tuple<Types...>& lhs,
+                const packed_tuple<Types...>& rhs) {
+  return detail::packed_equal(lhs, rhs,
+                              std::make_index_sequence<sizeof...(Types)>{});
+}
+
+template <class... Types>
+bool operator!=(const packed_tuple<Types...>& lhs,
+                const packed_tuple<Types...>& rhs) {
+  return !(lhs == rhs);
+}
+
+template <class... Types>
+bool operator<(const packed_tuple<Types...>& lhs,
+               const packed_tuple<Types...>& rhs) {
+  return detail::packed_less(lhs, rhs,
+                             std::make_index_sequence<sizeof...(Types)>{});
+}
+
+template <class... Types>
+bool operator>(const packed_tuple<Types...>& lhs,
+               const packed_tuple<Types...>& rhs) {
+  return rhs < lhs;
+}
+
+template <class... Types>
+bool operator<=(const packed_tuple<Types...>& lhs,
+                const packed_tuple<Types...>& rhs) {
+  return !(rhs < lhs);
+}
+
+template <class... Types>
+bool operator>=(const packed_tuple<Types...>& lhs,
+                const packed_tuple<Types...>& rhs) {
+  return !(lhs < rhs);
+}
+
+template <class... Types>
+void swap(packed_tuple<Types...>& lhs, packed_tuple<Types...>& rhs) {
+  lhs.swap(rhs);
+}
+}  // namespace mystl
+
+namespace std {
+// 结构化绑定
+template <class... Types>
+struct tuple_size<mystl::packed_tuple<Types...>>
+    : std::integral_constant<std::size_t, sizeof...(Types)> {};
+
+template <std::size_t I, class... Types>
+struct tuple_element<I, mystl::packed_tuple<Types...>> {
+  using type = mystl::NthType_t<I, Types...>;
+};
+}  // namespace std
+
+#endif  // __MYSTL_PACKED_TUPLE_H__
@@ -0,0 +1,786 @@
+#ifndef __MYSTL_RANGES_H__
+#define __MYSTL_RANGES_H__
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include "mystl/tuple.h"
+#include "mystl/utility.h"
+
+namespace mystl {
+/*
+ * 惰性 range 适配器（C++17 可用的 std::views 子集）
+ *
+ *   auto r = v | views::filter(is_valid)
+ *              | views::transform(parse)
+ *              | views::drop(1)
+ *              | views::take(100);
+ *   for (auto&& x : r) { ... }
+ *
+ * 适配器只保存底层 range 和参数，不分配内存；遍历 r 时每个元素依次穿过所有阶段，
+ * 编译后就是一个循环。适配器之间也可以先组合：
+ *
+ *   auto stage = views::filter(is_valid) | views::transform(parse);
+ *   auto r = v | stage;
+ *
+ * 底层 range 是左值时视图只保存指针，容器必须比视图活得久；
+ * 右值容器会被移动进视图。视图的迭代器指向视图本身（用来访问函数对象），
+ * 视图被移动或销毁后迭代器失效。
+ *
+ * 迭代器的 iterator_category 表示遍历能力（和 boost 的 transform_iterator 一样），
+ * transform 的 reference 可能是纯右值，不要对它取地址。
+ */
+
+// 所有视图的基类，用来区分视图和容器：视图按值保存，容器按引用保存
+struct view_base {};
+
+template <class R>
+using iterator_t = decltype(std::begin(std::declval<R&>()));
+
+template <class R>
+using range_reference_t =
+    typename std::iterator_traits<iterator_t<R>>::reference;
+
+template <class R>
+using range_value_t = typename std::iterator_traits<iterator_t<R>>::value_type;
+
+namespace detail {
+template <class R, class = void>
+struct is_sized_range : std::false_type {};
+
+template <class R>
+struct is_sized_range<R, std::void_t<decltype(std::size(std::declval<R&>()))>>
+    : std::true_type {};
+
+template <class It>
+using iter_category_t = typename std::iterator_traits<It>::iterator_category;
+
+template <class It>
+constexpr bool is_random_access_v =
+    std::is_base_of<std::random_access_iterator_tag,
+                    iter_category_t<It>>::value;
+
+// 较弱的迭代器类别，适配器的能力不会超过上限 Cap
+template <class It, class Cap>
+using weaker_category_t =
+    typename std::conditional<std::is_base_of<Cap, iter_category_t<It>>::value,
+                              Cap, iter_category_t<It>>::type;
+
+// 从 it 向 last 前进最多 n 步，返回实际前进的步数
+template <class It>
+std::ptrdiff_t advance_bounded(It& it, std::ptrdiff_t n, const It& last) {
+  if constexpr (is_random_access_v<It>) {
+    const std::ptrdiff_t left = last - it;
+    const std::ptrdiff_t step = n < left ? n : left;
+    it += step;
+    return step;
+  } else {
+    std::ptrdiff_t step = 0;
+    while (step < n && it != last) {
+      ++it;
+      ++step;
+    }
+    return step;
+  }
+}
+}  // namespace detail
+
+// 左值容器的视图，只保存指针
+template <class R>
+class ref_view : public view_base {
+  R* r{nullptr};
+
+ public:
+  ref_view() = default;
+  explicit ref_view(R& range) noexcept : r(&range) {}
+
+  iterator_t<R> begin() const { return std::begin(*r); }
+  iterator_t<R> end() const { return std::end(*r); }
+
+  template <class B = R,
+            typename std::enable_if<detail::is_sized_range<B>::value,
+                                    int>::type = 0>
+  std::size_t size() const {
+    return std::size_t(std::size(*r));
+  }
+};
+
+// 右值容器被移动进来，由视图拥有
+template <class R>
+class owning_view : public view_base {
+  R r;
+
+ public:
+  owning_view() = default;
+  explicit owning_view(R&& range) : r(mystl::move(range)) {}
+
+  iterator_t<const R> begin() const { return std::begin(r); }
+  iterator_t<const R> end() const { return std::end(r); }
+
+  template <class B = R,
+            typename std::enable_if<detail::is_sized_range<const B>::value,
+                                    int>::type = 0>
+  std::size_t size() const {
+    return std::size_t(std::size(r));
+  }
+};
+
+// [first, last) 迭代器对，chunk 的元素类型
+template <class It>
+class subrange : public view_base {
+  It first{};
+  It last{};
+
+ public:
+  subrange() = default;
+  subrange(It b, It e) : first(b), last(e) {}
+
+  It begin() const { return first; }
+  It end() const { return last; }
+  bool empty() const { return first == last; }
+  std::size_t size() const { return std::size_t(std::distance(first, last)); }
+};
+
+namespace views {
+// 把任意 range 变成视图：视图原样拷贝，左值容器用 ref_view，右值容器用 owning_view
+template <class R>
+auto all(R&& r) {
+  using D = std::decay_t<R>;
+  if constexpr (std::is_base_of<view_base, D>::value) {
+    return D(mystl::forward<R>(r));
+  } else if constexpr (std::is_lvalue_reference<R>::value) {
+    return ref_view<std::remove_reference_t<R>>(r);
+  } else {
+    return owning_view<D>(mystl::move(r));
+  }
+}
+}  // namespace views
+
+template <class R>
+using all_t = decltype(views::all(std::declval<R>()));
+
+//===========================================================
+//===================== 管道运算符 ==========================
+//===========================================================
+// range_adaptor_closure<F>: 只差一个 range 参数的适配器，r | closure 即 closure(r)
+template <class F>
+struct range_adaptor_closure {
+  F f;
+
+  template <class R>
+  auto operator()(R&& r) const {
+    return f(mystl::forward<R>(r));
+  }
+};
+
+template <class F>
+range_adaptor_closure<F> make_range_adaptor_closure(F f) {
+  return range_adaptor_closure<F>{mystl::move(f)};
+}
+
+template <class T>
+struct is_range_adaptor_closure : std::false_type {};
+
+template <class F>
+struct is_range_adaptor_closure<range_adaptor_closure<F>> : std::true_type {};
+
+template <class R, class F,
+          typename std::enable_if<
+              !is_range_adaptor_closure<std::decay_t<R>>::value, int>::type = 0>
+auto operator|(R&& r, const range_adaptor_closure<F>& c) {
+  return c(mystl::forward<R>(r));
+}
+
+// 两个适配器组合成一个：r | (a | b) 等价于 r | a | b
+template <class F1, class F2>
+auto operator|(range_adaptor_closure<F1> a, range_adaptor_closure<F2> b) {
+  return make_range_adaptor_closure(
+      [a = mystl::move(a), b = mystl::move(b)](auto&& r) {
+        return b(a(mystl::forward<decltype(r)>(r)));
+      });
+}
+
+//===========================================================
+//===================== transform ===========================
+//===========================================================
+template <class V, class F>
+class transform_view : public view_base {
+  V base_;
+  F fun;
+
+  using base_iter = iterator_t<const V>;
+
+ public:
+  class iterator {
+    base_iter cur{};
+    const transform_view* parent{nullptr};
+
+   public:
+    using iterator_category = detail::iter_category_t<base_iter>;
+    using reference =
+        decltype(std::declval<const F&>()(*std::declval<base_iter>()));
+    using value_type = std::remove_cv_t<std::remove_reference_t<reference>>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+
+    iterator() = default;
+    iterator(base_iter it, const transform_view* p) : cur(it), parent(p) {}
+
+    const base_iter& base() const noexcept { return cur; }
+
+    reference operator*() const { return parent->fun(*cur); }
+
+    iterator& operator++() {
+      ++cur;
+      return *this;
+    }
+    iterator operator++(int) {
+      iterator tmp = *this;
+      ++cur;
+      return tmp;
+    }
+    iterator& operator--() {
+      --cur;
+      return *this;
+    }
+    iterator operator--(int) {
+      iterator tmp = *this;
+      --cur;
+      return tmp;
+    }
+    iterator& operator+=(difference_type n) {
+      cur += n;
+      return *this;
+    }
+    iterator& operator-=(difference_type n) {
+      cur -= n;
+      return *this;
+    }
+    friend iterator operator+(iterator it, difference_type n) {
+      return it += n;
+    }
+    friend iterator operator+(difference_type n, iterator it) {
+      return it += n;
+    }
+    friend iterator operator-(iterator it, difference_type n) {
+      return it -= n;
+    }
+    friend difference_type operator-(const iterator& a, const iterator& b) {
+      return a.cur - b.cur;
+    }
+    reference operator[](difference_type n) const {
+      return parent->fun(cur[n]);
+    }
+    friend bool operator==(const iterator& a, const iterator& b) {
+      return a.cur == b.cur;
+    }
+    friend bool operator!=(const iterator& a, const iterator& b) {
+      return a.cur != b.cur;
+    }
+    friend bool operator<(const iterator& a, const iterator& b) {
+      return a.cur < b.cur;
+    }
+    friend bool operator>(const iterator& a, const iterator& b) {
+      return b.cur < a.cur;
+    }
+    friend bool operator<=(const iterator& a, const iterator& b) {
+      return !(b.cur < a.cur);
+    }
+    friend bool operator>=(const iterator& a, const iterator& b) {
+      return !(a.cur < b.cur);
+    }
+  };
+
+  transform_view() = default;
+  transform_view(V base, F f)
+      : base_(mystl::move(base)), fun(mystl::move(f)) {}
+
+  iterator begin() const { return iterator(base_.begin(), this); }
+  iterator end() const { return iterator(base_.end(), this); }
+
+  template <class B = V,
+            typename std::enable_if<detail::is_sized_range<const B>::value,
+                                    int>::type = 0>
+  std::size_t size() const {
+    return std::size_t(std::size(base_));
+  }
+};
+
+//===========================================================
+//====================== filter =============================
+//===========================================================
+template <class V, class Pred>
+class filter_view : public view_base {
+  V base_;
+  Pred pred;
+
+  using base_iter = iterator_t<const V>;
+
+ public:
+  class iterator {
+    base_iter cur{};
+    base_iter last{};
+    const filter_view* parent{nullptr};
+
+    void M_satisfy() {
+      while (cur != last && !parent->pred(*cur)) {
+        ++cur;
+      }
+    }
+
+   public:
+    // 过滤之后不能随机访问，最多是双向
+    using iterator_category =
+        detail::weaker_category_t<base_iter, std::bidirectional_iterator_tag>;
+    using reference = typename std::iterator_traits<base_iter>::reference;
+    using value_type = typename std::iterator_traits<base_iter>::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = typename std::iterator_traits<base_iter>::pointer;
+
+    iterator() = default;
+    iterator(base_iter it, base_iter end, const filter_view* p)
+        : cur(it), last(end), parent(p) {
+      M_satisfy();
+    }
+
+    const base_iter& base() const noexcept { return cur; }
+
+    reference operator*() const { return *cur; }
+
+    iterator& operator++() {
+      ++cur;
+      M_satisfy();
+      return *this;
+    }
+    iterator operator++(int) {
+      iterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+    // 调用方保证前面还有满足条件的元素
+    iterator& operator--() {
+      do {
+        --cur;
+      } while (!parent->pred(*cur));
+      return *this;
+    }
+    iterator operator--(int) {
+      iterator tmp = *this;
+      --*this;
+      return tmp;
+    }
+    friend bool operator==(const iterator& a, const iterator& b) {
+      return a.cur == b.cur;
+    }
+    friend bool operator!=(const iterator& a, const iterator& b) {
+      return a.cur != b.cur;
+    }
+  };
+
+  filter_view() = default;
+  filter_view(V base, Pred p)
+      : base_(mystl::move(base)), pred(mystl::move(p)) {}
+
+  // 每次调用都要从头找第一个满足条件的元素，遍历时只调用一次
+  iterator begin() const {
+    return iterator(base_.begin(), base_.end(), this);
+  }
+  iterator end() const { return iterator(base_.end(), base_.end(), this); }
+};
+
+//===========================================================
+//======================== take =============================
+//===========================================================
+// 随机访问且有大小的 range 直接截出 [begin, begin + min(n, size))，
+// 否则迭代器带一个计数，走满 n 步或到达底层末尾都算结束
+template <class V>
+class take_view : public view_base {
+  V base_;
+  std::ptrdiff_t count{0};
+
+  using base_iter = iterator_t<const V>;
+
+ public:
+  class iterator {
+    base_iter cur{};
+    std::ptrdiff_t pos{0};
+
+   public:
+    using iterator_category =
+        detail::weaker_category_t<base_iter, std::forward_iterator_tag>;
+    using reference = typename std::iterator_traits<base_iter>::reference;
+    using value_type = typename std::iterator_traits<base_iter>::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = typename std::iterator_traits<base_iter>::pointer;
+
+    iterator() = default;
+    iterator(base_iter it, std::ptrdiff_t n) : cur(it), pos(n) {}
+
+    const base_iter& base() const noexcept { return cur; }
+
+    reference operator*() const { return *cur; }
+
+    iterator& operator++() {
+      ++cur;
+      ++pos;
+      return *this;
+    }
+    iterator operator++(int) {
+      iterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+    // 到达计数上限或底层末尾，二者之一即为相等
+    friend bool operator==(const iterator& a, const iterator& b) {
+      return a.pos == b.pos || a.cur == b.cur;
+    }
+    friend bool operator!=(const iterator& a, const iterator& b) {
+      return !(a == b);
+    }
+  };
+
+  take_view() = default;
+  take_view(V base, std::ptrdiff_t n)
+      : base_(mystl::move(base)), count(n < 0 ? 0 : n) {}
+
+  auto begin() const {
+    if constexpr (M_slice()) {
+      return base_.begin();
+    } else {
+      return iterator(base_.begin(), 0);
+    }
+  }
+
+  auto end() const {
+    if constexpr (M_slice()) {
+      return base_.begin() + std::ptrdiff_t(size());
+    } else {
+      return iterator(base_.end(), count);
+    }
+  }
+
+  template <class B = V,
+            typename std::enable_if<detail::is_sized_range<const B>::value,
+                                    int>::type = 0>
+  std::size_t size() const {
+    const std::size_t n = std::size_t(std::size(base_));
+    return std::size_t(count) < n ? std::size_t(count) : n;
+  }
+
+ private:
+  static constexpr bool M_slice() {
+    return detail::is_random_access_v<base_iter> &&
+           detail::is_sized_range<const V>::value;
+  }
+};
+
+//===========================================================
+//======================== drop =============================
+//===========================================================
+template <class V>
+class drop_view : public view_base {
+  V base_;
+  std::ptrdiff_t count{0};
+
+ public:
+  drop_view() = default;
+  drop_view(V base, std::ptrdiff_t n)
+      : base_(mystl::move(base)), count(n < 0 ? 0 : n) {}
+
+  // 随机访问时 O(1)，否则逐个前进
+  iterator_t<const V> begin() const {
+    auto it = base_.begin();
+    detail::advance_bounded(it, count, base_.end());
+    return it;
+  }
+
+  iterator_t<const V> end() const { return base_.end(); }
+
+  template <class B = V,
+            typename std::enable_if<detail::is_sized_range<const B>::value,
+                                    int>::type = 0>
+  std::size_t size() const {
+    const std::size_t n = std::size_t(std::size(base_));
+    return std::size_t(count) < n ? n - std::size_t(count) : 0;
+  }
+};
+
+//===========================================================
+//================= chunk / stride 共用 =====================
+//===========================================================
+// 每次前进 n 步（不超过末尾）的迭代器
+template <class It>
+class step_iterator_base {
+ protected:
+  It cur{};
+  It last{};
+  std::ptrdiff_t step{1};
+
+  step_iterator_base() = default;
+  step_iterator_base(It it, It end, std::ptrdiff_t n)
+      : cur(it), last(end), step(n) {}
+
+  void M_next() { detail::advance_bounded(cur, step, last); }
+
+ public:
+  using difference_type = std::ptrdiff_t;
+
+  const It& base() const noexcept { return cur; }
+
+  friend bool operator==(const step_iterator_base& a,
+                         const step_iterator_base& b) {
+    return a.cur == b.cur;
+  }
+  friend bool operator!=(const step_iterator_base& a,
+                         const step_iterator_base& b) {
+    return a.cur != b.cur;
+  }
+};
+
+template <class V>
+std::size_t ceil_div_size(const V& base, std::ptrdiff_t n) {
+  const std::size_t size = std::size_t(std::size(base));
+  return (size + std::size_t(n) - 1) / std::size_t(n);
+}
+
+//===========================================================
+//======================== chunk ============================
+//===========================================================
+// 每个元素是长度为 n 的 subrange，最后一块可能不足 n
+template <class V>
+class chunk_view : public view_base {
+  V base_;
+  std::ptrdiff_t n{1};
+
+  using base_iter = iterator_t<const V>;
+
+ public:
+  class iterator : public step_iterator_base<base_iter> {
+    using Base = step_iterator_base<base_iter>;
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = subrange<base_iter>;
+    using reference = value_type;
+    using pointer = void;
+
+    iterator() = default;
+    iterator(base_iter it, base_iter end, std::ptrdiff_t step)
+        : Base(it, end, step) {}
+
+    reference operator*() const {
+      base_iter chunk_end = this->cur;
+      detail::advance_bounded(chunk_end, this->step, this->last);
+      return value_type(this->cur, chunk_end);
+    }
+
+    iterator& operator++() {
+      this->M_next();
+      return *this;
+    }
+    iterator operator++(int) {
+      iterator tmp = *this;
+      this->M_next();
+      return tmp;
+    }
+  };
+
+  chunk_view() = default;
+  chunk_view(V base, std::ptrdiff_t size)
+      : base_(mystl::move(base)), n(size < 1 ? 1 : size) {}
+
+  iterator begin() const { return iterator(base_.begin(), base_.end(), n); }
+  iterator end() const { return iterator(base_.end(), base_.end(), n); }
+
+  template <class B = V,
+            typename std::enable_if<detail::is_sized_range<const B>::value,
+                                    int>::type = 0>
+  std::size_t size() const {
+    return ceil_div_size(base_, n);
+  }
+};
+
+//===========================================================
+//======================== stride ===========================
+//===========================================================
+// 第 0, n, 2n, ... 个元素
+template <class V>
+class stride_view : public view_base {
+  V base_;
+  std::ptrdiff_t n{1};
+
+  using base_iter = iterator_t<const V>;
+
+ public:
+  class iterator : public step_iterator_base<base_iter> {
+    using Base = step_iterator_base<base_iter>;
+
+   public:
+    using iterator_category =
+        detail::weaker_category_t<base_iter, std::forward_iterator_tag>;
+    using reference = typename std::iterator_traits<base_iter>::reference;
+    using value_type = typename std::iterator_traits<base_iter>::value_type;
+    using pointer = typename std::iterator_traits<base_iter>::pointer;
+
+    iterator() = default;
+    iterator(base_iter it, base_iter end, std::ptrdiff_t step)
+        : Base(it, end, step) {}
+
+    reference operator*() const { return *this->cur; }
+
+    iterator& operator++() {
+      this->M_next();
+      return *this;
+    }
+    iterator operator++(int) {
+      iterator tmp = *this;
+      this->M_next();
+      return tmp;
+    }
+  };
+
+  stride_view() = default;
+  stride_view(V base, std::ptrdiff_t step)
+      : base_(mystl::move(base)), n(step < 1 ? 1 : step) {}
+
+  iterator begin() const { return iterator(base_.begin(), base_.end(), n); }
+  iterator end() const { return iterator(base_.end(), base_.end(), n); }
+
+  template <class B = V,
+            typename std::enable_if<detail::is_sized_range<const B>::value,
+                                    int>::type = 0>
+  std::size_t size() const {
+    return ceil_div_size(base_, n);
+  }
+};
+
+//===========================================================
+//====================== enumerate ==========================
+//===========================================================
+// 元素是 mystl::tuple<std::size_t, reference>，可以用结构化绑定：
+//   for (auto [i, x] : v | views::enumerate) { ... }
+template <class V>
+class enumerate_view : public view_base {
+  V base_;
+
+  using base_iter = iterator_t<const V>;
+
+ public:
+  class iterator {
+    base_iter cur{};
+    std::size_t idx{0};
+
+   public:
+    using iterator_category =
+        detail::weaker_category_t<base_iter, std::forward_iterator_tag>;
+    using reference = mystl::tuple<
+        std::size_t, typename std::iterator_traits<base_iter>::reference>;
+    using value_type = mystl::tuple<
+        std::size_t, typename std::iterator_traits<base_iter>::value_type>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+
+    iterator() = default;
+    iterator(base_iter it, std::size_t i) : cur(it), idx(i) {}
+
+    const base_iter& base() const noexcept { return cur; }
+    std::size_t index() const noexcept { return idx; }
+
+    reference operator*() const { return reference(idx, *cur); }
+
+    iterator& operator++() {
+      ++cur;
+      ++idx;
+      return *this;
+    }
+    iterator operator++(int) {
+      iterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+    friend bool operator==(const iterator& a, const iterator& b) {
+      return a.cur == b.cur;
+    }
+    friend bool operator!=(const iterator& a, const iterator& b) {
+      return a.cur != b.cur;
+    }
+  };
+
+  enumerate_view() = default;
+  explicit enumerate_view(V base) : base_(mystl::move(base)) {}
+
+  iterator begin() const { return iterator(base_.begin(), 0); }
+  // end 的下标不参与比较
+  iterator end() const { return iterator(base_.end(), 0); }
+
+  template <class B = V,
+            typename std::enable_if<detail::is_sized_range<const B>::value,
+                                    int>::type = 0>
+  std::size_t size() const {
+    return std::size_t(std::size(base_));
+  }
+};
+
+//===========================================================
+//===================== views 工厂 ==========================
+//===========================================================
+namespace views {
+template <class F>
+auto transform(F f) {
+  return make_range_adaptor_closure([f = mystl::move(f)](auto&& r) {
+    using R = decltype(r);
+    return transform_view<all_t<R>, F>(views::all(mystl::forward<R>(r)), f);
+  });
+}
+
+template <class Pred>
+auto filter(Pred pred) {
+  return make_range_adaptor_closure([pred = mystl::move(pred)](auto&& r) {
+    using R = decltype(r);
+    return filter_view<all_t<R>, Pred>(views::all(mystl::forward<R>(r)),
+                                       pred);
+  });
+}
+
+inline auto take(std::ptrdiff_t n) {
+  return make_range_adaptor_closure([n](auto&& r) {
+    using R = decltype(r);
+    return take_view<all_t<R>>(views::all(mystl::forward<R>(r)), n);
+  });
+}
+
+inline auto drop(std::ptrdiff_t n) {
+  return make_range_adaptor_closure([n](auto&& r) {
+    using R = decltype(r);
+    return drop_view<all_t<R>>(views::all(mystl::forward<R>(r)), n);
+  });
+}
+
+inline auto chunk(std::ptrdiff_t n) {
+  return make_range_adaptor_closure([n](auto&& r) {
+    using R = decltype(r);
+    return chunk_view<all_t<R>>(views::all(mystl::forward<R>(r)), n);
+  });
+}
+
+inline auto stride(std::ptrdiff_t n) {
+  return make_range_adaptor_closure([n](auto&& r) {
+    using R = decltype(r);
+    return stride_view<all_t<R>>(views::all(mystl::forward<R>(r)), n);
+  });
+}
+
+struct enumerate_fn {
+  template <class R>
+  auto operator()(R&& r) const {
+    return enumerate_view<all_t<R>>(views::all(mystl::forward<R>(r)));
+  }
+};
+
+// 没有参数，直接写 v | views::enumerate
+inline constexpr range_adaptor_closure<enumerate_fn> enumerate{};
+}  // namespace views
+}  // namespace mystl
+
+#endif
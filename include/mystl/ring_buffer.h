@@ -0,0 +1,230 @@
+#ifndef __MYSTL_RING_BUFFER_H__
+#define __MYSTL_RING_BUFFER_H__
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include "mystl/array.h"
+#include "mystl/span.h"
+#include "mystl/utility.h"
+
+namespace mystl {
+// 缓冲区满时 push 的行为
+enum class ring_mode {
+  reject,    // 拒绝写入，push 返回 false
+  overwrite  // 覆盖最旧的元素
+};
+
+/*
+ * ring_buffer<T, N, Mode>: 定长环形缓冲区，存储是 mystl::array<T, N>，不分配内存
+ *
+ * N 必须是 2 的幂，下标用 & (N - 1) 代替取模。head/tail 是只增不减的计数器，
+ * size = tail - head，溢出回绕后依然成立，所以满和空不需要额外的标志位。
+ *
+ * 批量接口不拷贝数据，直接返回存储中最多两段连续的区间（第二段在回绕时非空）：
+ *
+ *   auto w = rb.push_n(n);              // 预留 n 个位置并计入 size
+ *   recv(fd, w.first.data(), w.first.size_bytes(), 0);
+ *   auto r = rb.pop_n(rb.size());       // 取出全部，区间在下一次写入前有效
+ *
+ * 弹出的元素只是被移出（move），对象本身留在存储中，直到被新元素覆盖。
+ */
+template <class T, std::size_t N, ring_mode Mode = ring_mode::reject>
+class ring_buffer {
+  static_assert(N != 0 && (N & (N - 1)) == 0,
+                "ring_buffer capacity must be a power of two");
+  static_assert(std::is_default_constructible<T>::value,
+                "ring_buffer requires a default constructible T");
+
+ public:
+  // member type
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using pointer = value_type*;
+  using const_pointer = const value_type*;
+  using span_pair = mystl::pair<mystl::span<T>, mystl::span<T>>;
+  using const_span_pair =
+      mystl::pair<mystl::span<const T>, mystl::span<const T>>;
+
+  static constexpr size_type kMask = N - 1;
+
+ private:
+  size_type head{0};  // 最旧元素的计数
+  size_type tail{0};  // 下一个写入位置的计数
+  mystl::array<T, N> buffer{};
+
+  // 从计数 from 开始的 n 个元素，n <= N
+  template <class U, class Storage>
+  static mystl::pair<mystl::span<U>, mystl::span<U>> M_spans(Storage& storage,
+                                                             size_type from,
+                                                             size_type n) {
+    const size_type first = from & kMask;
+    const size_type k = n < N - first ? n : N - first;
+    return mystl::pair<mystl::span<U>, mystl::span<U>>(
+        mystl::span<U>(storage.data() + first, k),
+        mystl::span<U>(storage.data(), n - k));
+  }
+
+  // 为 n 个新元素腾出空间，返回实际可以写入的个数
+  size_type M_make_room(size_type n) {
+    if constexpr (Mode == ring_mode::overwrite) {
+      if (n > N) {
+        n = N;
+      }
+      const size_type used = size();
+      if (used + n > N) {
+        head += used + n - N;
+      }
+      return n;
+    } else {
+      const size_type available = N - size();
+      return n < available ? n : available;
+    }
+  }
+
+ public:
+  ring_buffer() = default;
+
+  static constexpr size_type capacity() noexcept { return N; }
+
+  size_type size() const noexcept { return tail - head; }
+
+  bool empty() const noexcept { return tail == head; }
+
+  bool full() const noexcept { return size() == N; }
+
+  void clear() noexcept { head = tail; }
+
+  // 第 i 个最旧的元素
+  reference operator[](size_type i) noexcept {
+    return buffer[(head + i) & kMask];
+  }
+
+  const_reference operator[](size_type i) const noexcept {
+    return buffer[(head + i) & kMask];
+  }
+
+  reference front() noexcept { return buffer[head & kMask]; }
+
+  const_reference front() const noexcept { return buffer[head & kMask]; }
+
+  reference back() noexcept { return buffer[(tail - 1) & kMask]; }
+
+  const_reference back() const noexcept { return buffer[(tail - 1) & kMask]; }
+
+  // 最旧的元素，为空时返回 nullptr
+  pointer peek() noexcept { return empty() ? nullptr : &front(); }
+
+  const_pointer peek() const noexcept { return empty() ? nullptr : &front(); }
+
+  // reject 模式下缓冲区已满时返回 false；overwrite 模式下总是返回 true
+  template <class... Args>
+  bool emplace(Args&&... args) {
+    if (M_make_room(1) == 0) {
+      return false;
+    }
+    buffer[tail & kMask] = T(std::forward<Args>(args)...);
+    ++tail;
+    return true;
+  }
+
+  bool push(const T& value) {
+    if (M_make_room(1) == 0) {
+      return false;
+    }
+    buffer[tail & kMask] = value;
+    ++tail;
+    return true;
+  }
+
+  bool push(T&& value) {
+    if (M_make_room(1) == 0) {
+      return false;
+    }
+    buffer[tail & kMask] = std::move(value);
+    ++tail;
+    return true;
+  }
+
+  // 为空时返回 false
+  bool pop(T& out) {
+    if (empty()) {
+      return false;
+    }
+    out = std::move(buffer[head & kMask]);
+    ++head;
+    return true;
+  }
+
+  bool pop() noexcept {
+    if (empty()) {
+      return false;
+    }
+    ++head;
+    return true;
+  }
+
+  /*
+   * 预留最多 n 个位置并计入 size，返回这些位置对应的两段区间，由调用者填写。
+   * reject 模式下受剩余空间限制；overwrite 模式下最多 N 个，必要时丢弃最旧的元素。
+   */
+  span_pair push_n(size_type n) {
+    n = M_make_room(n);
+    const size_type from = tail;
+    tail += n;
+    return M_spans<T>(buffer, from, n);
+  }
+
+  // 拷贝 [src, src + n) 中能放下的部分，返回写入的个数
+  size_type push_n(const T* src, size_type n) {
+    if constexpr (Mode == ring_mode::overwrite) {
+      // 只有最后 N 个元素会留下来
+      if (n > N) {
+        src += n - N;
+        n = N;
+      }
+    }
+    span_pair w = push_n(n);
+    for (size_type i = 0; i < w.first.size(); ++i) {
+      w.first[i] = src[i];
+    }
+    src += w.first.size();
+    for (size_type i = 0; i < w.second.size(); ++i) {
+      w.second[i] = src[i];
+    }
+    return w.first.size() + w.second.size();
+  }
+
+  // 取出最多 n 个最旧的元素，返回它们所在的区间，在下一次写入之前有效
+  span_pair pop_n(size_type n) noexcept {
+    const size_type used = size();
+    n = n < used ? n : used;
+    const size_type from = head;
+    head += n;
+    return M_spans<T>(buffer, from, n);
+  }
+
+  // 把最多 n 个最旧的元素移动到 dst，返回个数
+  size_type pop_n(T* dst, size_type n) {
+    span_pair r = pop_n(n);
+    for (size_type i = 0; i < r.first.size(); ++i) {
+      *dst++ = std::move(r.first[i]);
+    }
+    for (size_type i = 0; i < r.second.size(); ++i) {
+      *dst++ = std::move(r.second[i]);
+    }
+    return r.first.size() + r.second.size();
+  }
+
+  // 查看最多 n 个最旧的元素，不取出
+  const_span_pair peek_n(size_type n) const noexcept {
+    const size_type used = size();
+    return M_spans<const T>(buffer, head, n < used ? n : used);
+  }
+};
+}  // namespace mystl
+
+#endif  // __MYSTL_RING_BUFFER_H__
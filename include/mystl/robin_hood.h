@@ -0,0 +1,947 @@
+#ifndef __MYSTL_ROBIN_HOOD_H__
+#define __MYSTL_ROBIN_HOOD_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>  // for std::equal_to
+#include <initializer_list>
+#include <iterator>
+#include <memory>  // for std::allocator_traits
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "mystl/allocator.h"
+#include "mystl/hash.h"
+#include "mystl/tuple.h"
+#include "mystl/utility.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace mystl {
+namespace detail {
+// 从元素中取出键
+struct robin_hood_identity {
+  template <class T>
+  const T& operator()(const T& value) const noexcept {
+    return value;
+  }
+};
+
+struct robin_hood_select_first {
+  template <class Pair>
+  const typename Pair::first_type& operator()(const Pair& value) const noexcept {
+    return value.first;
+  }
+};
+
+// 迭代器访问槽位的方式：默认直接返回元素的引用和指针
+struct robin_hood_slot_access {
+  template <class Value>
+  using reference = Value&;
+  template <class Value>
+  using pointer = Value*;
+
+  template <class Value>
+  static Value& ref(Value* slot) noexcept {
+    return *slot;
+  }
+
+  template <class Value>
+  static Value* ptr(Value* slot) noexcept {
+    return slot;
+  }
+};
+
+/*
+ * robin_hood_map 的可修改迭代器解引用得到的代理：键只读，值可写。
+ * 槽位里存的是 pair<Key, T>，直接返回 pair& 会让 it->first = k 通过编译并破坏表。
+ * 可以用 auto&& / const auto& 或结构化绑定遍历，也可以转换成 pair<Key, T>。
+ */
+template <class Key, class T>
+struct robin_hood_map_reference {
+  const Key& first;
+  T& second;
+
+  explicit robin_hood_map_reference(mystl::pair<Key, T>& p) noexcept
+      : first(p.first), second(p.second) {}
+
+  operator mystl::pair<Key, T>() const {
+    return mystl::pair<Key, T>(first, second);
+  }
+};
+
+// operator-> 返回的代理，让 it->second 可以直接使用
+template <class Ref>
+struct robin_hood_arrow {
+  Ref ref;
+
+  const Ref* operator->() const noexcept { return &ref; }
+};
+
+struct robin_hood_map_access {
+  template <class Value>
+  using reference = robin_hood_map_reference<typename Value::first_type,
+                                             typename Value::second_type>;
+  template <class Value>
+  using pointer = robin_hood_arrow<reference<Value>>;
+
+  template <class Value>
+  static reference<Value> ref(Value* slot) noexcept {
+    return reference<Value>(*slot);
+  }
+
+  template <class Value>
+  static pointer<Value> ptr(Value* slot) noexcept {
+    return pointer<Value>{reference<Value>(*slot)};
+  }
+};
+
+/*
+ * robin_hood_table: robin_hood_set / robin_hood_map 共用的开放寻址表（线性探测）
+ *
+ * 每个槽位的探测距离（离理想位置有多远）存放在单独的字节数组 dist 中：
+ * 0 表示空槽位，d + 1 表示元素离理想位置 d 个槽位。元数据紧凑连续，
+ * 迭代和查找时的扫描只访问这个字节数组，不会把元素本身拉进缓存。
+ *
+ * 插入时"劫富济贫"：新元素的探测距离比槽位中的元素更大时交换两者，
+ * 被换出的元素继续向后探测。这样所有元素的探测距离都很平均，
+ * 查找遇到探测距离比当前更小的槽位时就可以断定键不存在。
+ *
+ * 删除使用后移（backward shift）：把后面探测距离不为 0 的元素依次前移一格，
+ * 不需要墓碑，删除之后的表和从未插入过该元素时完全一样。
+ *
+ * 一次插入最多让其他元素的探测距离各增加 1，所以只要插入前最大距离小于 254
+ * 就不会溢出一个字节；达到上限时先扩容。最大负载因子可以设置到 0.95。
+ */
+template <class Value, class Key, class KeyOf, class Hash, class KeyEqual,
+          class Alloc, bool ConstIterator,
+          class Access = robin_hood_slot_access>
+class robin_hood_table {
+ public:
+  // member type
+  using key_type = Key;
+  using value_type = Value;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using allocator_type = Alloc;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using pointer = value_type*;
+  using const_pointer = const value_type*;
+
+ protected:
+  using slot_allocator =
+      typename std::allocator_traits<Alloc>::template rebind_alloc<value_type>;
+  using dist_allocator =
+      typename std::allocator_traits<Alloc>::template rebind_alloc<
+          std::uint8_t>;
+  using slot_traits = std::allocator_traits<slot_allocator>;
+
+  static constexpr size_type npos = size_type(-1);
+  static constexpr size_type kMinCapacity = 8;
+  static constexpr std::uint8_t kMaxDist = 254;  // dist 中能存放的最大值
+  static constexpr float kMinLoadFactor = 0.2f;
+  static constexpr float kMaxLoadFactor = 0.95f;
+
+  template <bool Const>
+  class M_iterator {
+    friend class robin_hood_table;
+    template <bool>
+    friend class M_iterator;
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = typename robin_hood_table::value_type;
+    using difference_type = std::ptrdiff_t;
+
+   private:
+    using slot_type =
+        typename std::conditional<Const, const value_type, value_type>::type;
+    using access = typename std::conditional<Const, robin_hood_slot_access,
+                                             Access>::type;
+
+   public:
+    using pointer = typename access::template pointer<slot_type>;
+    using reference = typename access::template reference<slot_type>;
+
+   private:
+    const std::uint8_t* dist{nullptr};
+    slot_type* slot{nullptr};
+
+    M_iterator(const std::uint8_t* d, slot_type* s) noexcept
+        : dist(d), slot(s) {}
+
+    // dist 末尾有一个非 0 的哨兵，不需要检查是否越界
+    void M_skip_empty() noexcept {
+      while (*dist == 0) {
+        ++dist;
+        ++slot;
+      }
+    }
+
+   public:
+    M_iterator() noexcept = default;
+
+    template <bool C = Const, typename = typename std::enable_if<C>::type>
+    M_iterator(const M_iterator<false>& other) noexcept
+        : dist(other.dist), slot(other.slot) {}
+
+    reference operator*() const noexcept { return access::ref(slot); }
+
+    pointer operator->() const noexcept { return access::ptr(slot); }
+
+    M_iterator& operator++() noexcept {
+      ++dist;
+      ++slot;
+      M_skip_empty();
+      return *this;
+    }
+
+    M_iterator operator++(int) noexcept {
+      M_iterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    friend bool operator==(const M_iterator& lhs,
+                           const M_iterator& rhs) noexcept {
+      return lhs.dist == rhs.dist;
+    }
+
+    friend bool operator!=(const M_iterator& lhs,
+                           const M_iterator& rhs) noexcept {
+      return lhs.dist != rhs.dist;
+    }
+  };
+
+ public:
+  using iterator = M_iterator<ConstIterator>;
+  using const_iterator = M_iterator<true>;
+
+ protected:
+  std::uint8_t* dist{nullptr};  // cap + 1 个字节，最后一个是哨兵
+  value_type* slots{nullptr};   // cap 个槽位
+  size_type cap{0};             // 0 或者 2 的幂
+  size_type num_elements{0};
+  std::uint8_t max_dist{0};   // 表中出现过的最大 dist，只在重新散列时重置
+  float load_limit{0.875f};
+  // max_elements: 超过时扩容。哈希函数、比较函数和分配器通常是空类，
+  // 和它压缩在一起不占空间
+  mystl::compressed_pair<size_type,
+                         mystl::tuple<hasher, key_equal, slot_allocator>>
+      max_and_policies{};
+
+  size_type& M_max_elements() noexcept { return max_and_policies.first(); }
+  size_type M_max_elements() const noexcept {
+    return max_and_policies.first();
+  }
+  hasher& M_hasher() noexcept {
+    return mystl::get<0>(max_and_policies.second());
+  }
+  const hasher& M_hasher() const noexcept {
+    return mystl::get<0>(max_and_policies.second());
+  }
+  key_equal& M_key_eq() noexcept {
+    return mystl::get<1>(max_and_policies.second());
+  }
+  const key_equal& M_key_eq() const noexcept {
+    return mystl::get<1>(max_and_policies.second());
+  }
+  slot_allocator& M_allocator() noexcept {
+    return mystl::get<2>(max_and_policies.second());
+  }
+  const slot_allocator& M_allocator() const noexcept {
+    return mystl::get<2>(max_and_policies.second());
+  }
+
+  template <class K>
+  size_type M_hash(const K& key) const {
+    return detail::hash_mix(M_hasher()(key));
+  }
+
+  size_type M_max_load(size_type capacity) const noexcept {
+    const size_type n = size_type(double(capacity) * load_limit);
+    return n < capacity ? n : capacity - 1;
+  }
+
+  size_type M_capacity_for(size_type n) const noexcept {
+    size_type capacity = kMinCapacity;
+    while (M_max_load(capacity) < n) {
+      capacity <<= 1;
+    }
+    return capacity;
+  }
+
+  template <class K>
+  size_type M_find_index(const K& key) const {
+    if (num_elements == 0) {
+      return npos;
+    }
+    const size_type mask = cap - 1;
+    size_type i = M_hash(key) & mask;
+    std::uint8_t d = 1;
+#if defined(__GNUC__)
+    // 要找的元素通常就在理想位置附近，和 dist 的访问同时把槽位取进缓存
+    __builtin_prefetch(slots + i);
+#endif
+#if defined(__SSE2__)
+    /*
+     * 一次比较 16 个探测距离。位置 i + k 上的元素和要找的键理想位置相同，
+     * 当且仅当 dist == d + k；出现 dist < d + k 时键不可能在更后面。
+     * 同一理想位置的元素是连续的一段，通常只需要比较一两次键。
+     * 不回绕：靠近数组末尾或者距离接近上限时交给下面的逐个扫描。
+     */
+    const __m128i lane_offsets =
+        _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    while (i + 16 <= cap && d <= kMaxDist - 16) {
+      const __m128i bytes =
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(dist + i));
+      const __m128i expect =
+          _mm_add_epi8(_mm_set1_epi8(char(d)), lane_offsets);
+      const unsigned eq =
+          unsigned(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, expect)));
+      const unsigned ge = unsigned(_mm_movemask_epi8(
+          _mm_cmpeq_epi8(_mm_max_epu8(bytes, expect), bytes)));
+      const unsigned stop = ~ge & 0xFFFFu;
+      // 只有第一个停止位置之前的匹配才可能是要找的键
+      unsigned candidates = stop != 0 ? eq & ((stop & (0u - stop)) - 1) : eq;
+      for (; candidates != 0; candidates &= candidates - 1) {
+        const size_type j = i + size_type(__builtin_ctz(candidates));
+        if (M_key_eq()(KeyOf()(slots[j]), key)) {
+          return j;
+        }
+      }
+      if (stop != 0) {
+        return npos;
+      }
+      i += 16;
+      d = std::uint8_t(d + 16);
+    }
+    i &= mask;
+#endif
+    for (;; ++d) {
+      // 槽位中的元素比当前键更"富"（或者槽位为空），键不可能在更后面
+      if (dist[i] < d) {
+        return npos;
+      }
+      if (dist[i] == d && M_key_eq()(KeyOf()(slots[i]), key)) {
+        return i;
+      }
+      i = (i + 1) & mask;
+    }
+  }
+
+  /*
+   * 把 value 放进表中（调用者保证键不存在且容量足够），返回它最终所在的下标。
+   * 被换出的元素直接和 value 交换，所以 value 在返回后处于被移出的状态。
+   */
+  size_type M_place(value_type& value) {
+    const size_type mask = cap - 1;
+    size_type i = M_hash(KeyOf()(value)) & mask;
+    size_type result = npos;
+    std::uint8_t d = 1;
+    for (;; ++d, i = (i + 1) & mask) {
+      if (d > kMaxDist) {
+        throw std::length_error(
+            "mystl::robin_hood: probe distance overflow, hash is too poor");
+      }
+      if (dist[i] == 0) {
+        slot_traits::construct(M_allocator(), slots + i, mystl::move(value));
+        dist[i] = d;
+        break;
+      }
+      if (dist[i] < d) {
+        // 劫富济贫：手里的元素占据这个槽位，原来的元素接着向后找位置
+        using std::swap;
+        swap(value, slots[i]);
+        const std::uint8_t tmp = dist[i];
+        dist[i] = d;
+        d = tmp;
+        if (result == npos) {
+          result = i;
+        }
+      }
+      if (d > max_dist) {
+        max_dist = d;
+      }
+    }
+    if (d > max_dist) {
+      max_dist = d;
+    }
+    ++num_elements;
+    return result == npos ? i : result;
+  }
+
+  // 插入之前调用，保证还能放下一个元素，且探测距离不会溢出
+  void M_reserve_one() {
+    if (num_elements + 1 > M_max_elements() || max_dist >= kMaxDist) {
+      M_rehash(cap == 0 ? kMinCapacity : 2 * cap);
+      if (max_dist >= kMaxDist) {
+        // 扩容也没能缩短探测距离，说明大量的键哈希值相同
+        throw std::length_error(
+            "mystl::robin_hood: probe distance overflow, hash is too poor");
+      }
+    }
+  }
+
+  void M_erase_at(size_type i) {
+    const size_type mask = cap - 1;
+    slot_traits::destroy(M_allocator(), slots + i);
+    // 后移：后面离理想位置不为 0 的元素前移一格，直到遇到空槽位或在理想位置的元素
+    size_type next = (i + 1) & mask;
+    while (dist[next] > 1) {
+      slot_traits::construct(M_allocator(), slots + i,
+                             mystl::move(slots[next]));
+      slot_traits::destroy(M_allocator(), slots + next);
+      dist[i] = std::uint8_t(dist[next] - 1);
+      i = next;
+      next = (next + 1) & mask;
+    }
+    dist[i] = 0;
+    --num_elements;
+  }
+
+  void M_allocate(size_type capacity) {
+    dist_allocator da(M_allocator());
+    dist = da.allocate(capacity + 1);
+    try {
+      slots = M_allocator().allocate(capacity);
+    } catch (...) {
+      da.deallocate(dist, capacity + 1);
+      dist = nullptr;
+      throw;
+    }
+    std::memset(dist, 0, capacity);
+    dist[capacity] = 1;  // 迭代用的哨兵
+    cap = capacity;
+    M_max_elements() = M_max_load(capacity);
+    max_dist = 0;
+  }
+
+  void M_destroy_and_deallocate() noexcept {
+    if (cap == 0) {
+      return;
+    }
+    if (!std::is_trivially_destructible<value_type>::value) {
+      for (size_type i = 0; i < cap; ++i) {
+        if (dist[i] != 0) {
+          slot_traits::destroy(M_allocator(), slots + i);
+        }
+      }
+    }
+    M_deallocate(dist, slots, cap);
+    dist = nullptr;
+    slots = nullptr;
+    cap = num_elements = M_max_elements() = 0;
+    max_dist = 0;
+  }
+
+  /*
+   * 只用探测距离模拟把当前元素放进 capacity 个槽位的表，判断距离会不会溢出。
+   * 容量扩大为原来的 2^k 倍时，任何一段槽位里理想位置落在其中的元素只会变少，
+   * 探测距离不会变长，不需要检查；只有缩小容量时才需要。
+   */
+  bool M_fits(size_type capacity) const {
+    dist_allocator da(M_allocator());
+    std::uint8_t* sim = da.allocate(capacity);
+    std::memset(sim, 0, capacity);
+    const size_type mask = capacity - 1;
+    bool fits = true;
+    try {
+      for (size_type k = 0; k < cap && fits; ++k) {
+        if (dist[k] == 0) {
+          continue;
+        }
+        size_type i = M_hash(KeyOf()(slots[k])) & mask;
+        for (std::uint8_t d = 1;; ++d, i = (i + 1) & mask) {
+          if (d > kMaxDist) {
+            fits = false;
+            break;
+          }
+          if (sim[i] == 0) {
+            sim[i] = d;
+            break;
+          }
+          if (sim[i] < d) {
+            const std::uint8_t tmp = sim[i];
+            sim[i] = d;
+            d = tmp;
+          }
+        }
+      }
+    } catch (...) {
+      da.deallocate(sim, capacity);
+      throw;
+    }
+    da.deallocate(sim, capacity);
+    return fits;
+  }
+
+  /*
+   * 调用者保证 new_cap 不小于当前容量，或者已经用 M_fits 检查过，
+   * 所以 M_place 不会因为探测距离溢出而失败。哈希函数或元素的移动抛出异常时，
+   * 已经放进新表的元素保留，其余的销毁，旧的数组照常释放（基本保证）。
+   */
+  void M_rehash(size_type new_cap) {
+    std::uint8_t* old_dist = dist;
+    value_type* old_slots = slots;
+    const size_type old_cap = cap;
+    M_allocate(new_cap);
+    num_elements = 0;
+    size_type i = 0;
+    try {
+      for (; i < old_cap; ++i) {
+        if (old_dist[i] != 0) {
+          M_place(old_slots[i]);
+          slot_traits::destroy(M_allocator(), old_slots + i);
+        }
+      }
+    } catch (...) {
+      for (; i < old_cap; ++i) {
+        if (old_dist[i] != 0) {
+          slot_traits::destroy(M_allocator(), old_slots + i);
+        }
+      }
+      M_deallocate(old_dist, old_slots, old_cap);
+      throw;
+    }
+    M_deallocate(old_dist, old_slots, old_cap);
+  }
+
+  void M_deallocate(std::uint8_t* d, value_type* s, size_type capacity) noexcept {
+    if (capacity != 0) {
+      dist_allocator da(M_allocator());
+      da.deallocate(d, capacity + 1);
+      M_allocator().deallocate(s, capacity);
+    }
+  }
+
+  iterator M_iterator_at(size_type i) noexcept {
+    return iterator(dist + i, slots + i);
+  }
+
+  const_iterator M_iterator_at(size_type i) const noexcept {
+    return const_iterator(dist + i, slots + i);
+  }
+
+  // 键不存在时用 args 构造元素并插入
+  template <class K, class... Args>
+  mystl::pair<iterator, bool> M_emplace_unique(const K& key, Args&&... args) {
+    const size_type found = M_find_index(key);
+    if (found != npos) {
+      return mystl::pair<iterator, bool>(M_iterator_at(found), false);
+    }
+    value_type value(mystl::forward<Args>(args)...);
+    M_reserve_one();
+    return mystl::pair<iterator, bool>(
+        M_iterator_at(M_place(value)), true);
+  }
+
+ public:
+  robin_hood_table() = default;
+
+  explicit robin_hood_table(size_type n, const Hash& hash = Hash(),
+                            const KeyEqual& equal = KeyEqual(),
+                            const Alloc& alloc = Alloc())
+      : max_and_policies(size_type(0),
+                         mystl::tuple<hasher, key_equal, slot_allocator>(
+                             hash, equal, slot_allocator(alloc))) {
+    reserve(n);
+  }
+
+  robin_hood_table(const robin_hood_table& other)
+      : load_limit(other.load_limit),
+        max_and_policies(size_type(0), other.max_and_policies.second()) {
+    if (other.num_elements == 0) {
+      return;
+    }
+    // 容量和布局保持不变，逐个拷贝有元素的槽位
+    M_allocate(other.cap);
+    for (size_type i = 0; i < cap; ++i) {
+      if (other.dist[i] != 0) {
+        try {
+          slot_traits::construct(M_allocator(), slots + i, other.slots[i]);
+        } catch (...) {
+          M_destroy_and_deallocate();
+          throw;
+        }
+        dist[i] = other.dist[i];
+        ++num_elements;
+      }
+    }
+    max_dist = other.max_dist;
+  }
+
+  robin_hood_table(robin_hood_table&& other) noexcept
+      : dist(other.dist),
+        slots(other.slots),
+        cap(other.cap),
+        num_elements(other.num_elements),
+        max_dist(other.max_dist),
+        load_limit(other.load_limit),
+        max_and_policies(mystl::move(other.max_and_policies)) {
+    other.dist = nullptr;
+    other.slots = nullptr;
+    other.cap = other.num_elements = other.M_max_elements() = 0;
+    other.max_dist = 0;
+  }
+
+  robin_hood_table& operator=(const robin_hood_table& other) {
+    if (this != &other) {
+      robin_hood_table tmp(other);
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  robin_hood_table& operator=(robin_hood_table&& other) noexcept {
+    if (this != &other) {
+      M_destroy_and_deallocate();
+      swap(other);
+    }
+    return *this;
+  }
+
+  ~robin_hood_table() { M_destroy_and_deallocate(); }
+
+  allocator_type get_allocator() const {
+    return allocator_type(M_allocator());
+  }
+
+  hasher hash_function() const { return M_hasher(); }
+
+  key_equal key_eq() const { return M_key_eq(); }
+
+  // iterator
+
+  iterator begin() noexcept {
+    if (cap == 0) {
+      return iterator();
+    }
+    iterator it = M_iterator_at(0);
+    it.M_skip_empty();
+    return it;
+  }
+
+  const_iterator begin() const noexcept {
+    if (cap == 0) {
+      return const_iterator();
+    }
+    const_iterator it = M_iterator_at(0);
+    it.M_skip_empty();
+    return it;
+  }
+
+  const_iterator cbegin() const noexcept { return begin(); }
+
+  iterator end() noexcept {
+    return cap == 0 ? iterator() : M_iterator_at(cap);
+  }
+
+  const_iterator end() const noexcept {
+    return cap == 0 ? const_iterator() : M_iterator_at(cap);
+  }
+
+  const_iterator cend() const noexcept { return end(); }
+
+  // capacity
+
+  bool empty() const noexcept { return num_elements == 0; }
+
+  size_type size() const noexcept { return num_elements; }
+
+  size_type max_size() const noexcept {
+    return slot_traits::max_size(M_allocator());
+  }
+
+  // 槽位总数
+  size_type capacity() const noexcept { return cap; }
+
+  // 槽位数组和探测距离数组占用的字节数
+  size_type memory_usage() const noexcept {
+    return cap == 0 ? 0 : cap * (sizeof(value_type) + 1) + 1;
+  }
+
+  float load_factor() const noexcept {
+    return cap == 0 ? 0.0f : float(num_elements) / float(cap);
+  }
+
+  float max_load_factor() const noexcept { return load_limit; }
+
+  // 限制在 [0.2, 0.95]；调低之后如果当前元素超出新的上限会立即扩容
+  void max_load_factor(float ml) {
+    load_limit = ml < kMinLoadFactor   ? kMinLoadFactor
+                 : ml > kMaxLoadFactor ? kMaxLoadFactor
+                                       : ml;
+    if (cap != 0) {
+      M_max_elements() = M_max_load(cap);
+      if (num_elements > M_max_elements()) {
+        M_rehash(M_capacity_for(num_elements));
+      }
+    }
+  }
+
+  // 保证插入 n 个元素之前不会因为负载因子扩容
+  void reserve(size_type n) {
+    if (n > M_max_elements()) {
+      M_rehash(M_capacity_for(n));
+    }
+  }
+
+  // 重新散列到至少 n 个槽位，同时不少于容纳当前元素所需
+  void rehash(size_type n) {
+    size_type capacity = M_capacity_for(num_elements);
+    while (capacity < n) {
+      capacity <<= 1;
+    }
+    if (num_elements == 0 && n == 0) {
+      M_destroy_and_deallocate();
+      return;
+    }
+    // 缩小容量可能让探测距离溢出，放不下时保留更大的容量
+    while (capacity < cap && !M_fits(capacity)) {
+      capacity <<= 1;
+    }
+    M_rehash(capacity);
+  }
+
+  // modifiers
+
+  void clear() noexcept {
+    if (num_elements == 0) {
+      return;
+    }
+    for (size_type i = 0; i < cap; ++i) {
+      if (dist[i] != 0) {
+        slot_traits::destroy(M_allocator(), slots + i);
+        dist[i] = 0;
+      }
+    }
+    num_elements = 0;
+    max_dist = 0;
+  }
+
+  /*
+   * 后移删除会把后面的元素移动到 pos，所以返回的迭代器可能仍然指向 pos。
+   * 删除最后一个槽位时，数组开头回绕过来的元素会移到末尾，
+   * 边遍历边删除时这样的元素可能被访问两次。
+   */
+  iterator erase(const_iterator pos) {
+    const size_type i = size_type(pos.dist - dist);
+    M_erase_at(i);
+    iterator it = M_iterator_at(i);
+    it.M_skip_empty();
+    return it;
+  }
+
+  size_type erase(const key_type& key) {
+    const size_type i = M_find_index(key);
+    if (i == npos) {
+      return 0;
+    }
+    M_erase_at(i);
+    return 1;
+  }
+
+  void swap(robin_hood_table& other) noexcept {
+    using std::swap;
+    swap(dist, other.dist);
+    swap(slots, other.slots);
+    swap(cap, other.cap);
+    swap(num_elements, other.num_elements);
+    swap(max_dist, other.max_dist);
+    swap(load_limit, other.load_limit);
+    max_and_policies.swap(other.max_and_policies);
+  }
+
+  // lookup
+
+  iterator find(const key_type& key) {
+    const size_type i = M_find_index(key);
+    return i == npos ? end() : M_iterator_at(i);
+  }
+
+  const_iterator find(const key_type& key) const {
+    const size_type i = M_find_index(key);
+    return i == npos ? end() : M_iterator_at(i);
+  }
+
+  bool contains(const key_type& key) const {
+    return M_find_index(key) != npos;
+  }
+
+  size_type count(const key_type& key) const { return contains(key); }
+};
+}  // namespace detail
+
+/*
+ * robin_hood_set<K>: 基于 robin hood 线性探测的哈希集合
+ *
+ *   mystl::robin_hood_set<int> s;
+ *   s.max_load_factor(0.95f);   // 内存紧张时提高负载因子
+ *   s.insert(42);
+ *
+ * 插入和删除都会移动元素，任何修改操作都会使迭代器、指针和引用失效。
+ */
+template <class Key, class Hash = mystl::hash<Key>,
+          class KeyEqual = std::equal_to<Key>,
+          class Alloc = mystl::allocator<Key>>
+class robin_hood_set
+    : public detail::robin_hood_table<Key, Key, detail::robin_hood_identity,
+                                      Hash, KeyEqual, Alloc, true> {
+  using base = detail::robin_hood_table<Key, Key, detail::robin_hood_identity,
+                                        Hash, KeyEqual, Alloc, true>;
+
+ public:
+  using typename base::iterator;
+  using typename base::size_type;
+  using typename base::value_type;
+
+  using base::base;
+
+  robin_hood_set() = default;
+
+  robin_hood_set(std::initializer_list<value_type> ilist) {
+    this->reserve(ilist.size());
+    insert(ilist.begin(), ilist.end());
+  }
+
+  mystl::pair<iterator, bool> insert(const value_type& value) {
+    return this->M_emplace_unique(value, value);
+  }
+
+  mystl::pair<iterator, bool> insert(value_type&& value) {
+    return this->M_emplace_unique(value, mystl::move(value));
+  }
+
+  template <class InputIt>
+  void insert(InputIt first, InputIt last) {
+    for (; first != last; ++first) {
+      insert(*first);
+    }
+  }
+
+  void insert(std::initializer_list<value_type> ilist) {
+    insert(ilist.begin(), ilist.end());
+  }
+
+  template <class... Args>
+  mystl::pair<iterator, bool> emplace(Args&&... args) {
+    return insert(value_type(mystl::forward<Args>(args)...));
+  }
+};
+
+/*
+ * robin_hood_map<K, V>: 基于 robin hood 线性探测的哈希表
+ *
+ * 插入时元素会在槽位之间交换，所以元素类型是 mystl::pair<K, V> 而不是
+ * pair<const K, V>（否则每次交换都要拷贝键）。可修改的迭代器解引用得到
+ * { const K& first; V& second; } 形式的代理，只能修改 second；
+ * 遍历时用 auto&&、const auto& 或结构化绑定，不能用 auto&。
+ */
+template <class Key, class T, class Hash = mystl::hash<Key>,
+          class KeyEqual = std::equal_to<Key>,
+          class Alloc = mystl::allocator<mystl::pair<Key, T>>>
+class robin_hood_map
+    : public detail::robin_hood_table<mystl::pair<Key, T>, Key,
+                                      detail::robin_hood_select_first, Hash,
+                                      KeyEqual, Alloc, false,
+                                      detail::robin_hood_map_access> {
+  using base = detail::robin_hood_table<mystl::pair<Key, T>, Key,
+                                        detail::robin_hood_select_first, Hash,
+                                        KeyEqual, Alloc, false,
+                                        detail::robin_hood_map_access>;
+
+ public:
+  using mapped_type = T;
+  using typename base::iterator;
+  using typename base::key_type;
+  using typename base::size_type;
+  using typename base::value_type;
+
+  using base::base;
+
+  robin_hood_map() = default;
+
+  robin_hood_map(std::initializer_list<value_type> ilist) {
+    this->reserve(ilist.size());
+    insert(ilist.begin(), ilist.end());
+  }
+
+  mystl::pair<iterator, bool> insert(const value_type& value) {
+    return this->M_emplace_unique(value.first, value);
+  }
+
+  mystl::pair<iterator, bool> insert(value_type&& value) {
+    return this->M_emplace_unique(value.first, mystl::move(value));
+  }
+
+  template <class InputIt>
+  void insert(InputIt first, InputIt last) {
+    for (; first != last; ++first) {
+      insert(*first);
+    }
+  }
+
+  void insert(std::initializer_list<value_type> ilist) {
+    insert(ilist.begin(), ilist.end());
+  }
+
+  // 键不存在时才用 args 构造 mapped_type
+  template <class... Args>
+  mystl::pair<iterator, bool> try_emplace(const key_type& key,
+                                          Args&&... args) {
+    return this->M_emplace_unique(
+        key, std::piecewise_construct, mystl::forward_as_tuple(key),
+        mystl::forward_as_tuple(mystl::forward<Args>(args)...));
+  }
+
+  template <class... Args>
+  mystl::pair<iterator, bool> try_emplace(key_type&& key, Args&&... args) {
+    return this->M_emplace_unique(
+        key, std::piecewise_construct, mystl::forward_as_tuple(mystl::move(key)),
+        mystl::forward_as_tuple(mystl::forward<Args>(args)...));
+  }
+
+  template <class M>
+  mystl::pair<iterator, bool> insert_or_assign(const key_type& key, M&& obj) {
+    mystl::pair<iterator, bool> result =
+        try_emplace(key, mystl::forward<M>(obj));
+    if (!result.second) {
+      result.first->second = mystl::forward<M>(obj);
+    }
+    return result;
+  }
+
+  mapped_type& at(const key_type& key) {
+    const size_type i = this->M_find_index(key);
+    if (i == base::npos) {
+      throw std::out_of_range("mystl::robin_hood_map::at");
+    }
+    return this->slots[i].second;
+  }
+
+  const mapped_type& at(const key_type& key) const {
+    const size_type i = this->M_find_index(key);
+    if (i == base::npos) {
+      throw std::out_of_range("mystl::robin_hood_map::at");
+    }
+    return this->slots[i].second;
+  }
+
+  mapped_type& operator[](const key_type& key) {
+    return try_emplace(key).first->second;
+  }
+
+  mapped_type& operator[](key_type&& key) {
+    return try_emplace(mystl::move(key)).first->second;
+  }
+};
+}  // namespace mystl
+
+#endif  // __MYSTL_ROBIN_HOOD_H__
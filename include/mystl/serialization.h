@@ -0,0 +1,588 @@
+#ifndef __MYSTL_SERIALIZATION_H__
+#define __MYSTL_SERIALIZATION_H__
+
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "mystl/array.h"
+#include "mystl/span.h"
+#include "mystl/tuple.h"
+#include "mystl/utility.h"
+#include "mystl/vector.h"
+
+/*
+ * 二进制序列化：mystl::vector / array / pair / tuple
+ *
+ * 每个对象由一个定长头部和 payload 组成：
+ *
+ * |---- serial_header (40B) ----|-- padding --|------ payload ------|-- pad --|
+ *                                             ^
+ *                                             按 header.alignment 对齐
+ *
+ * 1. 元素是 trivially copyable 时 payload 就是内存里的原始字节，整块读写，
+ *    反序列化时可以直接返回指向缓冲区（例如 mmap 的文件）的 span，不做任何拷贝。
+ * 2. 否则退化为逐元素编码：tuple-like 类型通过 std::tuple_size / get<I> 递归编码
+ *    每个成员，vector 先写 u64 长度再写元素。
+ *
+ * 头部里的 fingerprint 由类型结构计算（算术类型的种类和大小、tuple-like 的成员、
+ * 容器种类等），读取时类型不匹配会抛出 serialization_error。
+ * 数据按本机字节序存储。
+ */
+namespace mystl {
+
+class serialization_error : public std::runtime_error {
+ public:
+  using std::runtime_error::runtime_error;
+};
+
+struct serial_header {
+  static constexpr std::uint32_t kMagic = 0x4C54534D;  // "MSTL"
+  static constexpr std::uint16_t kVersion = 1;
+  // flags
+  static constexpr std::uint16_t kRaw = 1;  // payload 是连续的原始字节
+
+  std::uint32_t magic;
+  std::uint16_t version;
+  std::uint16_t flags;
+  std::uint32_t alignment;    // payload 的对齐要求
+  std::uint32_t elem_size;    // sizeof(元素)，逐元素编码时为 0
+  std::uint64_t fingerprint;  // 类型指纹
+  std::uint64_t length;       // 元素个数
+  std::uint64_t bytes;        // payload 字节数
+};
+static_assert(sizeof(serial_header) == 40, "unexpected serial_header layout");
+
+namespace detail {
+//===========================================================
+//=================  type fingerprint  ======================
+//===========================================================
+constexpr std::uint64_t fnv_combine(std::uint64_t seed, std::uint64_t value) {
+  for (int i = 0; i < 8; ++i) {
+    seed = (seed ^ ((value >> (i * 8)) & 0xff)) * 1099511628211ull;
+  }
+  return seed;
+}
+
+constexpr std::uint64_t fnv_string(const char* s) {
+  std::uint64_t h = 14695981039346656037ull;
+  for (; *s != '\0'; ++s) {
+    h = (h ^ static_cast<unsigned char>(*s)) * 1099511628211ull;
+  }
+  return h;
+}
+
+// 同一编译器下稳定的类型名哈希，只用于无法按结构描述的类型（用户自定义的 POD）
+template <class T>
+constexpr std::uint64_t type_name_hash() {
+#if defined(__GNUC__) || defined(__clang__)
+  return fnv_string(__PRETTY_FUNCTION__);
+#else
+  return fnv_string(__FUNCSIG__);
+#endif
+}
+
+template <class T, class = void>
+struct is_tuple_like : std::false_type {};
+
+template <class T>
+struct is_tuple_like<T, std::void_t<decltype(std::tuple_size<T>::value)>>
+    : std::true_type {};
+
+template <class T>
+struct is_mystl_vector : std::false_type {};
+
+template <class T, class Alloc>
+struct is_mystl_vector<mystl::vector<T, Alloc>> : std::true_type {};
+
+template <class T>
+struct is_mystl_array : std::false_type {};
+
+template <class T, std::size_t N>
+struct is_mystl_array<mystl::array<T, N>> : std::true_type {};
+
+template <class T, class = void>
+struct type_fingerprint;
+
+template <class T, std::size_t... Is>
+constexpr std::uint64_t tuple_fingerprint(std::index_sequence<Is...>) {
+  std::uint64_t h = fnv_combine(3, sizeof...(Is));
+  ((h = fnv_combine(
+        h, type_fingerprint<typename std::tuple_element<Is, T>::type>::value)),
+   ...);
+  return h;
+}
+
+template <class T>
+struct type_fingerprint<T, std::enable_if_t<std::is_arithmetic<T>::value>> {
+  static constexpr std::uint64_t value = fnv_combine(
+      fnv_combine(std::is_floating_point<T>::value ? 2 : 1,
+                  std::is_signed<T>::value),
+      sizeof(T));
+};
+
+template <class T, class Alloc>
+struct type_fingerprint<mystl::vector<T, Alloc>> {
+  static constexpr std::uint64_t value =
+      fnv_combine(4, type_fingerprint<T>::value);
+};
+
+template <class T, std::size_t N>
+struct type_fingerprint<mystl::array<T, N>> {
+  static constexpr std::uint64_t value =
+      fnv_combine(fnv_combine(5, type_fingerprint<T>::value), N);
+};
+
+template <class T>
+struct type_fingerprint<
+    T, std::enable_if_t<is_tuple_like<T>::value && !is_mystl_array<T>::value>> {
+  static constexpr std::uint64_t value =
+      tuple_fingerprint<T>(std::make_index_sequence<std::tuple_size<T>::value>{});
+};
+
+template <class T>
+struct type_fingerprint<
+    T, std::enable_if_t<!std::is_arithmetic<T>::value &&
+                        !is_tuple_like<T>::value &&
+                        !is_mystl_vector<T>::value>> {
+  static_assert(std::is_trivially_copyable<T>::value,
+                "mystl::serialize: type is neither trivially copyable, "
+                "tuple-like nor a mystl::vector");
+  static constexpr std::uint64_t value = fnv_combine(
+      fnv_combine(fnv_combine(6, type_name_hash<T>()), sizeof(T)), alignof(T));
+};
+
+//===========================================================
+//=================  sinks and sources  =====================
+//===========================================================
+struct stream_sink {
+  std::ostream& os;
+
+  void write(const void* p, std::size_t n) {
+    os.write(static_cast<const char*>(p), std::streamsize(n));
+    if (!os) {
+      throw serialization_error("mystl::serialize: stream write failed");
+    }
+  }
+};
+
+// 只统计字节数，用于在写头部之前算出 payload 大小
+struct counting_sink {
+  std::size_t bytes = 0;
+
+  void write(const void*, std::size_t n) { bytes += n; }
+};
+
+struct stream_source {
+  std::istream& is;
+
+  void read(void* p, std::size_t n) {
+    is.read(static_cast<char*>(p), std::streamsize(n));
+    if (std::size_t(is.gcount()) != n) {
+      throw serialization_error("mystl::deserialize: unexpected end of stream");
+    }
+  }
+
+  void skip(std::size_t n) {
+    is.ignore(std::streamsize(n));
+    if (std::size_t(is.gcount()) != n) {
+      throw serialization_error("mystl::deserialize: unexpected end of stream");
+    }
+  }
+
+  // 流的剩余长度未知，读到末尾时由 read/skip 报错
+  void require(std::uint64_t) const noexcept {}
+};
+
+struct buffer_source {
+  const unsigned char* cur;
+  std::size_t left;
+
+  const unsigned char* take(std::size_t n) {
+    if (n > left) {
+      throw serialization_error("mystl::deserialize: buffer too small");
+    }
+    const unsigned char* p = cur;
+    cur += n;
+    left -= n;
+    return p;
+  }
+
+  void read(void* p, std::size_t n) { std::memcpy(p, take(n), n); }
+
+  void skip(std::size_t n) { take(n); }
+
+  // 在按头部分配内存之前确认缓冲区里确实有这么多字节
+  void require(std::uint64_t n) const {
+    if (n > left) {
+      throw serialization_error("mystl::deserialize: buffer too small");
+    }
+  }
+};
+
+//===========================================================
+//=================  element-wise encoding  =================
+//===========================================================
+template <class T>
+constexpr bool is_raw_v = std::is_trivially_copyable<T>::value;
+
+template <class Sink, class T>
+void encode(Sink& sink, const T& value);
+
+template <class Sink, class T, std::size_t... Is>
+void encode_tuple(Sink& sink, const T& value, std::index_sequence<Is...>) {
+  using std::get;
+  (encode(sink, get<Is>(value)), ...);
+}
+
+template <class Sink, class T>
+void encode(Sink& sink, const T& value) {
+  if constexpr (is_raw_v<T>) {
+    sink.write(&value, sizeof(T));
+  } else if constexpr (is_mystl_vector<T>::value) {
+    const std::uint64_t n = value.size();
+    sink.write(&n, sizeof(n));
+    if constexpr (is_raw_v<typename T::value_type>) {
+      sink.write(value.data(), n * sizeof(typename T::value_type));
+    } else {
+      for (const auto& elem : value) {
+        encode(sink, elem);
+      }
+    }
+  } else {
+    static_assert(is_tuple_like<T>::value,
+                  "mystl::serialize: unsupported element type");
+    encode_tuple(sink, value,
+                 std::make_index_sequence<std::tuple_size<T>::value>{});
+  }
+}
+
+// 一个元素编码后至少占用的字节数，用来在分配之前检查头部里的 length
+template <class T>
+constexpr std::size_t min_encoded_size();
+
+template <class T, std::size_t... Is>
+constexpr std::size_t min_encoded_tuple_size(std::index_sequence<Is...>) {
+  return (std::size_t(0) + ... +
+          min_encoded_size<typename std::tuple_element<Is, T>::type>());
+}
+
+template <class T>
+constexpr std::size_t min_encoded_size() {
+  if constexpr (is_raw_v<T>) {
+    return sizeof(T);
+  } else if constexpr (is_mystl_vector<T>::value) {
+    return sizeof(std::uint64_t);
+  } else {
+    return min_encoded_tuple_size<T>(
+        std::make_index_sequence<std::tuple_size<T>::value>{});
+  }
+}
+
+// length 个至少 elem_bytes 字节的元素能否放进 bytes 字节的 payload，不会溢出
+constexpr bool length_fits(std::uint64_t length, std::size_t elem_bytes,
+                           std::uint64_t bytes) {
+  return elem_bytes == 0 || length <= bytes / elem_bytes;
+}
+
+// budget 是 payload 中剩余的字节数，读取前检查，容器长度也按它限制，
+// 损坏的长度不会导致巨大的分配
+inline void take_budget(std::uint64_t& budget, std::uint64_t n) {
+  if (n > budget) {
+    throw serialization_error("mystl::deserialize: corrupted payload size");
+  }
+  budget -= n;
+}
+
+template <class Source, class T>
+void decode(Source& source, T& value, std::uint64_t& budget);
+
+template <class Source, class T, std::size_t... Is>
+void decode_tuple(Source& source, T& value, std::uint64_t& budget,
+                  std::index_sequence<Is...>) {
+  using std::get;
+  (decode(source, get<Is>(value), budget), ...);
+}
+
+template <class Source, class T>
+void decode(Source& source, T& value, std::uint64_t& budget) {
+  if constexpr (is_raw_v<T>) {
+    take_budget(budget, sizeof(T));
+    source.read(&value, sizeof(T));
+  } else if constexpr (is_mystl_vector<T>::value) {
+    using E = typename T::value_type;
+    std::uint64_t n = 0;
+    take_budget(budget, sizeof(n));
+    source.read(&n, sizeof(n));
+    if (!length_fits(n, min_encoded_size<E>(), budget)) {
+      throw serialization_error("mystl::deserialize: corrupted vector length");
+    }
+    T tmp(static_cast<typename T::size_type>(n));
+    if constexpr (is_raw_v<E>) {
+      take_budget(budget, n * sizeof(E));
+      source.read(tmp.data(), n * sizeof(E));
+    } else {
+      for (auto& elem : tmp) {
+        decode(source, elem, budget);
+      }
+    }
+    value.swap(tmp);
+  } else {
+    static_assert(is_tuple_like<T>::value,
+                  "mystl::deserialize: unsupported element type");
+    decode_tuple(source, value, budget,
+                 std::make_index_sequence<std::tuple_size<T>::value>{});
+  }
+}
+
+//===========================================================
+//=================  top-level layout  ======================
+//===========================================================
+// 顶层对象的元素类型：vector/array 取 value_type，其余类型自身就是一个元素
+template <class T, class = void>
+struct top_level_element {
+  using type = T;
+  static constexpr bool is_container = false;
+};
+
+template <class T>
+struct top_level_element<
+    T, std::enable_if_t<is_mystl_vector<T>::value || is_mystl_array<T>::value>> {
+  using type = typename T::value_type;
+  static constexpr bool is_container = true;
+};
+
+constexpr std::size_t align_up(std::size_t n, std::size_t align) {
+  return (n + align - 1) / align * align;
+}
+
+template <class T>
+constexpr std::size_t payload_alignment() {
+  using E = typename top_level_element<T>::type;
+  return is_raw_v<E> && alignof(E) > 8 ? alignof(E) : 8;
+}
+
+template <class T>
+constexpr std::size_t payload_offset() {
+  return align_up(sizeof(serial_header), payload_alignment<T>());
+}
+
+inline const unsigned char zero_padding[256] = {};
+
+template <class T, class Source>
+serial_header read_header(Source& source) {
+  serial_header h;
+  source.read(&h, sizeof(h));
+  if (h.magic != serial_header::kMagic) {
+    throw serialization_error("mystl::deserialize: bad magic");
+  }
+  if (h.version != serial_header::kVersion) {
+    throw serialization_error("mystl::deserialize: unsupported version");
+  }
+  if (h.fingerprint != type_fingerprint<T>::value) {
+    throw serialization_error("mystl::deserialize: type fingerprint mismatch");
+  }
+  if (h.alignment != payload_alignment<T>()) {
+    throw serialization_error("mystl::deserialize: alignment mismatch");
+  }
+  return h;
+}
+}  // namespace detail
+
+//===========================================================
+//=================  public interface  ======================
+//===========================================================
+// 序列化后的总字节数（包括头部和对齐填充）
+template <class T>
+std::size_t serialized_size(const T& value) {
+  using E = typename detail::top_level_element<T>::type;
+  std::size_t payload = 0;
+  if constexpr (detail::is_raw_v<E> &&
+                detail::top_level_element<T>::is_container) {
+    payload = value.size() * sizeof(E);
+  } else if constexpr (detail::is_raw_v<T>) {
+    payload = sizeof(T);
+  } else {
+    detail::counting_sink counter;
+    if constexpr (detail::top_level_element<T>::is_container) {
+      for (const auto& elem : value) {
+        detail::encode(counter, elem);
+      }
+    } else {
+      detail::encode(counter, value);
+    }
+    payload = counter.bytes;
+  }
+  return detail::align_up(detail::payload_offset<T>() + payload, 8);
+}
+
+template <class T>
+void serialize(std::ostream& os, const T& value) {
+  using E = typename detail::top_level_element<T>::type;
+  constexpr bool container = detail::top_level_element<T>::is_container;
+  constexpr bool raw = container ? detail::is_raw_v<E> : detail::is_raw_v<T>;
+
+  serial_header h{};
+  h.magic = serial_header::kMagic;
+  h.version = serial_header::kVersion;
+  h.flags = raw ? serial_header::kRaw : 0;
+  h.alignment = std::uint32_t(detail::payload_alignment<T>());
+  h.elem_size = raw ? std::uint32_t(sizeof(E)) : 0;
+  h.fingerprint = detail::type_fingerprint<T>::value;
+  if constexpr (container) {
+    h.length = value.size();
+  } else {
+    h.length = 1;
+  }
+  const std::size_t total = serialized_size(value);
+  h.bytes = total - detail::payload_offset<T>();
+
+  detail::stream_sink sink{os};
+  sink.write(&h, sizeof(h));
+  sink.write(detail::zero_padding,
+             detail::payload_offset<T>() - sizeof(serial_header));
+  std::size_t written = 0;
+  if constexpr (raw && container) {
+    // 整块写出
+    written = value.size() * sizeof(E);
+    sink.write(value.data(), written);
+  } else if constexpr (raw) {
+    written = sizeof(T);
+    sink.write(&value, written);
+  } else {
+    detail::counting_sink counter;
+    if constexpr (container) {
+      for (const auto& elem : value) {
+        detail::encode(counter, elem);
+        detail::encode(sink, elem);
+      }
+    } else {
+      detail::encode(counter, value);
+      detail::encode(sink, value);
+    }
+    written = counter.bytes;
+  }
+  // 尾部填充到 8 字节，使紧随其后的下一个对象头部仍然对齐
+  sink.write(detail::zero_padding, h.bytes - written);
+}
+
+namespace detail {
+template <class T, class Source>
+T deserialize_from(Source& source) {
+  using E = typename top_level_element<T>::type;
+  constexpr bool container = top_level_element<T>::is_container;
+  constexpr bool raw = container ? is_raw_v<E> : is_raw_v<T>;
+
+  const serial_header h = read_header<T>(source);
+  if (bool(h.flags & serial_header::kRaw) != raw ||
+      h.elem_size != (raw ? sizeof(E) : 0)) {
+    throw serialization_error("mystl::deserialize: encoding mismatch");
+  }
+  source.skip(payload_offset<T>() - sizeof(serial_header));
+  // 先用头部检查 bytes 和 length，避免按损坏的 length 分配内存
+  source.require(h.bytes);
+  if (!length_fits(h.length, min_encoded_size<E>(), h.bytes)) {
+    throw serialization_error("mystl::deserialize: corrupted header");
+  }
+
+  T value{};
+  std::size_t consumed = 0;
+  if constexpr (is_mystl_array<T>::value) {
+    if (h.length != value.size()) {
+      throw serialization_error("mystl::deserialize: array length mismatch");
+    }
+  }
+  if constexpr (raw && is_mystl_vector<T>::value) {
+    T tmp(static_cast<typename T::size_type>(h.length));
+    consumed = h.length * sizeof(E);
+    source.read(tmp.data(), consumed);
+    value.swap(tmp);
+  } else if constexpr (raw) {
+    consumed = sizeof(T);
+    source.read(&value, consumed);
+  } else {
+    std::uint64_t budget = h.bytes;
+    if constexpr (is_mystl_vector<T>::value) {
+      T tmp(static_cast<typename T::size_type>(h.length));
+      for (auto& elem : tmp) {
+        decode(source, elem, budget);
+      }
+      value.swap(tmp);
+    } else if constexpr (container) {
+      for (auto& elem : value) {
+        decode(source, elem, budget);
+      }
+    } else {
+      decode(source, value, budget);
+    }
+    consumed = h.bytes - budget;
+  }
+  if (consumed > h.bytes) {
+    throw serialization_error("mystl::deserialize: corrupted payload size");
+  }
+  source.skip(h.bytes - consumed);
+  return value;
+}
+}  // namespace detail
+
+// 从流中读取一个对象（拷贝）
+template <class T>
+T deserialize(std::istream& is) {
+  detail::stream_source source{is};
+  return detail::deserialize_from<T>(source);
+}
+
+// 从内存缓冲区中读取一个对象（拷贝），consumed 返回该对象占用的字节数
+template <class T>
+T deserialize(const void* buffer, std::size_t size,
+              std::size_t* consumed = nullptr) {
+  detail::buffer_source source{static_cast<const unsigned char*>(buffer), size};
+  T value = detail::deserialize_from<T>(source);
+  if (consumed != nullptr) {
+    *consumed = size - source.left;
+  }
+  return value;
+}
+
+/*
+ * 零拷贝读取：返回指向 buffer 内部的 span，buffer 必须比返回的 span 活得更久。
+ * 只支持元素 trivially copyable 的 vector / array，payload 地址必须满足
+ * 元素的对齐要求（mmap 得到的缓冲区按页对齐，写入时也保证了对象按 8 字节对齐）。
+ */
+template <class Container>
+mystl::span<const typename Container::value_type> deserialize_view(
+    const void* buffer, std::size_t size, std::size_t* consumed = nullptr) {
+  using E = typename Container::value_type;
+  static_assert(detail::is_mystl_vector<Container>::value ||
+                    detail::is_mystl_array<Container>::value,
+                "deserialize_view: Container must be mystl::vector or "
+                "mystl::array");
+  static_assert(detail::is_raw_v<E>,
+                "deserialize_view: elements must be trivially copyable");
+
+  detail::buffer_source source{static_cast<const unsigned char*>(buffer), size};
+  const serial_header h = detail::read_header<Container>(source);
+  if (!(h.flags & serial_header::kRaw) || h.elem_size != sizeof(E)) {
+    throw serialization_error("mystl::deserialize_view: not a raw block");
+  }
+  source.skip(detail::payload_offset<Container>() - sizeof(serial_header));
+  if (!detail::length_fits(h.length, sizeof(E), h.bytes)) {
+    throw serialization_error("mystl::deserialize_view: corrupted header");
+  }
+  const unsigned char* payload = source.take(h.bytes);
+  if (reinterpret_cast<std::uintptr_t>(payload) % alignof(E) != 0) {
+    throw serialization_error("mystl::deserialize_view: misaligned buffer");
+  }
+  if (consumed != nullptr) {
+    *consumed = size - source.left;
+  }
+  return mystl::span<const E>(reinterpret_cast<const E*>(payload),
+                              std::size_t(h.length));
+}
+}  // namespace mystl
+
+#endif  // __MYSTL_SERIALIZATION_H__
@@ -0,0 +1,299 @@
+#ifndef __MYSTL_SORTING_NETWORK_H__
+#define __MYSTL_SORTING_NETWORK_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>  // for std::less, std::greater
+#include <type_traits>
+#include <utility>
+#include "mystl/type_traits.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace mystl {
+/*
+ * 排序网络：固定顺序的比较交换（compare-exchange）序列，与输入的数据无关。
+ *
+ * 网络在编译期由 N 生成（Batcher 奇偶归并排序），然后用 index_sequence
+ * 把所有比较器展开成一串直线代码，没有循环也没有依赖数据的分支：
+ * 算术类型的比较交换编译成掩码选择或 cmov，对 8~16 个元素的小数组
+ * 比 std::sort（插入排序 + 分支预测失败）快得多。
+ *
+ * 只需要第 K 个元素（中位数等）时，从输出端反向裁剪掉不影响第 K 根线的比较器，
+ * 得到更短的选择网络。
+ *
+ * 这里只提供基于指针的实现，mystl::array 上的 sort / nth_element / median 等见 array.h。
+ */
+
+// 超过这个长度时网络的比较次数（O(N log^2 N)）不再划算
+constexpr std::size_t kSortingNetworkMaxSize = 32;
+
+struct network_comparator {
+  std::uint8_t i;  // 较小的值放到 i
+  std::uint8_t j;  // 较大的值放到 j，i < j
+};
+
+namespace detail {
+// Batcher 奇偶归并排序，适用于任意 n（不要求 2 的幂）
+// visit(i, j) 对每个比较器调用一次，返回比较器个数
+template <class Visit>
+constexpr std::size_t batcher_network(std::size_t n, Visit visit) {
+  std::size_t count = 0;
+  for (std::size_t p = 1; p < n; p <<= 1) {
+    for (std::size_t k = p; k >= 1; k >>= 1) {
+      for (std::size_t j = k % p; j + k < n; j += 2 * k) {
+        for (std::size_t i = 0; i < k && i + j + k < n; ++i) {
+          if ((i + j) / (2 * p) == (i + j + k) / (2 * p)) {
+            visit(i + j, i + j + k);
+            ++count;
+          }
+        }
+      }
+    }
+  }
+  return count;
+}
+
+struct network_ignore {
+  constexpr void operator()(std::size_t, std::size_t) const noexcept {}
+};
+
+template <std::size_t N>
+struct network_storage {
+  network_comparator data[N == 0 ? 1 : N];
+};
+
+template <std::size_t N>
+struct network_mask {
+  bool data[N == 0 ? 1 : N];
+};
+
+template <std::size_t N>
+struct sorting_network {
+  static_assert(N <= kSortingNetworkMaxSize, "sorting network is too large");
+
+  static constexpr std::size_t width = N;  // 线的条数
+  static constexpr std::size_t size =
+      batcher_network(N, network_ignore());
+
+  static constexpr network_storage<size> make() {
+    network_storage<size> net{};
+    std::size_t k = 0;
+    batcher_network(N, [&](std::size_t i, std::size_t j) {
+      net.data[k++] = network_comparator{std::uint8_t(i), std::uint8_t(j)};
+    });
+    return net;
+  }
+
+  static constexpr network_storage<size> comparators = make();
+};
+
+// 只保留会影响第 K 根线最终结果的比较器
+template <std::size_t N, std::size_t K>
+struct selection_network {
+  static_assert(K < N, "selection index out of range");
+
+  using full = sorting_network<N>;
+
+  static constexpr std::size_t width = N;
+
+  // 第 c 个比较器是否需要保留，从输出端反向传播依赖
+  static constexpr network_mask<full::size> mark() {
+    network_mask<full::size> keep{};
+    bool needed[N] = {};
+    needed[K] = true;
+    for (std::size_t c = full::size; c > 0; --c) {
+      const network_comparator cmp = full::comparators.data[c - 1];
+      if (needed[cmp.i] || needed[cmp.j]) {
+        needed[cmp.i] = needed[cmp.j] = true;
+        keep.data[c - 1] = true;
+      }
+    }
+    return keep;
+  }
+
+  static constexpr std::size_t count() {
+    constexpr network_mask<full::size> keep = mark();
+    std::size_t n = 0;
+    for (std::size_t c = 0; c < full::size; ++c) {
+      n += keep.data[c] ? 1 : 0;
+    }
+    return n;
+  }
+
+  static constexpr std::size_t size = count();
+
+  static constexpr network_storage<size> make() {
+    constexpr network_mask<full::size> keep = mark();
+    network_storage<size> net{};
+    std::size_t k = 0;
+    for (std::size_t c = 0; c < full::size; ++c) {
+      if (keep.data[c]) {
+        net.data[k++] = full::comparators.data[c];
+      }
+    }
+    return net;
+  }
+
+  static constexpr network_storage<size> comparators = make();
+};
+
+// 可以用条件选择代替交换的类型：不会分支，编译成掩码选择或 cmov
+template <class T>
+struct network_selectable
+    : std::integral_constant<bool, std::is_arithmetic<T>::value ||
+                                       std::is_pointer<T>::value> {};
+
+// 比较器是 std::less / std::greater 时，浮点数的比较交换可以直接用 SSE 比较掩码
+template <class T, class Compare>
+struct network_is_less
+    : std::integral_constant<bool,
+                             std::is_same<Compare, std::less<T>>::value ||
+                                 std::is_same<Compare, std::less<>>::value> {};
+
+template <class T, class Compare>
+struct network_is_greater
+    : std::integral_constant<bool,
+                             std::is_same<Compare, std::greater<T>>::value ||
+                                 std::is_same<Compare, std::greater<>>::value> {
+};
+
+#if defined(__SSE2__)
+// 浮点数在 std::less / std::greater 下的比较交换：一次比较得到掩码，再按掩码异或交换，
+// 两个输出共用同一个条件，也没有分支。
+// 不用 minss / maxss：GCC 常量折叠它们时不保留 NaN 的操作数顺序语义，
+// 而用标量的条件选择时，共用一个条件的两个选择会被编译成分支
+template <class T>
+struct network_sse_traits;
+
+template <>
+struct network_sse_traits<float> {
+  using vec = __m128;
+  static vec load(const float* p) { return _mm_load_ss(p); }
+  static void store(float* p, vec v) { _mm_store_ss(p, v); }
+  static vec less(vec x, vec y) { return _mm_cmplt_ss(x, y); }
+  static vec select_diff(vec x, vec y, vec mask) {
+    return _mm_and_ps(_mm_xor_ps(x, y), mask);
+  }
+  static vec flip(vec x, vec diff) { return _mm_xor_ps(x, diff); }
+};
+
+template <>
+struct network_sse_traits<double> {
+  using vec = __m128d;
+  static vec load(const double* p) { return _mm_load_sd(p); }
+  static void store(double* p, vec v) { _mm_store_sd(p, v); }
+  static vec less(vec x, vec y) { return _mm_cmplt_sd(x, y); }
+  static vec select_diff(vec x, vec y, vec mask) {
+    return _mm_and_pd(_mm_xor_pd(x, y), mask);
+  }
+  static vec flip(vec x, vec diff) { return _mm_xor_pd(x, diff); }
+};
+
+template <class T, class Compare>
+struct network_use_sse
+    : std::integral_constant<bool, (std::is_same<T, float>::value ||
+                                    std::is_same<T, double>::value) &&
+                                       (network_is_less<T, Compare>::value ||
+                                        network_is_greater<T, Compare>::value)> {
+};
+
+template <class T, bool Less>
+inline void network_compare_exchange_sse(
+    typename network_sse_traits<T>::vec& a,
+    typename network_sse_traits<T>::vec& b) {
+  using traits = network_sse_traits<T>;
+  const auto mask = Less ? traits::less(b, a) : traits::less(a, b);
+  const auto diff = traits::select_diff(a, b, mask);
+  a = traits::flip(a, diff);
+  b = traits::flip(b, diff);
+}
+
+// 整个网络期间元素都留在 SSE 寄存器里，只在开头加载、结尾写回一次
+template <class Network, class T, bool Less, std::size_t... Is,
+          std::size_t... Cs>
+inline void apply_network_sse(T* p, std::index_sequence<Is...>,
+                              std::index_sequence<Cs...>) {
+  using traits = network_sse_traits<T>;
+  typename traits::vec v[sizeof...(Is)] = {traits::load(p + Is)...};
+  (network_compare_exchange_sse<T, Less>(v[Network::comparators.data[Cs].i],
+                                         v[Network::comparators.data[Cs].j]),
+   ...);
+  (traits::store(p + Is, v[Is]), ...);
+}
+#endif
+
+template <class T, class Compare>
+constexpr void compare_exchange(T& a, T& b, Compare& comp) {
+  if constexpr (network_selectable<T>::value) {
+    // 两个输出都由同一次 comp(y, x) 决定，等价但不相同的值（-0.0 和 +0.0、NaN、
+    // 自定义比较器下相等的元素）不会丢失，输出总是输入的一个排列。
+    // 整数和指针编译成 cmov；默认比较器下的浮点数由 apply_network_sse 处理
+    const T x = a;
+    const T y = b;
+    const bool swap_needed = comp(y, x);
+    a = swap_needed ? y : x;
+    b = swap_needed ? x : y;
+  } else {
+    if (comp(b, a)) {
+      if (mystl::is_constant_evaluated()) {
+        T tmp = std::move(a);
+        a = std::move(b);
+        b = std::move(tmp);
+      } else {
+        using std::swap;
+        swap(a, b);
+      }
+    }
+  }
+}
+
+template <class Network, class T, class Compare, std::size_t... Cs>
+constexpr void apply_network(T* p, Compare& comp, std::index_sequence<Cs...>) {
+  (void)p;  // N = 1 时比较器为空
+  (void)comp;
+#if defined(__SSE2__)
+  if constexpr (network_use_sse<T, Compare>::value && Network::width > 1) {
+    if (!mystl::is_constant_evaluated()) {
+      apply_network_sse<Network, T, network_is_less<T, Compare>::value>(
+          p, std::make_index_sequence<Network::width>(),
+          std::index_sequence<Cs...>());
+      return;
+    }
+  }
+#endif
+  (compare_exchange(p[Network::comparators.data[Cs].i],
+                    p[Network::comparators.data[Cs].j], comp),
+   ...);
+}
+}  // namespace detail
+
+// 对 [p, p + N) 排序
+template <std::size_t N, class T, class Compare>
+constexpr void network_sort(T* p, Compare comp) {
+  using net = detail::sorting_network<N>;
+  detail::apply_network<net>(p, comp, std::make_index_sequence<net::size>());
+}
+
+// 把排序后位于第 K 个位置的元素放到 p[K]，其余元素的顺序不确定
+template <std::size_t N, std::size_t K, class T, class Compare>
+constexpr void network_select(T* p, Compare comp) {
+  using net = detail::selection_network<N, K>;
+  detail::apply_network<net>(p, comp, std::make_index_sequence<net::size>());
+}
+
+// 网络中比较器的个数
+template <std::size_t N>
+constexpr std::size_t sorting_network_size() noexcept {
+  return detail::sorting_network<N>::size;
+}
+
+template <std::size_t N, std::size_t K>
+constexpr std::size_t selection_network_size() noexcept {
+  return detail::selection_network<N, K>::size;
+}
+}  // namespace mystl
+
+#endif  // __MYSTL_SORTING_NETWORK_H__
@@ -0,0 +1,87 @@
+#ifndef __MYSTL_SPAN_H__
+#define __MYSTL_SPAN_H__
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace mystl {
+
+// span: 一段连续内存的非拥有视图，C++20 std::span 的简化版本（只支持动态长度）
+template <class T>
+class span {
+ public:
+  // member type
+  using element_type = T;
+  using value_type = typename std::remove_cv<T>::type;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using pointer = T*;
+  using const_pointer = const T*;
+  using reference = T&;
+  using const_reference = const T&;
+  using iterator = T*;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+
+ private:
+  pointer ptr{nullptr};
+  size_type count{0};
+
+ public:
+  constexpr span() noexcept = default;
+
+  constexpr span(pointer p, size_type n) noexcept : ptr(p), count(n) {}
+
+  constexpr span(pointer first, pointer last) noexcept
+      : ptr(first), count(size_type(last - first)) {}
+
+  template <std::size_t N>
+  constexpr span(T (&arr)[N]) noexcept : ptr(arr), count(N) {}
+
+  // span<T> 可以隐式转换为 span<const T>
+  template <class U, typename = typename std::enable_if<std::is_convertible<
+                         U (*)[], T (*)[]>::value>::type>
+  constexpr span(const span<U>& other) noexcept
+      : ptr(other.data()), count(other.size()) {}
+
+  constexpr pointer data() const noexcept { return ptr; }
+
+  constexpr size_type size() const noexcept { return count; }
+
+  constexpr size_type size_bytes() const noexcept { return count * sizeof(T); }
+
+  constexpr bool empty() const noexcept { return count == 0; }
+
+  constexpr reference operator[](size_type pos) const { return ptr[pos]; }
+
+  constexpr reference front() const { return ptr[0]; }
+
+  constexpr reference back() const { return ptr[count - 1]; }
+
+  constexpr iterator begin() const noexcept { return ptr; }
+
+  constexpr iterator end() const noexcept { return ptr + count; }
+
+  constexpr reverse_iterator rbegin() const noexcept {
+    return reverse_iterator(end());
+  }
+
+  constexpr reverse_iterator rend() const noexcept {
+    return reverse_iterator(begin());
+  }
+
+  constexpr span first(size_type n) const { return span(ptr, n); }
+
+  constexpr span last(size_type n) const { return span(ptr + count - n, n); }
+
+  constexpr span subspan(size_type offset) const {
+    return span(ptr + offset, count - offset);
+  }
+
+  constexpr span subspan(size_type offset, size_type n) const {
+    return span(ptr + offset, n);
+  }
+};
+}  // namespace mystl
+
+#endif  // __MYSTL_SPAN_H__
@@ -0,0 +1,169 @@
+#ifndef __MYSTL_SPSC_QUEUE_H__
+#define __MYSTL_SPSC_QUEUE_H__
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include "mystl/array.h"
+
+// 缓存行大小，用来把不同线程写的数据隔开，避免伪共享
+#ifndef MYSTL_CACHE_LINE_SIZE
+#define MYSTL_CACHE_LINE_SIZE 64
+#endif
+
+namespace mystl {
+/*
+ * spsc_queue<T, N>: 单生产者单消费者的无锁有界队列
+ *
+ * 只有一个线程调用 try_push*，只有一个线程调用 try_pop*。
+ * tail 只由生产者写，head 只由消费者写，各自独占一条缓存行：
+ *
+ *   | tail | cached_head |   <- 生产者的缓存行
+ *   | head | cached_tail |   <- 消费者的缓存行
+ *   | buffer ...         |
+ *
+ * 生产者在本地缓存上一次读到的 head（cached_head），只有在按缓存值看队列已满时
+ * 才重新读取对方的 head；消费者对 tail 同理。队列不满也不空时，
+ * 两个线程几乎不会访问对方的缓存行，一致性流量只剩 buffer 本身。
+ * 批量接口 try_push_n/try_pop_n 每批只发布一次下标。
+ *
+ * N 必须是 2 的幂，head/tail 是只增不减的计数器，全部 N 个槽位都可以使用。
+ */
+template <class T, std::size_t N>
+class spsc_queue {
+  static_assert(N != 0 && (N & (N - 1)) == 0,
+                "spsc_queue capacity must be a power of two");
+  static_assert(std::is_default_constructible<T>::value,
+                "spsc_queue requires a default constructible T");
+
+ public:
+  // member type
+  using value_type = T;
+  using size_type = std::size_t;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+
+  static constexpr size_type kMask = N - 1;
+
+ private:
+  // 生产者
+  alignas(MYSTL_CACHE_LINE_SIZE) std::atomic<size_type> tail{0};
+  size_type cached_head{0};
+  // 消费者
+  alignas(MYSTL_CACHE_LINE_SIZE) std::atomic<size_type> head{0};
+  size_type cached_tail{0};
+  // 数据
+  alignas(MYSTL_CACHE_LINE_SIZE) mystl::array<T, N> buffer{};
+
+  // 生产者：返回最多可以写入的个数（不超过 n）
+  size_type M_free_slots(size_type t, size_type n) {
+    size_type available = N - (t - cached_head);
+    if (available < n) {
+      cached_head = head.load(std::memory_order_acquire);
+      available = N - (t - cached_head);
+    }
+    return available < n ? available : n;
+  }
+
+  // 消费者：返回最多可以读取的个数（不超过 n）
+  size_type M_ready_slots(size_type h, size_type n) {
+    size_type ready = cached_tail - h;
+    if (ready < n) {
+      cached_tail = tail.load(std::memory_order_acquire);
+      ready = cached_tail - h;
+    }
+    return ready < n ? ready : n;
+  }
+
+ public:
+  spsc_queue() = default;
+
+  spsc_queue(const spsc_queue&) = delete;
+  spsc_queue& operator=(const spsc_queue&) = delete;
+
+  static constexpr size_type capacity() noexcept { return N; }
+
+  // 只是一个近似值，另一端的线程可能正在修改
+  size_type size_approx() const noexcept {
+    const size_type h = head.load(std::memory_order_acquire);
+    const size_type t = tail.load(std::memory_order_acquire);
+    return t - h;
+  }
+
+  bool empty_approx() const noexcept { return size_approx() == 0; }
+
+  // --- 生产者 ---
+
+  template <class... Args>
+  bool try_emplace(Args&&... args) {
+    const size_type t = tail.load(std::memory_order_relaxed);
+    if (M_free_slots(t, 1) == 0) {
+      return false;
+    }
+    buffer[t & kMask] = T(std::forward<Args>(args)...);
+    tail.store(t + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool try_push(const T& value) { return try_emplace(value); }
+
+  bool try_push(T&& value) { return try_emplace(std::move(value)); }
+
+  // 拷贝 [src, src + n) 中能放下的部分，返回写入的个数
+  size_type try_push_n(const T* src, size_type n) {
+    const size_type t = tail.load(std::memory_order_relaxed);
+    n = M_free_slots(t, n);
+    for (size_type i = 0; i < n; ++i) {
+      buffer[(t + i) & kMask] = src[i];
+    }
+    if (n != 0) {
+      tail.store(t + n, std::memory_order_release);
+    }
+    return n;
+  }
+
+  // --- 消费者 ---
+
+  bool try_pop(T& out) {
+    const size_type h = head.load(std::memory_order_relaxed);
+    if (M_ready_slots(h, 1) == 0) {
+      return false;
+    }
+    out = std::move(buffer[h & kMask]);
+    head.store(h + 1, std::memory_order_release);
+    return true;
+  }
+
+  // 把最多 n 个元素移动到 dst，返回个数
+  size_type try_pop_n(T* dst, size_type n) {
+    const size_type h = head.load(std::memory_order_relaxed);
+    n = M_ready_slots(h, n);
+    for (size_type i = 0; i < n; ++i) {
+      dst[i] = std::move(buffer[(h + i) & kMask]);
+    }
+    if (n != 0) {
+      head.store(h + n, std::memory_order_release);
+    }
+    return n;
+  }
+
+  // 队首元素，为空时返回 nullptr；配合 pop() 可以原地处理元素而不移动它
+  T* front() {
+    const size_type h = head.load(std::memory_order_relaxed);
+    return M_ready_slots(h, 1) == 0 ? nullptr : &buffer[h & kMask];
+  }
+
+  // 丢弃队首元素，为空时返回 false
+  bool pop() {
+    const size_type h = head.load(std::memory_order_relaxed);
+    if (M_ready_slots(h, 1) == 0) {
+      return false;
+    }
+    head.store(h + 1, std::memory_order_release);
+    return true;
+  }
+};
+}  // namespace mystl
+
+#endif  // __MYSTL_SPSC_QUEUE_H__
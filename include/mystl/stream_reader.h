@@ -0,0 +1,339 @@
+#ifndef __MYSTL_STREAM_READER_H__
+#define __MYSTL_STREAM_READER_H__
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <mutex>
+#include <numeric>  // for std::lcm
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include "mystl/span.h"
+#include "mystl/vector.h"
+
+namespace mystl {
+
+struct stream_options {
+  // 每次 pread 的字节数，会向上取整到 kDirectAlignment 的整数倍
+  std::size_t chunk_size = std::size_t(4) << 20;
+  // 使用 O_DIRECT 绕过页缓存；文件系统不支持时自动退回普通读
+  bool direct_io = false;
+};
+
+/*
+ * chunked_file_reader: 双缓冲的分块顺序读取器
+ *
+ * 后台线程负责 pread，调用线程负责处理（解析）数据，两者之间最多有两个块在途：
+ *
+ *   reader thread:  | read 0 | read 1 | read 2 | read 3 | ...
+ *   caller thread:           | parse 0| parse 1| parse 2| ...
+ *
+ * 处理第 N 块的同时第 N+1 块已经在读，I/O 和计算互相重叠。
+ * 没有使用 io_uring：本库是纯头文件库，不便强制链接 liburing；
+ * 对顺序读来说，一个后台 pread 线程已经能让磁盘保持忙碌。
+ */
+class chunked_file_reader {
+ public:
+  // O_DIRECT 要求缓冲区地址、文件偏移和读取长度都按逻辑块大小对齐
+  static constexpr std::size_t kDirectAlignment = 4096;
+
+ private:
+  int fd{-1};
+  std::size_t file_bytes{0};
+  std::size_t chunk{0};
+  bool direct{false};
+
+  [[noreturn]] static void M_throw_errno(int err, const char* what) {
+    throw std::system_error(err, std::generic_category(), what);
+  }
+
+  struct aligned_buffer {
+    void* ptr{nullptr};
+
+    explicit aligned_buffer(std::size_t n) {
+      if (::posix_memalign(&ptr, kDirectAlignment, n) != 0) {
+        throw std::bad_alloc();
+      }
+    }
+    aligned_buffer(const aligned_buffer&) = delete;
+    aligned_buffer& operator=(const aligned_buffer&) = delete;
+    ~aligned_buffer() { std::free(ptr); }
+
+    unsigned char* get() const { return static_cast<unsigned char*>(ptr); }
+  };
+
+  // 读满一块或者读到文件末尾，返回读到的字节数；失败时返回 errno 的相反数
+  long long M_read_chunk(unsigned char* dst, std::size_t offset) {
+    std::size_t got = 0;
+    while (got < chunk) {
+      ssize_t n = ::pread(fd, dst + got, chunk - got, off_t(offset + got));
+      if (n > 0) {
+        got += std::size_t(n);
+        if (direct && got % kDirectAlignment != 0) {
+          break;  // O_DIRECT 下不足一个块的读取只会发生在文件末尾
+        }
+      } else if (n == 0) {
+        break;
+      } else if (errno == EINTR) {
+        continue;
+      } else if (errno == EINVAL && direct) {
+        // 文件系统不支持 O_DIRECT，退回普通读
+        direct = false;
+        ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) & ~O_DIRECT);
+      } else {
+        return -(long long)errno;
+      }
+    }
+    return (long long)got;
+  }
+
+  /*
+   * target(k) 返回第 k 块的写入地址，consume(k, p, n) 处理已经读入的第 k 块。
+   * 第 k 块与第 k - 2 块共用目标地址时，读取线程会等待第 k - 2 块处理完毕。
+   */
+  template <class Target, class Consume>
+  std::size_t M_pipeline(Target target, Consume consume) {
+    std::mutex m;
+    std::condition_variable cv;
+    std::size_t produced = 0;  // 已经读完的块数
+    std::size_t consumed = 0;  // 已经处理完的块数
+    std::size_t bytes[2] = {0, 0};
+    bool done = false;  // 读取线程已经结束（读到文件末尾或出错）
+    bool stop = false;  // 调用线程出现异常，通知读取线程退出
+    int error = 0;
+
+    std::thread reader([&] {
+      for (std::size_t k = 0;; ++k) {
+        {
+          std::unique_lock<std::mutex> lock(m);
+          cv.wait(lock, [&] { return k - consumed < 2 || stop; });
+          if (stop) {
+            break;
+          }
+        }
+        long long n = M_read_chunk(target(k), k * chunk);
+        {
+          std::lock_guard<std::mutex> lock(m);
+          if (n < 0) {
+            error = int(-n);
+            done = true;
+          } else {
+            bytes[k % 2] = std::size_t(n);
+            produced = k + 1;
+            done = std::size_t(n) < chunk;
+          }
+        }
+        cv.notify_all();
+        if (n < 0 || std::size_t(n) < chunk) {
+          break;
+        }
+      }
+    });
+
+    std::size_t total = 0;
+    try {
+      for (std::size_t k = 0;; ++k) {
+        std::size_t n = 0;
+        {
+          std::unique_lock<std::mutex> lock(m);
+          cv.wait(lock, [&] { return produced > k || done; });
+          if (produced <= k) {
+            break;  // 出错，或者上一块恰好读到文件末尾
+          }
+          n = bytes[k % 2];
+        }
+        if (n != 0) {
+          consume(k, target(k), n);
+          total += n;
+        }
+        {
+          std::lock_guard<std::mutex> lock(m);
+          consumed = k + 1;
+        }
+        cv.notify_all();
+        if (n < chunk) {
+          break;
+        }
+      }
+    } catch (...) {
+      {
+        std::lock_guard<std::mutex> lock(m);
+        stop = true;
+      }
+      cv.notify_all();
+      reader.join();
+      throw;
+    }
+    reader.join();
+    if (error != 0) {
+      M_throw_errno(error, "chunked_file_reader: pread");
+    }
+    return total;
+  }
+
+ public:
+  explicit chunked_file_reader(const std::string& path,
+                               const stream_options& opts = stream_options()) {
+    chunk = (std::max<std::size_t>(opts.chunk_size, 1) + kDirectAlignment -
+             1) /
+            kDirectAlignment * kDirectAlignment;
+    int flags = O_RDONLY | O_CLOEXEC;
+#if defined(O_DIRECT)
+    if (opts.direct_io) {
+      fd = ::open(path.c_str(), flags | O_DIRECT);
+      direct = fd >= 0;
+    }
+#endif
+    if (fd < 0) {
+      fd = ::open(path.c_str(), flags);
+    }
+    if (fd < 0) {
+      M_throw_errno(errno, "chunked_file_reader: open");
+    }
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+      int err = errno;
+      ::close(fd);
+      M_throw_errno(err, "chunked_file_reader: fstat");
+    }
+    file_bytes = std::size_t(st.st_size);
+#if defined(POSIX_FADV_SEQUENTIAL)
+    if (!direct) {
+      ::posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+    }
+#endif
+  }
+
+  chunked_file_reader(const chunked_file_reader&) = delete;
+  chunked_file_reader& operator=(const chunked_file_reader&) = delete;
+
+  ~chunked_file_reader() {
+    if (fd >= 0) {
+      ::close(fd);
+    }
+  }
+
+  // 打开时的文件大小
+  std::size_t size() const noexcept { return file_bytes; }
+
+  std::size_t chunk_size() const noexcept { return chunk; }
+
+  bool direct_io() const noexcept { return direct; }
+
+  // 依次把每一块交给 consume(const unsigned char* data, std::size_t n)，
+  // data 只在回调期间有效；返回读到的总字节数
+  template <class Consumer>
+  std::size_t for_each_chunk(Consumer&& consume) {
+    aligned_buffer buffers[2] = {aligned_buffer(chunk), aligned_buffer(chunk)};
+    return M_pipeline(
+        [&](std::size_t k) { return buffers[k % 2].get(); },
+        [&](std::size_t, const unsigned char* p, std::size_t n) {
+          consume(p, n);
+        });
+  }
+
+  /*
+   * 把整个文件读到 dst 开始的 size() 字节中，每块落地后调用
+   * consume(std::size_t offset, std::size_t n)。
+   * 普通读直接 pread 到 dst 中的最终位置，没有额外拷贝；
+   * O_DIRECT 要求缓冲区按页对齐，所以先读到对齐的中转缓冲区再拷贝过去。
+   */
+  template <class Consumer>
+  std::size_t read_into(unsigned char* dst, Consumer&& consume) {
+    const std::size_t limit = file_bytes;
+    if (direct) {
+      std::size_t offset = 0;
+      for_each_chunk([&](const unsigned char* p, std::size_t n) {
+        // 读取期间文件变长时，只读打开时的长度
+        if (offset >= limit) {
+          return;
+        }
+        n = std::min(n, limit - offset);
+        std::memcpy(dst + offset, p, n);
+        consume(offset, n);
+        offset += n;
+      });
+      return offset;
+    }
+    // 目标区域按块顺序排布，末尾不足一块的部分先读到中转缓冲区，避免越界写
+    aligned_buffer tail(2 * chunk);
+    std::size_t total = 0;
+    M_pipeline(
+        [&](std::size_t k) {
+          return (k + 1) * chunk <= limit ? dst + k * chunk
+                                          : tail.get() + (k % 2) * chunk;
+        },
+        [&](std::size_t k, const unsigned char* p, std::size_t n) {
+          const std::size_t offset = k * chunk;
+          if (offset >= limit) {
+            return;
+          }
+          n = std::min(n, limit - offset);
+          if (p != dst + offset) {
+            std::memcpy(dst + offset, p, n);
+          }
+          consume(offset, n);
+          total += n;
+        });
+    return total;
+  }
+};
+
+/*
+ * 把文件内容追加到 v 的尾部，文件长度必须是 sizeof(T) 的整数倍。
+ * 先一次性 reserve 出足够的容量，然后把数据直接读进未初始化的尾部；
+ * 每读完一块调用 on_chunk(mystl::span<T>)，让解析与下一块的读取重叠。
+ * 返回追加的元素个数；出现异常时 v 恢复原来的长度。
+ */
+template <class T, class Alloc, class Consumer>
+std::size_t read_file_into(const std::string& path, mystl::vector<T, Alloc>& v,
+                           stream_options opts, Consumer&& on_chunk) {
+  static_assert(std::is_trivially_copyable<T>::value,
+                "read_file_into requires a trivially copyable T");
+  // 块边界必须落在元素边界上
+  opts.chunk_size =
+      (opts.chunk_size + sizeof(T) - 1) / sizeof(T) * sizeof(T);
+  opts.chunk_size = std::lcm(
+      std::lcm(opts.chunk_size, chunked_file_reader::kDirectAlignment),
+      sizeof(T));
+  chunked_file_reader reader(path, opts);
+  if (reader.size() % sizeof(T) != 0) {
+    throw std::runtime_error(
+        "read_file_into: file size is not a multiple of sizeof(T)");
+  }
+  const std::size_t old_size = v.size();
+  const std::size_t n = reader.size() / sizeof(T);
+  v.resize(old_size + n, mystl::default_init);
+  try {
+    unsigned char* dst = reinterpret_cast<unsigned char*>(v.data() + old_size);
+    std::size_t got = reader.read_into(
+        dst, [&](std::size_t offset, std::size_t bytes) {
+          on_chunk(mystl::span<T>(v.data() + old_size + offset / sizeof(T),
+                                  bytes / sizeof(T)));
+        });
+    // 读取期间文件被截断时只保留读到的部分
+    v.resize(old_size + got / sizeof(T));
+    return got / sizeof(T);
+  } catch (...) {
+    v.resize(old_size);
+    throw;
+  }
+}
+
+template <class T, class Alloc>
+std::size_t read_file_into(const std::string& path, mystl::vector<T, Alloc>& v,
+                           const stream_options& opts = stream_options()) {
+  return read_file_into(path, v, opts, [](mystl::span<T>) {});
+}
+}  // namespace mystl
+
+#endif  // __MYSTL_STREAM_READER_H__
@@ -1,6 +1,7 @@
 #ifndef __MYSTL_TUPLE_H__
 #define __MYSTL_TUPLE_H__
 
+#include <cstddef>
 #include <initializer_list>
 #include <tuple>
 #include <type_traits>
@@ -11,19 +12,56 @@
 // std::tuple<int, int, int> t1;
 
 namespace mystl {
-// 获取 index 对应的类型
-template <std::size_t Index, class... Types>
-struct NthType;
+/*
+ * NthType<I, Types...>: Types 中第 I 个类型。
+ * 逐个剥掉头部的递归写法对第 I 个类型要实例化 I 层模板，宽 tuple 上的每次
+ * get<I> 都是 O(I) 的编译开销。现在的实现深度与 I 无关：
+ * - 编译器提供 __type_pack_element 时直接使用它
+ * - 否则让 indexed_types 同时继承所有 indexed_type<I, T>，
+ *   用重载决议按 I 推导出唯一的基类，从而得到 T
+ */
+#if defined(__has_builtin)
+#if __has_builtin(__type_pack_element)
+#define MYSTL_HAS_TYPE_PACK_ELEMENT 1
+#endif
+#endif
 
-template <class Head, class... Tail>
-struct NthType<0, Head, Tail...> {
-  using type = Head;
+namespace detail {
+template <std::size_t I, class T>
+struct indexed_type {
+  using type = T;
 };
 
-template <std::size_t Index, class Head, class... Tail>
-struct NthType<Index, Head, Tail...> {
-  using type = typename NthType<Index - 1, Tail...>::type;
+template <class Seq, class... Types>
+struct indexed_types;
+
+template <std::size_t... Is, class... Types>
+struct indexed_types<std::index_sequence<Is...>, Types...>
+    : indexed_type<Is, Types>... {};
+
+// 只用于 decltype，不需要定义
+template <std::size_t I, class T>
+indexed_type<I, T> select_indexed(const indexed_type<I, T>&);
+
+// 下标越界时没有 type 成员，在 SFINAE 中表现为替换失败
+template <bool InRange, std::size_t Index, class... Types>
+struct nth_type {};
+
+template <std::size_t Index, class... Types>
+struct nth_type<true, Index, Types...> {
+#ifdef MYSTL_HAS_TYPE_PACK_ELEMENT
+  using type = __type_pack_element<Index, Types...>;
+#else
+  using type = typename decltype(detail::select_indexed<Index>(
+      std::declval<const indexed_types<std::index_sequence_for<Types...>,
+                                       Types...>&>()))::type;
+#endif
 };
+}  // namespace detail
+
+template <std::size_t Index, class... Types>
+struct NthType
+    : detail::nth_type<(Index < sizeof...(Types)), Index, Types...> {};
 
 template <std::size_t Index, class... Types>
 using NthType_t = typename NthType<Index, Types...>::type;
@@ -61,7 +99,50 @@ static constexpr bool is_unambiguous_conversion_v =
 template <class... Types>
 class tuple;
 
-template <std::size_t I, class T>
+template <class IndexSeqence, class... Types>
+struct TupleImpl;
+
+namespace detail {
+// TupleLeaf 的三种存储方式
+enum class leaf_storage { value, empty_base, reference };
+
+// T 是 tuple 或从 tuple 派生：模板实参推导能从 T* 推出它的 TupleImpl 基类
+template <class IndexSeqence, class... Types>
+std::true_type derives_from_tuple_impl(const TupleImpl<IndexSeqence, Types...>*);
+std::false_type derives_from_tuple_impl(const void*);
+
+template <class T, class = void>
+struct is_tuple_derived : std::false_type {};
+
+template <class T>
+struct is_tuple_derived<T, std::enable_if_t<std::is_class<T>::value>>
+    : decltype(derives_from_tuple_impl(static_cast<T*>(nullptr))) {};
+
+template <class T>
+constexpr leaf_storage leaf_storage_for() {
+  if (std::is_reference<T>::value) {
+    return leaf_storage::reference;
+  }
+  // 空的 tuple 元素不能继承：它的 TupleLeaf<0, E> 等基类会和外层 tuple 的
+  // 同名基类重复，get 时成为有歧义的基类
+  if (std::is_empty<T>::value && !std::is_final<T>::value &&
+      !is_tuple_derived<T>::value) {
+    return leaf_storage::empty_base;
+  }
+  return leaf_storage::value;
+}
+}  // namespace detail
+
+/*
+ * TupleLeaf<I, T>: 存储第 I 个元素。
+ * - 普通类型：保存一个 T 成员，不声明拷贝/移动操作，平凡性由 T 决定，
+ *   tuple 的赋值都是 = default，所以 tuple<int, double> 可以平凡拷贝。
+ * - 非 final 的空类（无状态的函数对象、分配器等）：直接继承 T（空基类优化），
+ *   这个元素不再占用任何字节。嵌套的空 tuple 除外，它按普通成员存储。
+ * - 引用：赋值作用在被引用的对象上（tie 的语义），而不是被删除。
+ */
+template <std::size_t I, class T,
+          detail::leaf_storage = detail::leaf_storage_for<T>()>
 struct TupleLeaf {
   T value{};
   constexpr TupleLeaf() = default;
@@ -103,8 +184,63 @@ struct TupleLeaf {
   }
 };
 
-template <class IndexSeqence, class... Types>
-struct TupleImpl;
+// 空基类优化：私有继承，避免 tuple 隐式转换成 T 或暴露 T 的成员
+template <std::size_t I, class T>
+struct TupleLeaf<I, T, detail::leaf_storage::empty_base> : private T {
+  constexpr TupleLeaf() : T() {}
+
+  template <class U>
+  constexpr TupleLeaf(U&& x) : T(mystl::forward<U>(x)) {}
+
+  constexpr T& get() & noexcept { return static_cast<T&>(*this); }
+
+  constexpr const T& get() const& noexcept {
+    return static_cast<const T&>(*this);
+  }
+
+  constexpr T&& get() && noexcept { return static_cast<T&&>(*this); }
+
+  constexpr const T&& get() const&& noexcept {
+    return static_cast<const T&&>(*this);
+  }
+};
+
+template <std::size_t I, class T>
+struct TupleLeaf<I, T, detail::leaf_storage::reference> {
+  T value;
+
+  template <class U>
+  constexpr TupleLeaf(U&& x) : value(mystl::forward<U>(x)) {}
+
+  TupleLeaf(const TupleLeaf&) = default;
+  TupleLeaf(TupleLeaf&&) = default;
+
+  // 不能赋值时（例如 const int&）参数类型退化成 nonsuch，拷贝/移动赋值随之被删除
+  TupleLeaf& operator=(
+      typename std::conditional<std::is_copy_assignable<T>::value,
+                                const TupleLeaf&, const nonsuch&>::type other) {
+    value = other.value;
+    return *this;
+  }
+
+  TupleLeaf& operator=(
+      typename std::conditional<std::is_move_assignable<T>::value, TupleLeaf&&,
+                                const nonsuch_move&>::type
+          other) noexcept(std::is_nothrow_move_assignable<T>::value) {
+    value = mystl::forward<T>(other.value);
+    return *this;
+  }
+
+  constexpr T& get() & noexcept { return value; }
+
+  constexpr const T& get() const& noexcept { return value; }
+
+  constexpr T&& get() && noexcept { return mystl::forward<T>(value); }
+
+  constexpr const T&& get() const&& noexcept {
+    return mystl::forward<const T>(value);
+  }
+};
 
 template <std::size_t... Is, class... Types>
 struct TupleImpl<std::index_sequence<Is...>, Types...>
@@ -266,23 +402,31 @@ class tuple
   //   assign_from(mystl::move(other), std::make_index_sequence<sizeof...(Types)>{});
   //   return *this;
   // }
-  tuple& operator=(typename std::conditional<
-                   mystl::is_all_true_v<std::is_copy_assignable, Types...>,
-                   const tuple&, const nonsuch&>::type other) {
-    assign_from(other, std::make_index_sequence<sizeof...(Types)>{});
-    return *this;
-  }
-
-  tuple& operator=(
-      typename std::conditional<
-          mystl::is_all_true_v<std::is_move_assignable, Types...>, tuple&&,
-          const nonsuch_move&>::type
-          other) noexcept(mystl::is_all_true_v<std::is_nothrow_move_assignable,
-                                               Types...>) {
-    assign_from(mystl::move(other),
-                std::make_index_sequence<sizeof...(Types)>{});
-    return *this;
-  }
+  // tuple& operator=(typename std::conditional<
+  //                  mystl::is_all_true_v<std::is_copy_assignable, Types...>,
+  //                  const tuple&, const nonsuch&>::type other) {
+  //   assign_from(other, std::make_index_sequence<sizeof...(Types)>{});
+  //   return *this;
+  // }
+  //
+  // tuple& operator=(
+  //     typename std::conditional<
+  //         mystl::is_all_true_v<std::is_move_assignable, Types...>, tuple&&,
+  //         const nonsuch_move&>::type
+  //         other) noexcept(mystl::is_all_true_v<std::is_nothrow_move_assignable,
+  //                                              Types...>) {
+  //   assign_from(mystl::move(other),
+  //               std::make_index_sequence<sizeof...(Types)>{});
+  //   return *this;
+  // }
+  /*
+   * 上面用户提供的赋值运算符是正确的，但会让 tuple<int, int> 失去平凡的拷贝赋值，
+   * 不能 memcpy，也不能用寄存器传递。现在把"能否赋值"下放到 TupleLeaf：
+   * 普通成员的叶子由编译器生成赋值，引用成员的叶子自己实现赋值（nonsuch 技巧同上），
+   * tuple 这里直接 = default，平凡性和可赋值性都从成员传递上来。
+   */
+  tuple& operator=(const tuple& other) = default;
+  tuple& operator=(tuple&& other) = default;
   /*
    * 为了解决上面的问题，下面的修改还是有问题。
    * 看似解决了重载决议的问题，但是由于声明了默认的移动构造函数，编译器不会生成赋值运算符的函数
@@ -434,27 +578,86 @@ mystl::tuple<Types&...> tie(Types&... args) {
 }
 
 //  compare operators
-template <std::size_t I, class... Types, class... UTypes>
-constexpr typename std::enable_if<I == sizeof...(Types), bool>::type
-is_equal_impl(const mystl::tuple<Types...>& lhs,
-              const mystl::tuple<UTypes...>& rhs) {
-  return true;  // 所有元素都已比较完
-}
-
-template <std::size_t I, class... Types, class... UTypes>
-    constexpr typename std::enable_if <
-    I<sizeof...(Types), bool>::type is_equal_impl(
-        const mystl::tuple<Types...>& lhs, const mystl::tuple<UTypes...>& rhs) {
-  if (mystl::get<I>(lhs) != mystl::get<I>(rhs)) {
-    return false;  // 当前元素不相等，返回 false
+/*
+ * 早先的 is_equal_impl<I>/is_less_impl<I> 每个元素递归实例化一层函数模板，
+ * 宽 tuple 的编译时间随宽度明显增长，深递归也会阻碍内联。
+ * 现在用 C++17 折叠表达式在一个函数里展开全部元素，实例化次数与宽度无关。
+ */
+namespace detail {
+template <class... TTypes, class... UTypes, std::size_t... Is>
+bool tuple_equal(const mystl::tuple<TTypes...>& lhs,
+                 const mystl::tuple<UTypes...>& rhs,
+                 std::index_sequence<Is...>) {
+  if constexpr ((is_branchless_comparable_v<TTypes, UTypes> && ...)) {
+    // 全是标量：逐个比较后按位与，没有提前退出的分支
+    return (true & ... & bool(mystl::get<Is>(lhs) == mystl::get<Is>(rhs)));
+  } else {
+    return ((mystl::get<Is>(lhs) == mystl::get<Is>(rhs)) && ...);
+  }
+}
+
+template <class... TTypes, class... UTypes, std::size_t... Is>
+int tuple_three_way(const mystl::tuple<TTypes...>& lhs,
+                    const mystl::tuple<UTypes...>& rhs,
+                    std::index_sequence<Is...>) {
+  int c = 0;
+  // || 折叠：遇到第一个不相等的元素就停止
+  (void)((... ||
+          ((c = detail::three_way(mystl::get<Is>(lhs), mystl::get<Is>(rhs))) !=
+           0)));
+  return c;
+}
+
+/*
+ * 全是标量时的 <：从最后一个元素往前
+ *   r = (a[i] < b[i]) | (!(b[i] < a[i]) & r)
+ * 没有分支，也不需要先算出三路结果再和 0 比较。
+ * 用 !(b < a) 而不是 == 判断等价，和逐个比较的字典序一致（NaN 视为等价）
+ */
+template <class... TTypes, class... UTypes, std::size_t... Is>
+bool tuple_less(const mystl::tuple<TTypes...>& lhs,
+                const mystl::tuple<UTypes...>& rhs,
+                std::index_sequence<Is...>) {
+  if constexpr ((is_branchless_comparable_v<TTypes, UTypes> && ...)) {
+    constexpr std::size_t last = sizeof...(Is) - 1;
+    bool r = false;
+    (void)((r = bool(mystl::get<last - Is>(lhs) < mystl::get<last - Is>(rhs)) |
+                (!bool(mystl::get<last - Is>(rhs) <
+                       mystl::get<last - Is>(lhs)) &
+                 r)),
+           ...);
+    return r;
+  } else {
+    // 按声明顺序展开 a < b || (!(b < a) && ...)：a < b 时结果为 true 并停止，
+    // b < a 时结果为 false 并停止，等价时继续比较下一个元素。
+    // 只用 operator<，三路比较（compare()）只给 three_way_compare 用
+    bool r = false;
+    (void)((... ||
+            (bool(mystl::get<Is>(lhs) < mystl::get<Is>(rhs))
+                 ? (r = true)
+                 : bool(mystl::get<Is>(rhs) < mystl::get<Is>(lhs)))));
+    return r;
   }
-  return is_equal_impl<I + 1>(lhs, rhs);  // 递归比较
+}
+}  // namespace detail
+
+// 三路比较，返回值的符号表示大小关系
+template <class... TTypes, class... UTypes>
+int three_way_compare(const mystl::tuple<TTypes...>& lhs,
+                      const mystl::tuple<UTypes...>& rhs) {
+  static_assert(sizeof...(TTypes) == sizeof...(UTypes),
+                "cannot compare tuples of different sizes");
+  return detail::tuple_three_way(
+      lhs, rhs, std::make_index_sequence<sizeof...(TTypes)>{});
 }
 
 template <class... TTypes, class... UTypes>
 bool operator==(const mystl::tuple<TTypes...>& lhs,
                 const mystl::tuple<UTypes...>& rhs) {
-  return is_equal_impl<0>(lhs, rhs);
+  static_assert(sizeof...(TTypes) == sizeof...(UTypes),
+                "cannot compare tuples of different sizes");
+  return detail::tuple_equal(lhs, rhs,
+                             std::make_index_sequence<sizeof...(TTypes)>{});
 }
 
 template <class... TTypes, class... UTypes>
@@ -463,32 +666,13 @@ bool operator!=(const mystl::tuple<TTypes...>& lhs,
   return !(lhs == rhs);
 }
 
-template <std::size_t I, class... Types, class... UTypes>
-constexpr typename std::enable_if<I == sizeof...(Types), bool>::type
-is_less_impl(const mystl::tuple<Types...>& lhs,
-             const mystl::tuple<UTypes...>& rhs) {
-  return false;  // 所有元素都已比较完，lhs 不小于 rhs
-}
-
-template <std::size_t I, class... Types, class... UTypes>
-    constexpr typename std::enable_if <
-    I<sizeof...(Types), bool>::type is_less_impl(
-        const mystl::tuple<Types...>& lhs, const mystl::tuple<UTypes...>& rhs) {
-  if (mystl::get<I>(lhs) < mystl::get<I>(rhs)) {
-    return true;  // 当前元素小于 rhs，返回 true
-  } else if (mystl::get<I>(rhs) < mystl::get<I>(lhs)) {
-    return false;  // 当前元素大于 lhs，返回 false
-  }
-  return is_less_impl<I + 1>(lhs, rhs);  // 递归比较
-}
-
 template <class... TTypes, class... UTypes>
 bool operator<(const mystl::tuple<TTypes...>& lhs,
                const mystl::tuple<UTypes...>& rhs) {
-  if constexpr (sizeof...(TTypes) == 0) {
-    return false;  // 空 tuple 不小于任何 tuple
-  }
-  return is_less_impl<0>(lhs, rhs);
+  static_assert(sizeof...(TTypes) == sizeof...(UTypes),
+                "cannot compare tuples of different sizes");
+  return detail::tuple_less(lhs, rhs,
+                            std::make_index_sequence<sizeof...(TTypes)>{});
 }
 
 template <class... TTypes, class... UTypes>
@@ -515,88 +699,23 @@ mystl::tuple<Types&&...> forward_as_tuple(Types&&... args) noexcept {
   return mystl::tuple<Types&&...>(mystl::forward<Types>(args)...);
 }
 
-// 合并两个 tuple
-template <class T1, class T2>
-struct TupleCatHelper;
-
-template <class... Ts1, class... Ts2>
-struct TupleCatHelper<mystl::tuple<Ts1...>, mystl::tuple<Ts2...>> {
-  using type = mystl::tuple<Ts1..., Ts2...>;
-};
-
-// 递归的合并
-template <class... Tuples>
-struct TupleCatRValue;
-
-template <class Tuple>
-struct TupleCatRValue<Tuple> {
-  using type = Tuple;
-};
-
-template <class Tuple1, class Tuple2, class... Rest>
-struct TupleCatRValue<Tuple1, Tuple2, Rest...> {
-  using type =
-      typename TupleCatRValue<typename TupleCatHelper<Tuple1, Tuple2>::type,
-                              Rest...>::type;
-};
-
-template <class... Tuples>
-using TupleCatRValue_t = typename TupleCatRValue<Tuples...>::type;
-
-// 合并两个 tuple
-template <class Tuple1, class Tuple2, std::size_t... Is1, std::size_t... Is2>
-auto tuple_cat_two_impl(Tuple1&& t1, Tuple2&& t2, std::index_sequence<Is1...>,
-                        std::index_sequence<Is2...>) {
-  using result_type =
-      TupleCatRValue_t<std::decay_t<Tuple1>, std::decay_t<Tuple2>>;
-  return result_type(mystl::get<Is1>(mystl::forward<Tuple1>(t1))...,
-                     mystl::get<Is2>(mystl::forward<Tuple2>(t2))...);
-}
-
-template <class Tuple1, class Tuple2>
-auto tuple_cat_two_impl(Tuple1&& t1, Tuple2&& t2) {
-  return tuple_cat_two_impl(
-      mystl::forward<Tuple1>(t1), mystl::forward<Tuple2>(t2),
-      std::make_index_sequence<std::tuple_size<std::decay_t<Tuple1>>::value>{},
-      std::make_index_sequence<std::tuple_size<std::decay_t<Tuple2>>::value>{});
-}
-
-template <class Tuple>
-auto tuple_cat_impl(Tuple&& tuple) {
-  return mystl::forward<Tuple>(tuple);
-}
-
-// 递归合并多个 tuple
-template <class Tuple1, class Tuple2, class... Rest>
-auto tuple_cat_impl(Tuple1&& t1, Tuple2&& t2, Rest&&... rest) {
-  auto first_two_cat = tuple_cat_two_impl(mystl::forward<Tuple1>(t1),
-                                          mystl::forward<Tuple2>(t2));
-  if constexpr (sizeof...(Rest) == 0) {
-    return first_two_cat;
-  } else {
-    return tuple_cat_impl(mystl::move(first_two_cat),
-                          mystl::forward<Rest>(rest)...);
+// 根据类型获取 Types 中对应的索引，T 不在 Types 中时为 sizeof...(Types)
+namespace detail {
+template <class T, class... Types>
+constexpr std::size_t type_index() noexcept {
+  constexpr bool matches[] = {std::is_same<T, Types>::value..., false};
+  std::size_t i = 0;
+  while (i < sizeof...(Types) && !matches[i]) {
+    ++i;
   }
+  return i;
 }
+}  // namespace detail
 
-// tuple_cat
-template <class... Tuples>
-TupleCatRValue_t<std::decay_t<Tuples>...> tuple_cat(Tuples&&... tuples) {
-  return tuple_cat_impl(mystl::forward<Tuples>(tuples)...);
-}
-
-// 根据类型获取 Types 中对应的索引
+// 两者都只展开一次参数包，不做递归实例化
 template <class T, class... Types>
-struct TypeIndex;
-
-template <class T, class... Tail>
-struct TypeIndex<T, T, Tail...> {
-  static constexpr std::size_t value = 0;
-};
-
-template <class T, class Head, class... Tail>
-struct TypeIndex<T, Head, Tail...> {
-  static constexpr std::size_t value = TypeIndex<T, Tail...>::value + 1;
+struct TypeIndex
+    : std::integral_constant<std::size_t, detail::type_index<T, Types...>()> {
 };
 
 template <class T, class... Types>
@@ -604,21 +723,81 @@ constexpr inline std::size_t TypeIndex_v = TypeIndex<T, Types...>::value;
 
 // 计算 Types 中 T 出现的次数
 template <class T, class... Types>
-struct CountType;
+struct CountType
+    : std::integral_constant<std::size_t,
+                             (std::size_t(0) + ... +
+                              std::size_t(std::is_same<T, Types>::value))> {};
 
-template <class T>
-struct CountType<T> {
-  static constexpr std::size_t value = 0;
+template <class T, class... Types>
+constexpr inline std::size_t CountType_v = CountType<T, Types...>::value;
+
+/*
+ * tuple_cat: 一次完成合并。
+ * 以前每次合并两个 tuple，N 个 tuple 要 N - 1 层实例化，
+ * 中间结果还会把前面的元素反复移动。现在先在编译期算出结果中第 k 个元素
+ * 来自第 outer(k) 个参数的第 inner(k) 个元素，再直接构造结果，
+ * 每个元素只被拷贝或移动一次。
+ */
+namespace detail {
+template <class... Tuples>
+struct tuple_cat_index {
+  // 末尾的 0 使空参数包也能定义数组
+  static constexpr std::size_t sizes[] = {std::tuple_size<Tuples>::value...,
+                                          0};
+  static constexpr std::size_t total =
+      (std::size_t(0) + ... + std::tuple_size<Tuples>::value);
+
+  static constexpr std::size_t outer(std::size_t k) noexcept {
+    std::size_t i = 0;
+    while (k >= sizes[i]) {
+      k -= sizes[i];
+      ++i;
+    }
+    return i;
+  }
+
+  static constexpr std::size_t inner(std::size_t k) noexcept {
+    std::size_t i = 0;
+    while (k >= sizes[i]) {
+      k -= sizes[i];
+      ++i;
+    }
+    return k;
+  }
 };
 
-template <class T, class Head, class... Tail>
-struct CountType<T, Head, Tail...> {
-  static constexpr std::size_t value =
-      (std::is_same<T, Head>::value ? 1 : 0) + CountType<T, Tail...>::value;
+template <class Seq, class... Tuples>
+struct tuple_cat_result;
+
+template <std::size_t... Ks, class... Tuples>
+struct tuple_cat_result<std::index_sequence<Ks...>, Tuples...> {
+  using index = tuple_cat_index<Tuples...>;
+  using type = mystl::tuple<typename std::tuple_element<
+      index::inner(Ks), NthType_t<index::outer(Ks), Tuples...>>::type...>;
 };
 
-template <class T, class... Types>
-constexpr inline std::size_t CountType_v = CountType<T, Types...>::value;
+template <class... Tuples>
+using tuple_cat_result_t = typename tuple_cat_result<
+    std::make_index_sequence<tuple_cat_index<Tuples...>::total>,
+    Tuples...>::type;
+
+// args 是 forward_as_tuple 得到的引用元组，保留了每个参数的值类别
+template <class Result, class Index, std::size_t... Ks, class ArgTuple>
+Result tuple_cat_impl(std::index_sequence<Ks...>, ArgTuple&& args) {
+  return Result(mystl::get<Index::inner(Ks)>(
+      mystl::get<Index::outer(Ks)>(mystl::forward<ArgTuple>(args)))...);
+}
+}  // namespace detail
+
+template <class... Tuples>
+detail::tuple_cat_result_t<std::decay_t<Tuples>...> tuple_cat(
+    Tuples&&... tuples) {
+  using index = detail::tuple_cat_index<std::decay_t<Tuples>...>;
+  return detail::tuple_cat_impl<
+      detail::tuple_cat_result_t<std::decay_t<Tuples>...>, index>(
+      std::make_index_sequence<index::total>{},
+      mystl::forward_as_tuple(mystl::forward<Tuples>(tuples)...));
+}
 
 template <std::size_t I, class... Types>
 typename std::tuple_element<I, mystl::tuple<Types...>>::type& get(
@@ -696,20 +875,156 @@ constexpr const T&& get(const mystl::tuple<Types...>&& t) noexcept {
   return static_cast<const LeafType&&>(t).get();
 }
 
+/*
+ * apply / make_from_tuple / tuple_for_each / tuple_transform
+ * 适用于任何提供 std::tuple_size 和 get<I> 的类型：mystl::tuple、mystl::pair、
+ * mystl::array（以及 std 的对应类型）。get<I> 不加限定，
+ * 在实例化时通过 ADL 找到参数类型所在命名空间的重载。
+ *
+ * 每个元素都以 get<I>(forward<Tuple>(t)) 的值类别直接传给 f 或构造函数：
+ * 左值 tuple 传左值引用，右值 tuple 传右值引用，中间不产生任何拷贝或移动。
+ * 这几个函数都只是一层转发，强制内联，避免在 -O0 或深层调用中留下函数调用。
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define MYSTL_ALWAYS_INLINE inline __attribute__((always_inline))
+#elif defined(_MSC_VER)
+#define MYSTL_ALWAYS_INLINE __forceinline
+#else
+#define MYSTL_ALWAYS_INLINE inline
+#endif
+
+namespace detail {
+template <class T>
+struct is_reference_wrapper : std::false_type {};
+
+template <class T>
+struct is_reference_wrapper<std::reference_wrapper<T>> : std::true_type {};
+
+template <class T>
+struct member_pointer_class;
+
+template <class M, class C>
+struct member_pointer_class<M C::*> {
+  using type = C;
+};
+
+// 成员指针作用的对象：C 或其派生类的对象本身、reference_wrapper 里的对象、
+// 或者指针（包括智能指针）指向的对象
+template <class C, class Obj>
+MYSTL_ALWAYS_INLINE constexpr decltype(auto) member_object(Obj&& obj) {
+  if constexpr (std::is_base_of<C, std::decay_t<Obj>>::value) {
+    return mystl::forward<Obj>(obj);
+  } else if constexpr (is_reference_wrapper<std::decay_t<Obj>>::value) {
+    return obj.get();
+  } else {
+    return *mystl::forward<Obj>(obj);
+  }
+}
+
+template <class Pm, class Obj, class... Args>
+MYSTL_ALWAYS_INLINE constexpr decltype(auto) invoke_member(Pm pm, Obj&& obj,
+                                                           Args&&... args) {
+  using C = typename member_pointer_class<Pm>::type;
+  if constexpr (std::is_member_function_pointer<Pm>::value) {
+    return (detail::member_object<C>(mystl::forward<Obj>(obj)).*pm)(
+        mystl::forward<Args>(args)...);
+  } else {
+    static_assert(sizeof...(Args) == 0,
+                  "a data member pointer takes exactly one argument");
+    return (detail::member_object<C>(mystl::forward<Obj>(obj)).*pm);
+  }
+}
+
+// 与 std::invoke 相同的调用规则，但在 C++17 里也是 constexpr，
+// 并且不需要为此引入 <functional>（它会让每个包含 tuple.h 的翻译单元变重）
+template <class F, class... Args>
+MYSTL_ALWAYS_INLINE constexpr decltype(auto) invoke(F&& f, Args&&... args) {
+  if constexpr (std::is_member_pointer<std::decay_t<F>>::value) {
+    return detail::invoke_member(f, mystl::forward<Args>(args)...);
+  } else {
+    return mystl::forward<F>(f)(mystl::forward<Args>(args)...);
+  }
+}
+
+template <class Tuple>
+using tuple_indices =
+    std::make_index_sequence<std::tuple_size<std::decay_t<Tuple>>::value>;
+
+template <class F, class Tuple, std::size_t... Is>
+MYSTL_ALWAYS_INLINE constexpr decltype(auto) apply_impl(
+    F&& f, Tuple&& t, std::index_sequence<Is...>) {
+  return detail::invoke(mystl::forward<F>(f),
+                        get<Is>(mystl::forward<Tuple>(t))...);
+}
+
+template <class T, class Tuple, std::size_t... Is>
+MYSTL_ALWAYS_INLINE constexpr T make_from_tuple_impl(
+    Tuple&& t, std::index_sequence<Is...>) {
+  return T(get<Is>(mystl::forward<Tuple>(t))...);
+}
+
+template <class Tuple, class F, std::size_t... Is>
+MYSTL_ALWAYS_INLINE constexpr void tuple_for_each_impl(
+    Tuple&& t, F& f, std::index_sequence<Is...>) {
+  // 逗号折叠保证从左到右依次调用；转成 void 避免用户重载的逗号运算符
+  ((void)detail::invoke(f, get<Is>(mystl::forward<Tuple>(t))), ...);
+}
+
+template <class Tuple, class F, std::size_t... Is>
+MYSTL_ALWAYS_INLINE constexpr auto tuple_transform_impl(
+    Tuple&& t, F& f, std::index_sequence<Is...>) {
+  using result_type = mystl::tuple<decltype(detail::invoke(
+      f, get<Is>(mystl::forward<Tuple>(t))))...>;
+  // 花括号初始化保证 f 按元素顺序求值
+  return result_type{detail::invoke(f, get<Is>(mystl::forward<Tuple>(t)))...};
+}
+}  // namespace detail
+
+// 以 t 的元素为参数调用 f
+template <class F, class Tuple>
+MYSTL_ALWAYS_INLINE constexpr decltype(auto) apply(F&& f, Tuple&& t) {
+  return detail::apply_impl(mystl::forward<F>(f), mystl::forward<Tuple>(t),
+                            detail::tuple_indices<Tuple>{});
+}
+
+// 以 t 的元素为构造参数构造 T，结果直接在返回值处构造
+template <class T, class Tuple>
+MYSTL_ALWAYS_INLINE constexpr T make_from_tuple(Tuple&& t) {
+  return detail::make_from_tuple_impl<T>(mystl::forward<Tuple>(t),
+                                         detail::tuple_indices<Tuple>{});
+}
+
+// 对 t 的每个元素依次调用 f
+template <class Tuple, class F>
+MYSTL_ALWAYS_INLINE constexpr void tuple_for_each(Tuple&& t, F&& f) {
+  detail::tuple_for_each_impl(mystl::forward<Tuple>(t), f,
+                              detail::tuple_indices<Tuple>{});
+}
+
+// 对 t 的每个元素调用 f，结果组成新的 tuple
+// 元素类型就是 f 的返回类型：返回引用时结果里存的也是引用
+template <class Tuple, class F>
+MYSTL_ALWAYS_INLINE constexpr auto tuple_transform(Tuple&& t, F&& f) {
+  return detail::tuple_transform_impl(mystl::forward<Tuple>(t), f,
+                                      detail::tuple_indices<Tuple>{});
+}
+
 template <class T1, class T2>
 template <class... Args1, class... Args2>
 pair<T1, T2>::pair(std::piecewise_construct_t,
                    mystl::tuple<Args1...> first_args,
                    mystl::tuple<Args2...> second_args)
-    : pair(std::piecewise_construct,
+    : Base(std::piecewise_construct,
            mystl::forward<mystl::tuple<Args1...>>(first_args),
            mystl::forward<mystl::tuple<Args2...>>(second_args),
            std::make_index_sequence<sizeof...(Args1)>{},
            std::make_index_sequence<sizeof...(Args2)>{}) {}
 template <class T1, class T2>
 template <class Tuple1, class Tuple2, std::size_t... Is1, std::size_t... Is2>
-pair<T1, T2>::pair(std::piecewise_construct_t, Tuple1&& tuple1, Tuple2&& tuple2,
-                   std::index_sequence<Is1...>, std::index_sequence<Is2...>)
+detail::pair_storage<T1, T2>::pair_storage(std::piecewise_construct_t,
+                                           Tuple1&& tuple1, Tuple2&& tuple2,
+                                           std::index_sequence<Is1...>,
+                                           std::index_sequence<Is2...>)
     : first(mystl::get<Is1>(mystl::forward<Tuple1>(tuple1))...),
       second(mystl::get<Is2>(mystl::forward<Tuple2>(tuple2))...) {}
 }  // namespace mystl
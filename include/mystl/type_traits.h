@@ -4,6 +4,23 @@
 #include <type_traits>
 
 namespace mystl {
+// is_constant_evaluated: C++20 std::is_constant_evaluated 的 C++17 版本
+// 在常量求值中返回 true，让 constexpr 函数在运行时可以走 SIMD/memcpy 等快速路径
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define MYSTL_HAS_BUILTIN_IS_CONSTANT_EVALUATED 1
+#endif
+#endif
+
+constexpr bool is_constant_evaluated() noexcept {
+#if defined(MYSTL_HAS_BUILTIN_IS_CONSTANT_EVALUATED)
+  return __builtin_is_constant_evaluated();
+#else
+  // 编译器不支持时总是走常量求值也能用的通用实现
+  return true;
+#endif
+}
+
 // is_implicitly_default_constructible
 // impl: 如果 T 支持隐式构造，T v = {} 合法；反之不合法
 // 1. 假设 T 支持隐式默认构造，那么 decltype(test_implicitly_construction<T>({}) = void
@@ -0,0 +1,887 @@
+#ifndef __MYSTL_UNORDERED_FLAT_MAP_H__
+#define __MYSTL_UNORDERED_FLAT_MAP_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>  // for std::equal_to
+#include <initializer_list>
+#include <iterator>
+#include <memory>  // for std::allocator_traits
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "mystl/allocator.h"
+#include "mystl/hash.h"
+#include "mystl/tuple.h"
+#include "mystl/utility.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace mystl {
+namespace detail {
+/*
+ * Swiss table 的控制字节：每个槽位对应一个字节
+ *   0b0xxxxxxx  有元素，低 7 位是哈希值的 H2 部分
+ *   kCtrlEmpty  空槽位，查找遇到它就可以停止
+ *   kCtrlDeleted 墓碑：元素已删除，但查找不能在这里停止
+ * 空和墓碑的最高位都是 1，所以"有元素"就是"字节非负"。
+ */
+using ctrl_t = std::int8_t;
+constexpr ctrl_t kCtrlEmpty = -128;  // 0b10000000
+constexpr ctrl_t kCtrlDeleted = -2;  // 0b11111110
+
+// 一次探测 16 个控制字节
+constexpr std::size_t kGroupWidth = 16;
+
+inline unsigned group_ctz(std::uint32_t mask) noexcept {
+#if defined(__GNUC__)
+  return unsigned(__builtin_ctz(mask));
+#else
+  unsigned n = 0;
+  while ((mask & 1u) == 0) {
+    mask >>= 1;
+    ++n;
+  }
+  return n;
+#endif
+}
+
+// 16 位掩码中从最高位（第 15 位）往下数连续 0 的个数，mask 为 0 时返回 16
+inline unsigned group_leading_zeros(std::uint32_t mask) noexcept {
+  unsigned n = 0;
+  for (std::uint32_t bit = 1u << (kGroupWidth - 1); bit != 0 && !(mask & bit);
+       bit >>= 1) {
+    ++n;
+  }
+  return n;
+}
+
+// 掩码的第 i 位对应 p[i]
+struct group_portable {
+  ctrl_t ctrl[kGroupWidth];
+
+  explicit group_portable(const ctrl_t* p) noexcept {
+    std::memcpy(ctrl, p, kGroupWidth);
+  }
+
+  std::uint32_t match(ctrl_t h2) const noexcept {
+    std::uint32_t mask = 0;
+    for (std::size_t i = 0; i < kGroupWidth; ++i) {
+      mask |= std::uint32_t(ctrl[i] == h2) << i;
+    }
+    return mask;
+  }
+
+  std::uint32_t match_empty() const noexcept { return match(kCtrlEmpty); }
+
+  std::uint32_t match_empty_or_deleted() const noexcept {
+    std::uint32_t mask = 0;
+    for (std::size_t i = 0; i < kGroupWidth; ++i) {
+      mask |= std::uint32_t(ctrl[i] < -1) << i;
+    }
+    return mask;
+  }
+};
+
+#if defined(__SSE2__)
+// 一条 cmpeq + movemask 得到 16 个槽位的匹配结果
+struct group_sse2 {
+  __m128i ctrl;
+
+  explicit group_sse2(const ctrl_t* p) noexcept
+      : ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))) {}
+
+  std::uint32_t match(ctrl_t h2) const noexcept {
+    return std::uint32_t(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl)));
+  }
+
+  std::uint32_t match_empty() const noexcept { return match(kCtrlEmpty); }
+
+  // 空和墓碑都小于 -1，有元素的字节都不小于 0
+  std::uint32_t match_empty_or_deleted() const noexcept {
+    return std::uint32_t(
+        _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), ctrl)));
+  }
+};
+
+using ctrl_group = group_sse2;
+#else
+using ctrl_group = group_portable;
+#endif
+}  // namespace detail
+
+/*
+ * unordered_flat_map<K, V>: 开放寻址的哈希表（Swiss table）
+ *
+ * 元素 mystl::pair<const K, V> 直接存放在一个连续的槽位数组中，另有一个控制字节数组。
+ * 哈希值拆成两部分：H1 = hash >> 7 决定从哪里开始探测，H2 = hash & 0x7F 存进控制字节。
+ * 查找时一次载入 16 个控制字节，和 H2 做一次 SIMD 比较，只有 H2 相同的槽位
+ * （误判率约 1/128）才会去比较键；同一组里出现空字节就说明键不存在。
+ * 探测以组为单位按三角数跳跃，容量是 2 的幂时能遍历所有的组。
+ *
+ * 控制字节数组的末尾复制了前 16 个字节，从任意位置开始载入 16 个字节都不需要回绕。
+ *
+ * 删除时如果包含该槽位的每一个 16 字节窗口都还有空槽位，说明从来没有查找
+ * 越过这个槽位，可以直接标记为空，否则才留下墓碑。最大负载因子是 7/8，
+ * 墓碑过多时按原容量重新散列，否则容量翻倍。
+ *
+ * 插入和重新散列都会移动元素，任何修改操作都会使迭代器、指针和引用失效。
+ */
+template <class Key, class T, class Hash = mystl::hash<Key>,
+          class KeyEqual = std::equal_to<Key>,
+          class Alloc = mystl::allocator<mystl::pair<const Key, T>>>
+class unordered_flat_map {
+ public:
+  // member type
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = mystl::pair<const Key, T>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using allocator_type = Alloc;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using pointer = value_type*;
+  using const_pointer = const value_type*;
+
+ private:
+  using slot_allocator =
+      typename std::allocator_traits<Alloc>::template rebind_alloc<value_type>;
+  using ctrl_allocator = typename std::allocator_traits<
+      Alloc>::template rebind_alloc<detail::ctrl_t>;
+
+  static constexpr size_type npos = size_type(-1);
+  static constexpr size_type kMinCapacity = detail::kGroupWidth;
+
+  template <bool Const>
+  class M_iterator {
+    friend class unordered_flat_map;
+    template <bool>
+    friend class M_iterator;
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = typename unordered_flat_map::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer =
+        typename std::conditional<Const, const value_type*, value_type*>::type;
+    using reference =
+        typename std::conditional<Const, const value_type&, value_type&>::type;
+
+   private:
+    using slot_pointer = pointer;
+
+    const detail::ctrl_t* ctrl{nullptr};
+    const detail::ctrl_t* last{nullptr};
+    slot_pointer slot{nullptr};
+
+    M_iterator(const detail::ctrl_t* c, const detail::ctrl_t* l,
+               slot_pointer s) noexcept
+        : ctrl(c), last(l), slot(s) {}
+
+    // 跳到下一个有元素的槽位
+    void M_skip_empty() noexcept {
+      while (ctrl != last && *ctrl < 0) {
+        ++ctrl;
+        ++slot;
+      }
+    }
+
+   public:
+    M_iterator() noexcept = default;
+
+    // iterator 可以隐式转换为 const_iterator
+    template <bool C = Const, typename = typename std::enable_if<C>::type>
+    M_iterator(const M_iterator<false>& other) noexcept
+        : ctrl(other.ctrl), last(other.last), slot(other.slot) {}
+
+    reference operator*() const noexcept { return *slot; }
+
+    pointer operator->() const noexcept { return slot; }
+
+    M_iterator& operator++() noexcept {
+      ++ctrl;
+      ++slot;
+      M_skip_empty();
+      return *this;
+    }
+
+    M_iterator operator++(int) noexcept {
+      M_iterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    friend bool operator==(const M_iterator& lhs,
+                           const M_iterator& rhs) noexcept {
+      return lhs.ctrl == rhs.ctrl;
+    }
+
+    friend bool operator!=(const M_iterator& lhs,
+                           const M_iterator& rhs) noexcept {
+      return lhs.ctrl != rhs.ctrl;
+    }
+  };
+
+ public:
+  using iterator = M_iterator<false>;
+  using const_iterator = M_iterator<true>;
+
+ private:
+  detail::ctrl_t* ctrl{nullptr};  // cap + kGroupWidth 个字节
+  value_type* slots{nullptr};     // cap 个槽位
+  size_type cap{0};               // 0 或者不小于 16 的 2 的幂
+  size_type num_elements{0};
+  // growth_left: 不需要扩容还能占用的空槽位数（墓碑不计入）。
+  // 哈希函数、比较函数和分配器通常是空类，和它压缩在一起不占空间
+  mystl::compressed_pair<size_type,
+                         mystl::tuple<hasher, key_equal, slot_allocator>>
+      growth_and_policies{};
+
+  size_type& M_growth_left() noexcept { return growth_and_policies.first(); }
+  size_type M_growth_left() const noexcept {
+    return growth_and_policies.first();
+  }
+  hasher& M_hasher() noexcept {
+    return mystl::get<0>(growth_and_policies.second());
+  }
+  const hasher& M_hasher() const noexcept {
+    return mystl::get<0>(growth_and_policies.second());
+  }
+  key_equal& M_key_eq() noexcept {
+    return mystl::get<1>(growth_and_policies.second());
+  }
+  const key_equal& M_key_eq() const noexcept {
+    return mystl::get<1>(growth_and_policies.second());
+  }
+  slot_allocator& M_allocator() noexcept {
+    return mystl::get<2>(growth_and_policies.second());
+  }
+  const slot_allocator& M_allocator() const noexcept {
+    return mystl::get<2>(growth_and_policies.second());
+  }
+
+  static size_type M_max_load(size_type capacity) noexcept {
+    return capacity - capacity / 8;
+  }
+
+  // 容纳 n 个元素所需的最小容量
+  static size_type M_capacity_for(size_type n) noexcept {
+    size_type capacity = kMinCapacity;
+    while (M_max_load(capacity) < n) {
+      capacity <<= 1;
+    }
+    return capacity;
+  }
+
+  template <class K>
+  size_type M_hash(const K& key) const {
+    return detail::hash_mix(M_hasher()(key));
+  }
+
+  static detail::ctrl_t M_h2(size_type h) noexcept {
+    return detail::ctrl_t(h & 0x7F);
+  }
+
+  // 修改控制字节，前 16 个字节同时写入末尾的副本
+  void M_set_ctrl(size_type i, detail::ctrl_t c) noexcept {
+    const size_type mask = cap - 1;
+    ctrl[i] = c;
+    ctrl[((i - detail::kGroupWidth) & mask) + detail::kGroupWidth] = c;
+  }
+
+  template <class K>
+  size_type M_find_index(const K& key, size_type h) const {
+    if (cap == 0) {
+      return npos;
+    }
+    const size_type mask = cap - 1;
+    const detail::ctrl_t h2 = M_h2(h);
+    size_type pos = (h >> 7) & mask;
+    size_type step = 0;
+    for (;;) {
+      const detail::ctrl_group g(ctrl + pos);
+      for (std::uint32_t m = g.match(h2); m != 0; m &= m - 1) {
+        const size_type i = (pos + detail::group_ctz(m)) & mask;
+        if (M_key_eq()(slots[i].first, key)) {
+          return i;
+        }
+      }
+      if (g.match_empty() != 0) {
+        return npos;
+      }
+      step += detail::kGroupWidth;
+      pos = (pos + step) & mask;
+    }
+  }
+
+  // 探测序列上第一个空槽位或墓碑，调用前 cap != 0
+  size_type M_find_insert_slot(size_type h) const noexcept {
+    const size_type mask = cap - 1;
+    size_type pos = (h >> 7) & mask;
+    size_type step = 0;
+    for (;;) {
+      const detail::ctrl_group g(ctrl + pos);
+      const std::uint32_t m = g.match_empty_or_deleted();
+      if (m != 0) {
+        return (pos + detail::group_ctz(m)) & mask;
+      }
+      step += detail::kGroupWidth;
+      pos = (pos + step) & mask;
+    }
+  }
+
+  // 为哈希值 h 的新元素占用一个槽位并返回下标，元素由调用者构造
+  size_type M_prepare_insert(size_type h) {
+    size_type i = cap == 0 ? npos : M_find_insert_slot(h);
+    if (M_growth_left() == 0 &&
+        (i == npos || ctrl[i] != detail::kCtrlDeleted)) {
+      // 墓碑占了超过 3/32 的容量时原地清理，否则扩容
+      if (cap == 0) {
+        M_rehash(kMinCapacity);
+      } else {
+        M_rehash(num_elements * 32 <= cap * 25 ? cap : 2 * cap);
+      }
+      i = M_find_insert_slot(h);
+    }
+    if (ctrl[i] == detail::kCtrlEmpty) {
+      --M_growth_left();
+    }
+    M_set_ctrl(i, M_h2(h));
+    ++num_elements;
+    return i;
+  }
+
+  void M_erase_at(size_type i) {
+    std::allocator_traits<slot_allocator>::destroy(M_allocator(), slots + i);
+    --num_elements;
+    // 包含 i 的每个 16 字节窗口里都有空槽位时，不会有查找越过 i，不需要墓碑
+    const size_type mask = cap - 1;
+    const std::uint32_t empty_after = detail::ctrl_group(ctrl + i).match_empty();
+    const std::uint32_t empty_before =
+        detail::ctrl_group(ctrl + ((i - detail::kGroupWidth) & mask))
+            .match_empty();
+    const bool was_never_full =
+        empty_after != 0 && empty_before != 0 &&
+        detail::group_ctz(empty_after) +
+                detail::group_leading_zeros(empty_before) <
+            detail::kGroupWidth;
+    if (was_never_full) {
+      M_set_ctrl(i, detail::kCtrlEmpty);
+      ++M_growth_left();
+    } else {
+      M_set_ctrl(i, detail::kCtrlDeleted);
+    }
+  }
+
+  void M_allocate(size_type capacity) {
+    ctrl_allocator ca(M_allocator());
+    ctrl = ca.allocate(capacity + detail::kGroupWidth);
+    try {
+      slots = M_allocator().allocate(capacity);
+    } catch (...) {
+      ca.deallocate(ctrl, capacity + detail::kGroupWidth);
+      ctrl = nullptr;
+      throw;
+    }
+    std::memset(ctrl, detail::kCtrlEmpty, capacity + detail::kGroupWidth);
+    cap = capacity;
+    M_growth_left() = M_max_load(capacity);
+  }
+
+  void M_destroy_and_deallocate() noexcept {
+    if (cap == 0) {
+      return;
+    }
+    if (!std::is_trivially_destructible<value_type>::value) {
+      for (size_type i = 0; i < cap; ++i) {
+        if (ctrl[i] >= 0) {
+          std::allocator_traits<slot_allocator>::destroy(M_allocator(),
+                                                         slots + i);
+        }
+      }
+    }
+    M_deallocate(ctrl, slots, cap);
+    ctrl = nullptr;
+    slots = nullptr;
+    cap = num_elements = M_growth_left() = 0;
+  }
+
+  /*
+   * 重新散列时元素是移动还是拷贝。键和值都能不抛异常地移动时移动：
+   * 槽位里的键是 const 的，mystl::move(pair<const K, V>) 会拷贝键，所以通过
+   * 非 const 引用移动键；源槽位随即销毁，不会再被访问。否则拷贝，
+   * 旧元素保留到全部成功之后再销毁，失败时可以完整回滚。
+   */
+  static constexpr bool kMoveOnRehash =
+      (std::is_nothrow_move_constructible<Key>::value &&
+       std::is_nothrow_move_constructible<T>::value) ||
+      !std::is_copy_constructible<value_type>::value;
+
+  void M_transfer(value_type* dst, value_type* src) {
+    if constexpr (kMoveOnRehash) {
+      std::allocator_traits<slot_allocator>::construct(
+          M_allocator(), dst, std::piecewise_construct,
+          mystl::forward_as_tuple(mystl::move(const_cast<Key&>(src->first))),
+          mystl::forward_as_tuple(mystl::move(src->second)));
+      std::allocator_traits<slot_allocator>::destroy(M_allocator(), src);
+    } else {
+      std::allocator_traits<slot_allocator>::construct(
+          M_allocator(), dst, static_cast<const value_type&>(*src));
+    }
+  }
+
+  void M_deallocate(detail::ctrl_t* c, value_type* s,
+                    size_type capacity) noexcept {
+    if (capacity != 0) {
+      ctrl_allocator ca(M_allocator());
+      ca.deallocate(c, capacity + detail::kGroupWidth);
+      M_allocator().deallocate(s, capacity);
+    }
+  }
+
+  /*
+   * 把所有元素转移到容量为 new_cap 的新数组中，同时清除所有墓碑。
+   * 拷贝元素时抛出异常：销毁新数组，恢复原来的表（没有任何影响）。
+   * 移动元素时只有哈希函数可能抛出：已经转移的元素留在新表中，其余的销毁。
+   */
+  void M_rehash(size_type new_cap) {
+    detail::ctrl_t* old_ctrl = ctrl;
+    value_type* old_slots = slots;
+    const size_type old_cap = cap;
+    const size_type old_size = num_elements;
+    const size_type old_growth = M_growth_left();
+    M_allocate(new_cap);
+    num_elements = 0;
+    size_type i = 0;
+    try {
+      for (; i < old_cap; ++i) {
+        if (old_ctrl[i] < 0) {
+          continue;
+        }
+        const size_type h = M_hash(old_slots[i].first);
+        const size_type j = M_find_insert_slot(h);
+        M_transfer(slots + j, old_slots + i);
+        M_set_ctrl(j, M_h2(h));
+        ++num_elements;
+      }
+    } catch (...) {
+      if constexpr (kMoveOnRehash) {
+        for (; i < old_cap; ++i) {
+          if (old_ctrl[i] >= 0) {
+            std::allocator_traits<slot_allocator>::destroy(M_allocator(),
+                                                           old_slots + i);
+          }
+        }
+        M_growth_left() -= num_elements;
+        M_deallocate(old_ctrl, old_slots, old_cap);
+      } else {
+        M_destroy_and_deallocate();
+        ctrl = old_ctrl;
+        slots = old_slots;
+        cap = old_cap;
+        num_elements = old_size;
+        M_growth_left() = old_growth;
+      }
+      throw;
+    }
+    if constexpr (!kMoveOnRehash) {
+      for (i = 0; i < old_cap; ++i) {
+        if (old_ctrl[i] >= 0) {
+          std::allocator_traits<slot_allocator>::destroy(M_allocator(),
+                                                         old_slots + i);
+        }
+      }
+    }
+    M_growth_left() -= num_elements;
+    M_deallocate(old_ctrl, old_slots, old_cap);
+  }
+
+  iterator M_iterator_at(size_type i) noexcept {
+    return iterator(ctrl + i, ctrl + cap, slots + i);
+  }
+
+  const_iterator M_iterator_at(size_type i) const noexcept {
+    return const_iterator(ctrl + i, ctrl + cap, slots + i);
+  }
+
+  template <class K, class... Args>
+  mystl::pair<iterator, bool> M_try_emplace(K&& key, Args&&... args) {
+    const size_type h = M_hash(key);
+    size_type i = M_find_index(key, h);
+    if (i != npos) {
+      return mystl::pair<iterator, bool>(M_iterator_at(i), false);
+    }
+    i = M_prepare_insert(h);
+    try {
+      std::allocator_traits<slot_allocator>::construct(
+          M_allocator(), slots + i, std::piecewise_construct,
+          mystl::forward_as_tuple(mystl::forward<K>(key)),
+          mystl::forward_as_tuple(mystl::forward<Args>(args)...));
+    } catch (...) {
+      // 构造失败时把占用的槽位还回去
+      --num_elements;
+      M_set_ctrl(i, detail::kCtrlDeleted);
+      throw;
+    }
+    return mystl::pair<iterator, bool>(M_iterator_at(i), true);
+  }
+
+  template <class V>
+  mystl::pair<iterator, bool> M_insert_value(V&& value) {
+    const size_type h = M_hash(value.first);
+    size_type i = M_find_index(value.first, h);
+    if (i != npos) {
+      return mystl::pair<iterator, bool>(M_iterator_at(i), false);
+    }
+    i = M_prepare_insert(h);
+    try {
+      std::allocator_traits<slot_allocator>::construct(
+          M_allocator(), slots + i, mystl::forward<V>(value));
+    } catch (...) {
+      --num_elements;
+      M_set_ctrl(i, detail::kCtrlDeleted);
+      throw;
+    }
+    return mystl::pair<iterator, bool>(M_iterator_at(i), true);
+  }
+
+ public:
+  unordered_flat_map() = default;
+
+  explicit unordered_flat_map(size_type bucket_count, const Hash& hash = Hash(),
+                              const KeyEqual& equal = KeyEqual(),
+                              const Alloc& alloc = Alloc())
+      : growth_and_policies(size_type(0),
+                            mystl::tuple<hasher, key_equal, slot_allocator>(
+                                hash, equal, slot_allocator(alloc))) {
+    reserve(bucket_count);
+  }
+
+  template <class InputIt,
+            typename = std::enable_if_t<std::is_convertible<
+                typename std::iterator_traits<InputIt>::iterator_category,
+                std::input_iterator_tag>::value>>
+  unordered_flat_map(InputIt first, InputIt last, size_type bucket_count = 0) {
+    reserve(bucket_count);
+    insert(first, last);
+  }
+
+  unordered_flat_map(std::initializer_list<value_type> ilist)
+      : unordered_flat_map(ilist.begin(), ilist.end(), ilist.size()) {}
+
+  // 容量和控制字节保持不变，逐个拷贝有元素的槽位
+  unordered_flat_map(const unordered_flat_map& other)
+      : growth_and_policies(size_type(0), other.growth_and_policies.second()) {
+    if (other.num_elements == 0) {
+      return;
+    }
+    M_allocate(other.cap);
+    for (size_type i = 0; i < other.cap; ++i) {
+      if (other.ctrl[i] >= 0) {
+        try {
+          std::allocator_traits<slot_allocator>::construct(
+              M_allocator(), slots + i, other.slots[i]);
+        } catch (...) {
+          M_destroy_and_deallocate();
+          throw;
+        }
+        ctrl[i] = other.ctrl[i];
+        ++num_elements;
+      }
+    }
+    std::memcpy(ctrl, other.ctrl, cap + detail::kGroupWidth);
+    M_growth_left() = other.M_growth_left();
+  }
+
+  unordered_flat_map(unordered_flat_map&& other) noexcept
+      : ctrl(other.ctrl),
+        slots(other.slots),
+        cap(other.cap),
+        num_elements(other.num_elements),
+        growth_and_policies(mystl::move(other.growth_and_policies)) {
+    other.ctrl = nullptr;
+    other.slots = nullptr;
+    other.cap = other.num_elements = other.M_growth_left() = 0;
+  }
+
+  unordered_flat_map& operator=(const unordered_flat_map& other) {
+    if (this != &other) {
+      unordered_flat_map tmp(other);
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  unordered_flat_map& operator=(unordered_flat_map&& other) noexcept {
+    if (this != &other) {
+      M_destroy_and_deallocate();
+      swap(other);
+    }
+    return *this;
+  }
+
+  ~unordered_flat_map() { M_destroy_and_deallocate(); }
+
+  allocator_type get_allocator() const {
+    return allocator_type(M_allocator());
+  }
+
+  hasher hash_function() const { return M_hasher(); }
+
+  key_equal key_eq() const { return M_key_eq(); }
+
+  // iterator
+
+  iterator begin() noexcept {
+    iterator it = M_iterator_at(0);
+    it.M_skip_empty();
+    return it;
+  }
+
+  const_iterator begin() const noexcept {
+    const_iterator it = M_iterator_at(0);
+    it.M_skip_empty();
+    return it;
+  }
+
+  const_iterator cbegin() const noexcept { return begin(); }
+
+  iterator end() noexcept { return M_iterator_at(cap); }
+
+  const_iterator end() const noexcept { return M_iterator_at(cap); }
+
+  const_iterator cend() const noexcept { return end(); }
+
+  // capacity
+
+  bool empty() const noexcept { return num_elements == 0; }
+
+  size_type size() const noexcept { return num_elements; }
+
+  size_type max_size() const noexcept {
+    return std::allocator_traits<slot_allocator>::max_size(M_allocator());
+  }
+
+  // 槽位总数
+  size_type capacity() const noexcept { return cap; }
+
+  float load_factor() const noexcept {
+    return cap == 0 ? 0.0f : float(num_elements) / float(cap);
+  }
+
+  float max_load_factor() const noexcept { return 0.875f; }
+
+  // 保证插入 n 个元素之前不会重新散列
+  void reserve(size_type n) {
+    if (n > num_elements + M_growth_left()) {
+      const size_type capacity = M_capacity_for(n);
+      M_rehash(capacity > cap ? capacity : cap);
+    }
+  }
+
+  // 重新散列到至少 n 个槽位（同时不少于容纳当前元素所需），会清除所有墓碑
+  void rehash(size_type n) {
+    size_type capacity = M_capacity_for(num_elements);
+    while (capacity < n) {
+      capacity <<= 1;
+    }
+    if (num_elements == 0 && n == 0) {
+      M_destroy_and_deallocate();
+      return;
+    }
+    M_rehash(capacity);
+  }
+
+  // modifiers
+
+  void clear() noexcept {
+    if (num_elements == 0 && M_growth_left() == M_max_load(cap)) {
+      return;
+    }
+    if (!std::is_trivially_destructible<value_type>::value) {
+      for (size_type i = 0; i < cap; ++i) {
+        if (ctrl[i] >= 0) {
+          std::allocator_traits<slot_allocator>::destroy(M_allocator(),
+                                                         slots + i);
+        }
+      }
+    }
+    std::memset(ctrl, detail::kCtrlEmpty, cap + detail::kGroupWidth);
+    num_elements = 0;
+    M_growth_left() = M_max_load(cap);
+  }
+
+  mystl::pair<iterator, bool> insert(const value_type& value) {
+    return M_insert_value(value);
+  }
+
+  mystl::pair<iterator, bool> insert(value_type&& value) {
+    return M_insert_value(mystl::move(value));
+  }
+
+  template <class InputIt>
+  void insert(InputIt first, InputIt last) {
+    for (; first != last; ++first) {
+      M_insert_value(*first);
+    }
+  }
+
+  void insert(std::initializer_list<value_type> ilist) {
+    insert(ilist.begin(), ilist.end());
+  }
+
+  // 先构造出元素再查找，键已存在时元素被丢弃；已知键时用 try_emplace 更好
+  template <class... Args>
+  mystl::pair<iterator, bool> emplace(Args&&... args) {
+    return M_insert_value(value_type(mystl::forward<Args>(args)...));
+  }
+
+  // 键不存在时才用 args 构造 mapped_type
+  template <class... Args>
+  mystl::pair<iterator, bool> try_emplace(const key_type& key,
+                                          Args&&... args) {
+    return M_try_emplace(key, mystl::forward<Args>(args)...);
+  }
+
+  template <class... Args>
+  mystl::pair<iterator, bool> try_emplace(key_type&& key, Args&&... args) {
+    return M_try_emplace(mystl::move(key), mystl::forward<Args>(args)...);
+  }
+
+  template <class M>
+  mystl::pair<iterator, bool> insert_or_assign(const key_type& key, M&& obj) {
+    mystl::pair<iterator, bool> result =
+        M_try_emplace(key, mystl::forward<M>(obj));
+    if (!result.second) {
+      result.first->second = mystl::forward<M>(obj);
+    }
+    return result;
+  }
+
+  template <class M>
+  mystl::pair<iterator, bool> insert_or_assign(key_type&& key, M&& obj) {
+    mystl::pair<iterator, bool> result =
+        M_try_emplace(mystl::move(key), mystl::forward<M>(obj));
+    if (!result.second) {
+      result.first->second = mystl::forward<M>(obj);
+    }
+    return result;
+  }
+
+  // 返回下一个元素的迭代器
+  iterator erase(const_iterator pos) {
+    const size_type i = size_type(pos.ctrl - ctrl);
+    M_erase_at(i);
+    iterator next = M_iterator_at(i);
+    next.M_skip_empty();
+    return next;
+  }
+
+  iterator erase(iterator pos) { return erase(const_iterator(pos)); }
+
+  iterator erase(const_iterator first, const_iterator last) {
+    while (first != last) {
+      first = erase(first);
+    }
+    return M_iterator_at(size_type(last.ctrl - ctrl));
+  }
+
+  size_type erase(const key_type& key) {
+    const size_type i = M_find_index(key, M_hash(key));
+    if (i == npos) {
+      return 0;
+    }
+    M_erase_at(i);
+    return 1;
+  }
+
+  void swap(unordered_flat_map& other) noexcept {
+    using std::swap;
+    swap(ctrl, other.ctrl);
+    swap(slots, other.slots);
+    swap(cap, other.cap);
+    swap(num_elements, other.num_elements);
+    growth_and_policies.swap(other.growth_and_policies);
+  }
+
+  // lookup
+
+  iterator find(const key_type& key) {
+    const size_type i = M_find_index(key, M_hash(key));
+    return i == npos ? end() : M_iterator_at(i);
+  }
+
+  const_iterator find(const key_type& key) const {
+    const size_type i = M_find_index(key, M_hash(key));
+    return i == npos ? end() : M_iterator_at(i);
+  }
+
+  bool contains(const key_type& key) const {
+    return M_find_index(key, M_hash(key)) != npos;
+  }
+
+  size_type count(const key_type& key) const { return contains(key); }
+
+  mapped_type& at(const key_type& key) {
+    const size_type i = M_find_index(key, M_hash(key));
+    if (i == npos) {
+      throw std::out_of_range("mystl::unordered_flat_map::at");
+    }
+    return slots[i].second;
+  }
+
+  const mapped_type& at(const key_type& key) const {
+    const size_type i = M_find_index(key, M_hash(key));
+    if (i == npos) {
+      throw std::out_of_range("mystl::unordered_flat_map::at");
+    }
+    return slots[i].second;
+  }
+
+  mapped_type& operator[](const key_type& key) {
+    return M_try_emplace(key).first->second;
+  }
+
+  mapped_type& operator[](key_type&& key) {
+    return M_try_emplace(mystl::move(key)).first->second;
+  }
+};
+
+template <class K, class T, class H, class E, class A>
+bool operator==(const unordered_flat_map<K, T, H, E, A>& lhs,
+                const unordered_flat_map<K, T, H, E, A>& rhs) {
+  if (lhs.size() != rhs.size()) {
+    return false;
+  }
+  for (const auto& value : lhs) {
+    auto it = rhs.find(value.first);
+    if (it == rhs.end() || !(it->second == value.second)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <class K, class T, class H, class E, class A>
+bool operator!=(const unordered_flat_map<K, T, H, E, A>& lhs,
+                const unordered_flat_map<K, T, H, E, A>& rhs) {
+  return !(lhs == rhs);
+}
+}  // namespace mystl
+
+namespace std {
+template <class K, class T, class H, class E, class A>
+void swap(mystl::unordered_flat_map<K, T, H, E, A>& lhs,
+          mystl::unordered_flat_map<K, T, H, E, A>& rhs) noexcept {
+  lhs.swap(rhs);
+}
+}  // namespace std
+
+#endif  // __MYSTL_UNORDERED_FLAT_MAP_H__
@@ -35,15 +35,80 @@ constexpr T&& forward(typename std::remove_reference<T>::type&& t) noexcept {
 template <class... Args>
 class tuple;
 
+namespace detail {
+/*
+ * pair 的数据成员放在基类里，pair 自己的拷贝/移动赋值都是 = default，
+ * 这样成员可平凡拷贝时 pair 也可平凡拷贝（可以 memcpy、整块搬移、用寄存器传递）。
+ *
+ * pair_storage 不声明任何拷贝/移动操作，全部由编译器按成员生成；
+ * 只有成员里有引用时才换成 pair_ref_storage，它的赋值作用在被引用的对象上，
+ * 而不是像默认生成的那样被删除。
+ */
+template <class T1, class T2>
+struct pair_storage {
+  T1 first;
+  T2 second;
+
+  constexpr pair_storage() : first(), second() {}
+
+  template <class U1, class U2>
+  constexpr pair_storage(U1&& x, U2&& y)
+      : first(mystl::forward<U1>(x)), second(mystl::forward<U2>(y)) {}
+
+  // 为了避免循环依赖，将实现放在 tuple.h 中
+  template <class Tuple1, class Tuple2, std::size_t... Is1,
+            std::size_t... Is2>
+  pair_storage(std::piecewise_construct_t, Tuple1&& tuple1, Tuple2&& tuple2,
+               std::index_sequence<Is1...>, std::index_sequence<Is2...>);
+};
+
+template <class T1, class T2>
+struct pair_ref_storage : pair_storage<T1, T2> {
+  using pair_storage<T1, T2>::pair_storage;
+
+  pair_ref_storage(const pair_ref_storage&) = default;
+  pair_ref_storage(pair_ref_storage&&) = default;
+
+  // 不能赋值时参数类型退化成 nonsuch，这两个函数就不再是拷贝/移动赋值运算符
+  pair_ref_storage& operator=(
+      typename std::conditional<std::is_copy_assignable<T1>::value &&
+                                    std::is_copy_assignable<T2>::value,
+                                const pair_ref_storage&, const nonsuch&>::type
+          other) {
+    this->first = other.first;
+    this->second = other.second;
+    return *this;
+  }
+
+  pair_ref_storage& operator=(
+      typename std::conditional<std::is_move_assignable<T1>::value &&
+                                    std::is_move_assignable<T2>::value,
+                                pair_ref_storage&&, const nonsuch_move&>::type
+          other) noexcept(std::is_nothrow_move_assignable<T1>::value &&
+                          std::is_nothrow_move_assignable<T2>::value) {
+    this->first = mystl::forward<T1>(other.first);
+    this->second = mystl::forward<T2>(other.second);
+    return *this;
+  }
+};
+
+template <class T1, class T2>
+using pair_base_t =
+    typename std::conditional<std::is_reference<T1>::value ||
+                                  std::is_reference<T2>::value,
+                              pair_ref_storage<T1, T2>,
+                              pair_storage<T1, T2>>::type;
+}  // namespace detail
+
 template <class T1, class T2>
-struct pair {
+struct pair : detail::pair_base_t<T1, T2> {
+  using Base = detail::pair_base_t<T1, T2>;
+
   // member types
   using first_type = T1;
   using second_type = T2;
 
-  // member object
-  T1 first;
-  T2 second;
+  // member object: first, second 在基类 detail::pair_storage 中
 
   // default constructors
   // T1 和 T2 都可以默认构造的时候 pair 才能默认构造
@@ -55,7 +120,7 @@ struct pair {
                     mystl::is_implicitly_default_constructible_v<U1> &&
                     mystl::is_implicitly_default_constructible_v<U2>,
                 int>::type>
-  constexpr pair() : first(), second() {}
+  constexpr pair() : Base() {}
 
   template <class U1 = T1, class U2 = T2,
             typename std::enable_if<
@@ -64,7 +129,7 @@ struct pair {
                     (!mystl::is_implicitly_default_constructible_v<U1> ||
                      !mystl::is_implicitly_default_constructible_v<U2>),
                 char>::type = 0>
-  explicit constexpr pair() : first(), second() {}
+  explicit constexpr pair() : Base() {}
 
   // value constructors
   // T1 和 T2 都能拷贝构造这个构造函数才会参与重载决议
@@ -77,7 +142,7 @@ struct pair {
                                   std::is_convertible<const U1&, U1>::value &&
                                   std::is_convertible<const U2&, U2>::value,
                               int>::type = 0>
-  constexpr pair(const T1& x, const T2& y) : first(x), second(y) {}
+  constexpr pair(const T1& x, const T2& y) : Base(x, y) {}
 
   template <class U1 = T1, class U2 = T2,
             typename = typename std::enable_if<
@@ -86,7 +151,7 @@ struct pair {
                     (!std::is_convertible<const U1&, U1>::value ||
                      !std::is_convertible<const U2&, U2>::value),
                 char>::type>
-  explicit constexpr pair(const T1& x, const T2& y) : first(x), second(y) {}
+  explicit constexpr pair(const T1& x, const T2& y) : Base(x, y) {}
 
   template <class U1, class U2,
             typename = typename std::enable_if<
@@ -96,7 +161,7 @@ struct pair {
                     std::is_convertible<U2, T2>::value,
                 int>::type>
   constexpr pair(U1&& x, U2&& y)
-      : first(mystl::forward<U1>(x)), second(mystl::forward<U2>(y)) {}
+      : Base(mystl::forward<U1>(x), mystl::forward<U2>(y)) {}
 
   template <class U1, class U2,
             typename std::enable_if<std::is_constructible<T1, U1>::value &&
@@ -105,7 +170,7 @@ struct pair {
                                          !std::is_convertible<U2, T2>::value),
                                     char>::type = 0>
   explicit constexpr pair(U1&& x, U2&& y)
-      : first(mystl::forward<U1>(x)), second(mystl::forward<U2>(y)) {}
+      : Base(mystl::forward<U1>(x), mystl::forward<U2>(y)) {}
 
   template <class U1, class U2,
             typename = typename std::enable_if<
@@ -114,7 +179,7 @@ struct pair {
                     std::is_convertible<const U1&, T1>::value &&
                     std::is_convertible<const U2&, T2>::value,
                 int>::type>
-  constexpr pair(const pair<U1, U2>& p) : first(p.first), second(p.second) {}
+  constexpr pair(const pair<U1, U2>& p) : Base(p.first, p.second) {}
 
   template <
       class U1, class U2,
@@ -124,7 +189,7 @@ struct pair {
                                    !std::is_convertible<const U2&, T2>::value),
                               char>::type = 0>
   explicit constexpr pair(const pair<U1, U2>& p)
-      : first(p.first), second(p.second) {}
+      : Base(p.first, p.second) {}
 
   template <class U1, class U2,
             typename = typename std::enable_if<
@@ -134,8 +199,7 @@ struct pair {
                     std::is_convertible<U2, T2>::value,
                 int>::type>
   constexpr pair(pair<U1, U2>&& p)
-      : first(mystl::forward<U1>(p.first)),
-        second(mystl::forward<U2>(p.second)) {}
+      : Base(mystl::forward<U1>(p.first), mystl::forward<U2>(p.second)) {}
 
   template <class U1, class U2,
             typename std::enable_if<std::is_constructible<T1, U1>::value &&
@@ -144,20 +208,13 @@ struct pair {
                                          !std::is_convertible<U2, T2>::value),
                                     char>::type = 0>
   explicit constexpr pair(pair<U1, U2>&& p)
-      : first(mystl::forward<U1>(p.first)),
-        second(mystl::forward<U2>(p.second)) {}
+      : Base(mystl::forward<U1>(p.first), mystl::forward<U2>(p.second)) {}
 
   // 为了避免循环依赖，将实现放在 tuple.h 中
   template <class... Args1, class... Args2>
   pair(std::piecewise_construct_t, mystl::tuple<Args1...> first_args,
        mystl::tuple<Args2...> second_args);
 
- private:
-  template <class Tuple1, class Tuple2, std::size_t... Is1, std::size_t... Is2>
-  pair(std::piecewise_construct_t, Tuple1&& tuple1, Tuple2&& tuple2,
-       std::index_sequence<Is1...>, std::index_sequence<Is2...>);
-
- public:
   pair(const pair&) = default;
   pair(pair&&) = default;
 
@@ -169,14 +226,18 @@ struct pair {
   // typename std::enable_if<std::is_copy_assignable<T1>::value &&
   //                             std::is_copy_assignable<T2>::value,
   //                         pair&>::type
-  pair& operator=(
-      typename std::conditional<std::is_copy_assignable<T1>::value &&
-                                    std::is_copy_assignable<T2>::value,
-                                const pair&, const nonsuch&>::type other) {
-    first = other.first;
-    second = other.second;
-    return *this;
-  }
+  // pair& operator=(
+  //     typename std::conditional<std::is_copy_assignable<T1>::value &&
+  //                                   std::is_copy_assignable<T2>::value,
+  //                               const pair&, const nonsuch&>::type other) {
+  //   first = other.first;
+  //   second = other.second;
+  //   return *this;
+  // }
+  // 上面用户提供的版本让 pair<int, int> 失去了平凡的拷贝赋值。
+  // 现在默认生成：成员不能赋值时自动删除，引用成员的赋值由 pair_ref_storage 负责
+  pair& operator=(const pair&) = default;
+  pair& operator=(pair&&) = default;
 
   template <
       class U1, class U2,
@@ -184,20 +245,8 @@ struct pair {
                                   std::is_assignable<T2&, const U2&>::value,
                               int>::type = 0>
   pair& operator=(const pair<U1, U2>& other) {
-    first = other.first;
-    second = other.second;
-    return *this;
-  }
-
-  template <class U1 = T1, class U2 = T2,
-            typename = typename std::enable_if<
-                std::is_move_assignable<U1>::value &&
-                std::is_move_assignable<U2>::value>::type>
-  pair& operator=(pair&& other) noexcept(
-      std::is_nothrow_move_assignable<U1>::value&&
-          std::is_nothrow_move_assignable<U2>::value) {
-    first = mystl::forward<first_type>(other.first);
-    second = mystl::forward<second_type>(other.second);
+    this->first = other.first;
+    this->second = other.second;
     return *this;
   }
 
@@ -206,15 +255,15 @@ struct pair {
                 std::is_assignable<T1&, U1&&>::value &&
                 std::is_assignable<T2&, U2&&>::value>::type>
   pair& operator=(pair<U1, U2>&& other) {
-    first = mystl::forward<U1>(other.first);
-    second = mystl::forward<U2>(other.second);
+    this->first = mystl::forward<U1>(other.first);
+    this->second = mystl::forward<U2>(other.second);
     return *this;
   }
 
   void swap(pair& other) {
     using std::swap;
-    swap(first, other.first);
-    swap(second, other.second);
+    swap(this->first, other.first);
+    swap(this->second, other.second);
   }
 
   ~pair() = default;
@@ -247,10 +296,84 @@ make_pair(T1&& x, T2&& y) {
   return pair<U1, U2>(mystl::forward<T1>(x), mystl::forward<T2>(y));
 }
 
+//======================  comparison  ==========================
+template <class T>
+struct is_pair : std::false_type {};
+
+template <class T1, class T2>
+struct is_pair<pair<T1, T2>> : std::true_type {};
+
+template <class T>
+struct is_tuple : std::false_type {};
+
+template <class... Types>
+struct is_tuple<tuple<Types...>> : std::true_type {};
+
+namespace detail {
+template <class T>
+using remove_cvref_t =
+    typename std::remove_cv<typename std::remove_reference<T>::type>::type;
+
+template <class T>
+inline constexpr bool is_plain_scalar_v =
+    std::is_arithmetic<remove_cvref_t<T>>::value ||
+    std::is_enum<remove_cvref_t<T>>::value ||
+    std::is_pointer<remove_cvref_t<T>>::value;
+
+// 算术、枚举和指针的比较没有副作用，不必短路：各元素的结果直接按位与，省掉分支
+template <class T, class U>
+inline constexpr bool is_branchless_comparable_v =
+    is_plain_scalar_v<T> && is_plain_scalar_v<U>;
+
+template <class T, class U, class = void>
+struct has_compare_member : std::false_type {};
+
+template <class T, class U>
+struct has_compare_member<
+    T, U,
+    std::void_t<decltype(int(std::declval<const T&>().compare(
+        std::declval<const U&>())))>> : std::true_type {};
+
+/*
+ * three_way(a, b): a < b 返回负数，相等返回 0，a > b 返回正数。
+ * - 标量：(b < a) - (a < b)，两次比较都没有分支
+ * - 带 compare() 的类型（std::string 等）：一次遍历得到结果，而不是 < 比较两遍
+ * - pair/tuple：递归调用 three_way_compare
+ * - 其他类型只要求 operator<
+ */
+template <class T, class U>
+constexpr int three_way(const T& a, const U& b) {
+  if constexpr (is_branchless_comparable_v<T, U>) {
+    return int(b < a) - int(a < b);
+  } else if constexpr ((is_pair<T>::value && is_pair<U>::value) ||
+                       (is_tuple<T>::value && is_tuple<U>::value)) {
+    return three_way_compare(a, b);
+  } else if constexpr (has_compare_member<T, U>::value) {
+    const int c = int(a.compare(b));
+    return int(c > 0) - int(c < 0);
+  } else {
+    return a < b ? -1 : (b < a ? 1 : 0);
+  }
+}
+}  // namespace detail
+
+// 三路比较，返回值的符号表示大小关系
+template <class T1, class T2, class U1, class U2>
+constexpr int three_way_compare(const mystl::pair<T1, T2>& lhs,
+                                const mystl::pair<U1, U2>& rhs) {
+  const int c = detail::three_way(lhs.first, rhs.first);
+  return c != 0 ? c : detail::three_way(lhs.second, rhs.second);
+}
+
 template <class T1, class T2, class U1, class U2>
 constexpr bool operator==(const mystl::pair<T1, T2>& lhs,
                           const mystl::pair<U1, U2>& rhs) {
-  return (lhs.first == rhs.first) && (lhs.second == rhs.second);
+  if constexpr (detail::is_branchless_comparable_v<T1, U1> &&
+                detail::is_branchless_comparable_v<T2, U2>) {
+    return bool(lhs.first == rhs.first) & bool(lhs.second == rhs.second);
+  } else {
+    return (lhs.first == rhs.first) && (lhs.second == rhs.second);
+  }
 }
 
 template <class T1, class T2, class U1, class U2>
@@ -262,8 +385,16 @@ constexpr bool operator!=(const mystl::pair<T1, T2>& lhs,
 template <class T1, class T2, class U1, class U2>
 constexpr bool operator<(const mystl::pair<T1, T2>& lhs,
                          const mystl::pair<U1, U2>& rhs) {
-  return lhs.first < rhs.first ||
-         (!(rhs.first < lhs.first) && (lhs.second < rhs.second));
+  if constexpr (detail::is_branchless_comparable_v<T1, U1> &&
+                detail::is_branchless_comparable_v<T2, U2>) {
+    // 用 !(b < a) 判断等价，与 std::pair 的字典序一致
+    return bool(lhs.first < rhs.first) |
+           (!bool(rhs.first < lhs.first) & bool(lhs.second < rhs.second));
+  } else {
+    // 只用 operator<，遇到第一个不等价的元素就停止，不调用 compare()
+    return lhs.first < rhs.first ||
+           (!(rhs.first < lhs.first) && lhs.second < rhs.second);
+  }
 }
 
 template <class T1, class T2, class U1, class U2>
@@ -398,6 +529,100 @@ constexpr const T1&& get(const pair<T2, T1>&& p) noexcept {
   return mystl::move(p.second);
 }
 
+//======================  compressed_pair  ==========================
+template <class T1, class T2>
+class compressed_pair;
+
+namespace detail {
+// T 是 compressed_pair 或从它派生
+template <class T1, class T2>
+std::true_type derives_from_compressed_pair(const compressed_pair<T1, T2>*);
+std::false_type derives_from_compressed_pair(const void*);
+
+template <class T, class = void>
+struct is_compressed_pair_derived : std::false_type {};
+
+template <class T>
+struct is_compressed_pair_derived<T,
+                                  std::enable_if_t<std::is_class<T>::value>>
+    : decltype(derives_from_compressed_pair(static_cast<T*>(nullptr))) {};
+
+// Index 区分两个位置，T1 和 T2 相同时两个基类依然是不同的类型。
+// 空的 compressed_pair 成员不继承，否则它的 compressed_pair_elem<E, 0>
+// 会和外层的同名基类重复，成为有歧义的基类
+template <class T, std::size_t Index,
+          bool = std::is_empty<T>::value && !std::is_final<T>::value &&
+                 !is_compressed_pair_derived<T>::value>
+struct compressed_pair_elem {
+  T value;
+
+  constexpr compressed_pair_elem() : value() {}
+
+  template <class U>
+  constexpr explicit compressed_pair_elem(U&& x)
+      : value(mystl::forward<U>(x)) {}
+
+  constexpr T& get() noexcept { return value; }
+
+  constexpr const T& get() const noexcept { return value; }
+};
+
+// 空类直接作为基类，不占空间
+template <class T, std::size_t Index>
+struct compressed_pair_elem<T, Index, true> : private T {
+  constexpr compressed_pair_elem() : T() {}
+
+  template <class U>
+  constexpr explicit compressed_pair_elem(U&& x) : T(mystl::forward<U>(x)) {}
+
+  constexpr T& get() noexcept { return *this; }
+
+  constexpr const T& get() const noexcept { return *this; }
+};
+}  // namespace detail
+
+/*
+ * compressed_pair<T1, T2>: 和 pair 一样保存两个对象，但非 final 的空类成员
+ * 通过空基类优化不占空间。容器用它保存哈希函数、比较函数、分配器这类通常无状态的策略对象，
+ * 例如 sizeof(compressed_pair<T*, mystl::allocator<T>>) == sizeof(T*)。
+ * 成员通过 first()/second() 访问。
+ */
+template <class T1, class T2>
+class compressed_pair : private detail::compressed_pair_elem<T1, 0>,
+                        private detail::compressed_pair_elem<T2, 1> {
+  using first_base = detail::compressed_pair_elem<T1, 0>;
+  using second_base = detail::compressed_pair_elem<T2, 1>;
+
+ public:
+  using first_type = T1;
+  using second_type = T2;
+
+  template <class U1 = T1, class U2 = T2,
+            typename std::enable_if<
+                std::is_default_constructible<U1>::value &&
+                    std::is_default_constructible<U2>::value,
+                int>::type = 0>
+  constexpr compressed_pair() : first_base(), second_base() {}
+
+  template <class U1, class U2>
+  constexpr compressed_pair(U1&& x, U2&& y)
+      : first_base(mystl::forward<U1>(x)), second_base(mystl::forward<U2>(y)) {}
+
+  constexpr T1& first() noexcept { return first_base::get(); }
+
+  constexpr const T1& first() const noexcept { return first_base::get(); }
+
+  constexpr T2& second() noexcept { return second_base::get(); }
+
+  constexpr const T2& second() const noexcept { return second_base::get(); }
+
+  void swap(compressed_pair& other) {
+    using std::swap;
+    swap(first(), other.first());
+    swap(second(), other.second());
+  }
+};
+
 }  // namespace mystl
 
 namespace std {
@@ -425,7 +650,8 @@ struct tuple_size<mystl::pair<T1, T2>>
 
 // specialize std::swap
 template <class T1, class T2>
-void swap(pair<T1, T2>& x, pair<T1, T2>& y) noexcept(noexcept(x.swap(y))) {
+void swap(mystl::pair<T1, T2>& x,
+          mystl::pair<T1, T2>& y) noexcept(noexcept(x.swap(y))) {
   x.swap(y);
 }
 }  // namespace std
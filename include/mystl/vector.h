@@ -1,12 +1,38 @@
 #ifndef __MYSTL_VECTOR_H__
 #define __MYSTL_VECTOR_H__
 
+#include <algorithm>
+#include <exception>
+#include <initializer_list>
+#include <iterator>
 #include <memory>
+#include <new>
+#include <stdexcept>
+#include <thread>
 #include <type_traits>
+#include <utility>
+#include <vector>
 #include "mystl/allocator.h"
+#include "mystl/utility.h"
 
 namespace mystl {
 
+// 并行构造标签，作用类似于 std::execution::par
+// threads 为 0 时根据硬件线程数和元素个数自动决定线程数
+// 例如：mystl::vector<int> v(mystl::parallel_construct, n, 42);
+//      mystl::vector<int> v(mystl::parallel_construct_t{8}, n, 42);
+struct parallel_construct_t {
+  std::size_t threads = 0;
+};
+inline constexpr parallel_construct_t parallel_construct{};
+
+// 默认初始化标签：resize(n, mystl::default_init) 新增的元素执行默认初始化，
+// 对 int 这类平凡类型就是不初始化，适合随后整块写入（例如从文件读入）的场景
+struct default_init_t {
+  explicit default_init_t() = default;
+};
+inline constexpr default_init_t default_init{};
+
 template <class T, class Alloc = mystl::allocator<T>>
 class vector {
  public:
@@ -18,7 +44,7 @@ class vector {
   using reference = value_type&;
   using const_reference = const value_type&;
   using pointer = typename std::allocator_traits<Alloc>::pointer;
-  using const_pointer = typename std::allocator_traits<Alloc>::pointer;
+  using const_pointer = typename std::allocator_traits<Alloc>::const_pointer;
   using iterator = T*;
   using const_iterator = const T*;
   using revrese_iterator = std::reverse_iterator<iterator>;
@@ -77,29 +103,204 @@ class vector {
   */
   pointer start{nullptr};
   pointer finish{nullptr};
-  pointer end_of_storage{nullptr};
-  Alloc allocator;
+  // end_of_storage 和分配器放在一起，无状态的分配器不占空间
+  mystl::compressed_pair<pointer, Alloc> storage_end{nullptr, Alloc()};
+
+  pointer& M_end_of_storage() noexcept { return storage_end.first(); }
+  const pointer& M_end_of_storage() const noexcept {
+    return storage_end.first();
+  }
+  Alloc& M_allocator() noexcept { return storage_end.second(); }
+  const Alloc& M_allocator() const noexcept { return storage_end.second(); }
 
  private:
   void M_crate_storage(size_type n) {
-    start = allocator.allocate(n);
+    start = M_allocator().allocate(n);
     finish = start;
-    end_of_storage = start + n;
+    M_end_of_storage() = start + n;
   }
 
   template <class... Args>
   void M_construct(Args&&... args) {
     try {
-      for (; finish != end_of_storage; ++finish) {
+      for (; finish != M_end_of_storage(); ++finish) {
         // 调用 ::new((void*)p) T(args)...
-        allocator.construct(finish, mystl::forward<Args>(args)...);
+        M_allocator().construct(finish, mystl::forward<Args>(args)...);
       }
     } catch (...) {
       for (auto p = start; p != finish; ++p) {
-        allocator.destroy(p);
+        M_allocator().destroy(p);
+      }
+      M_allocator().deallocate(start,
+                               size_type(M_end_of_storage() - start));
+      start = finish = M_end_of_storage() = nullptr;
+      throw;
+    }
+  }
+
+  // 重新分配到 new_cap 大小的存储，已有元素移动（或拷贝）过去
+  void M_reallocate(size_type new_cap) {
+    pointer new_start = M_allocator().allocate(new_cap);
+    pointer new_finish = new_start;
+    try {
+      for (pointer p = start; p != finish; ++p, ++new_finish) {
+        M_allocator().construct(new_finish, std::move_if_noexcept(*p));
+      }
+    } catch (...) {
+      for (pointer p = new_start; p != new_finish; ++p) {
+        M_allocator().destroy(p);
+      }
+      M_allocator().deallocate(new_start, new_cap);
+      throw;
+    }
+    for (pointer p = start; p != finish; ++p) {
+      M_allocator().destroy(p);
+    }
+    if (start != nullptr) {
+      M_allocator().deallocate(start, capacity());
+    }
+    start = new_start;
+    finish = new_finish;
+    M_end_of_storage() = new_start + new_cap;
+  }
+
+  // 容量不足 n 时按 2 倍增长
+  void M_grow_to(size_type n) {
+    if (n > capacity()) {
+      M_reallocate(std::max(n, 2 * capacity()));
+    }
+  }
+
+  void M_destroy_tail(pointer new_finish) {
+    for (pointer p = new_finish; p != finish; ++p) {
+      M_allocator().destroy(p);
+    }
+    finish = new_finish;
+  }
+
+  // 在尾部追加 n 个元素，init(p) 负责在 p 处构造一个元素
+  template <class Init>
+  void M_append(size_type n, Init init) {
+    M_grow_to(size() + n);
+    pointer old_finish = finish;
+    try {
+      for (; n != 0; --n, ++finish) {
+        init(finish);
+      }
+    } catch (...) {
+      M_destroy_tail(old_finish);
+      throw;
+    }
+  }
+
+  /*
+   * 在 pos 处插入 n 个元素，所有插入操作最终都落到这里。
+   * 设待插入的序列为 x[0, n)：
+   * fill(dst, skip, k) 把 x[skip, skip + k) 赋值到已构造的 [dst, dst + k)，
+   * construct(dst, skip, k) 把 x[skip, skip + k) 构造到未初始化的 [dst, dst + k)，
+   * 构造失败时 construct 自己负责销毁已构造的部分。
+   *
+   * 容量足够时（elems_after = finish - pos）：
+   *
+   *   elems_after > n:
+   *   | prefix | A A A B B |           ->  | prefix | x x | A A A | B B |
+   *            ^pos        ^finish                         (move_backward) (uninit move)
+   *
+   *   elems_after <= n:
+   *   | prefix | A A |                 ->  | prefix | x x | x x x | A A |
+   *            ^pos  ^finish                        (assign) (construct) (uninit move)
+   *
+   * 原有元素每个只移动一次，插入 k 个元素是 O(n + k) 而不是 O(n * k)。
+   * 容量不足时分配新存储，一遍完成：先构造新元素，再把前后两段搬过去。
+   */
+  template <class Fill, class Construct>
+  iterator M_insert_n(const_iterator cpos, size_type n, Fill fill,
+                      Construct construct) {
+    const size_type offset = cpos - start;
+    pointer pos = start + offset;
+    if (n == 0) {
+      return pos;
+    }
+    if (size_type(M_end_of_storage() - finish) >= n) {
+      const size_type elems_after = finish - pos;
+      pointer old_finish = finish;
+      if (elems_after > n) {
+        try {
+          for (pointer src = old_finish - n; src != old_finish; ++src) {
+            M_allocator().construct(finish, mystl::move(*src));
+            ++finish;
+          }
+        } catch (...) {
+          M_destroy_tail(old_finish);
+          throw;
+        }
+        std::move_backward(pos, old_finish - n, old_finish);
+        fill(pos, 0, n);
+      } else {
+        construct(old_finish, elems_after, n - elems_after);
+        finish += n - elems_after;
+        try {
+          for (pointer src = pos; src != old_finish; ++src) {
+            M_allocator().construct(finish, mystl::move(*src));
+            ++finish;
+          }
+        } catch (...) {
+          M_destroy_tail(old_finish);
+          throw;
+        }
+        fill(pos, 0, elems_after);
+      }
+      return pos;
+    }
+
+    const size_type new_cap = std::max(size() + n, 2 * size());
+    pointer new_start = M_allocator().allocate(new_cap);
+    pointer new_pos = new_start + offset;
+    pointer prefix_last = new_start;  // [new_start, prefix_last) 已构造
+    pointer suffix_last = new_pos;    // [new_pos, suffix_last) 已构造
+    try {
+      construct(new_pos, 0, n);
+      suffix_last = new_pos + n;
+      for (pointer src = pos; src != finish; ++src, ++suffix_last) {
+        M_allocator().construct(suffix_last, std::move_if_noexcept(*src));
+      }
+      for (pointer src = start; src != pos; ++src, ++prefix_last) {
+        M_allocator().construct(prefix_last, std::move_if_noexcept(*src));
+      }
+    } catch (...) {
+      for (pointer p = new_start; p != prefix_last; ++p) {
+        M_allocator().destroy(p);
+      }
+      for (pointer p = new_pos; p != suffix_last; ++p) {
+        M_allocator().destroy(p);
+      }
+      M_allocator().deallocate(new_start, new_cap);
+      throw;
+    }
+    for (pointer p = start; p != finish; ++p) {
+      M_allocator().destroy(p);
+    }
+    if (start != nullptr) {
+      M_allocator().deallocate(start, capacity());
+    }
+    finish = new_start + size() + n;
+    start = new_start;
+    M_end_of_storage() = new_start + new_cap;
+    return new_pos;
+  }
+
+  // 在 [dst, dst + n) 上构造元素，失败时销毁已构造的部分
+  template <class Init>
+  void M_uninitialized_init(pointer dst, size_type n, Init init) {
+    pointer cur = dst;
+    try {
+      for (size_type i = 0; i != n; ++i, ++cur) {
+        init(cur, i);
+      }
+    } catch (...) {
+      for (pointer p = dst; p != cur; ++p) {
+        M_allocator().destroy(p);
       }
-      allocator.deallocate(start, size_type(end_of_storage - start));
-      start = finish = end_of_storage = nullptr;
       throw;
     }
   }
@@ -108,31 +309,136 @@ class vector {
   void M_construct_ranges(InputIterator first, InputIterator last) {
     try {
       for (; first != last; ++first) {
-        allocator.construct(finish++, *first);
+        M_allocator().construct(finish, *first);
+        ++finish;
       }
     } catch (...) {
       for (auto p = start; p != finish; ++p) {
-        allocator.destroy(p);
+        M_allocator().destroy(p);
       }
-      allocator.deallocate(start, size_type(end_of_storage - start));
-      start = finish = end_of_storage = nullptr;
+      M_allocator().deallocate(start,
+                               size_type(M_end_of_storage() - start));
+      start = finish = M_end_of_storage() = nullptr;
       throw;
     }
   }
 
+  //===================================================================
+  //======================= parallel construct ========================
+  //===================================================================
+  // 每个线程至少负责的元素个数，太小的块开线程得不偿失
+  static constexpr size_type kParallelMinChunk = size_type(1) << 16;
+  // 一页能放下的元素个数，块边界按页对齐，避免两个线程 first-touch 同一页
+  static constexpr size_type kPageElements =
+      sizeof(T) >= 4096 ? 1 : 4096 / sizeof(T);
+
+  static size_type M_parallel_chunk_size(size_type n, std::size_t threads) {
+    if (threads == 0) {
+      threads = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+      threads = std::min<std::size_t>(
+          threads, std::max<size_type>(1, n / kParallelMinChunk));
+    }
+    threads = std::min<std::size_t>(threads, n);
+    size_type chunk = (n + threads - 1) / threads;
+    if (threads > 1) {
+      chunk = (chunk + kPageElements - 1) / kPageElements * kPageElements;
+    }
+    return chunk;
+  }
+
+  /*
+   * 把 [start, start + n) 切成按页对齐的若干块，每块交给一个线程构造。
+   * construct_at(p, i) 负责在 p 处构造第 i 个元素。
+   *
+   * 1. 每个线程自己 first-touch 自己那一块内存，在 NUMA 机器上页面会分散到
+   *    各个线程所在的节点上，而不是全部落在主线程所在的节点。
+   * 2. 异常安全：某一块构造失败时，该线程先销毁本块已构造的元素；所有线程结束后，
+   *    再销毁其它已完成的块，释放内存，重新抛出第一个异常，与串行版本语义一致。
+   * 3. 要求分配器的 construct/destroy 可以被多个线程同时调用（默认分配器无状态）。
+   */
+  template <class ConstructAt>
+  void M_parallel_construct(size_type n, std::size_t threads,
+                            ConstructAt construct_at) {
+    M_crate_storage(n);
+    const size_type chunk = M_parallel_chunk_size(n, threads);
+    const std::size_t chunks = (n + chunk - 1) / chunk;
+
+    std::vector<std::exception_ptr> errors;
+    try {
+      errors.resize(chunks);
+    } catch (...) {
+      M_allocator().deallocate(start, n);
+      start = finish = M_end_of_storage() = nullptr;
+      throw;
+    }
+
+    auto worker = [&](std::size_t i) {
+      pointer first = start + i * chunk;
+      pointer last = start + std::min(n, (i + 1) * chunk);
+      pointer cur = first;
+      try {
+        for (; cur != last; ++cur) {
+          construct_at(cur, size_type(cur - start));
+        }
+      } catch (...) {
+        for (pointer p = first; p != cur; ++p) {
+          M_allocator().destroy(p);
+        }
+        errors[i] = std::current_exception();
+      }
+    };
+
+    // 主线程自己负责第 0 块；线程创建失败时剩下的块也由主线程完成
+    std::vector<std::thread> workers;
+    std::size_t spawned = 1;
+    try {
+      workers.reserve(chunks - 1);
+      for (; spawned < chunks; ++spawned) {
+        workers.emplace_back(worker, spawned);
+      }
+    } catch (...) {
+    }
+    for (std::size_t i = spawned; i < chunks; ++i) {
+      worker(i);
+    }
+    worker(0);
+    for (auto& t : workers) {
+      t.join();
+    }
+
+    std::exception_ptr error;
+    for (std::size_t i = 0; i < chunks && !error; ++i) {
+      error = errors[i];
+    }
+    if (error) {
+      for (std::size_t i = 0; i < chunks; ++i) {
+        if (errors[i]) {
+          continue;  // 失败的块已经在线程内回滚
+        }
+        pointer last = start + std::min(n, (i + 1) * chunk);
+        for (pointer p = start + i * chunk; p != last; ++p) {
+          M_allocator().destroy(p);
+        }
+      }
+      M_allocator().deallocate(start, n);
+      start = finish = M_end_of_storage() = nullptr;
+      std::rethrow_exception(error);
+    }
+    finish = start + n;
+  }
+
  public:
   //===================================================================
   //======================== constructors =============================
   //===================================================================
   // 默认构造函数，委托给 vector(const Alloc&);
   vector() noexcept(noexcept(allocator_type())) : vector(allocator_type()) {}
-  explicit vector(const allocator_type& alloc) : allocator(alloc) {}
+  explicit vector(const allocator_type& alloc) : storage_end(nullptr, alloc) {}
 
   explicit vector(size_type n, const allocator_type& alloc = allocator_type())
       : start(nullptr),
         finish(nullptr),
-        end_of_storage(nullptr),
-        allocator(alloc) {
+        storage_end(nullptr, alloc) {
     if (n == 0) {
       return;
     }
@@ -145,8 +451,7 @@ class vector {
                   const allocator_type& alloc = allocator_type())
       : start(nullptr),
         finish(nullptr),
-        end_of_storage(nullptr),
-        allocator(alloc) {
+        storage_end(nullptr, alloc) {
     if (n == 0) {
       return;
     }
@@ -160,33 +465,77 @@ class vector {
                 std::input_iterator_tag>::value>>
   vector(InputIterator first, InputIterator last,
          const allocator_type& alloc = allocator_type())
-      : allocator(alloc) {
+      : storage_end(nullptr, alloc) {
     size_type n = std::distance(first, last);
     M_crate_storage(n);
     M_construct_ranges(first, last);
   }
 
-  vector(const vector& other) {
+  // 并行构造版本，语义与对应的串行构造函数相同
+  vector(parallel_construct_t policy, size_type n,
+         const allocator_type& alloc = allocator_type())
+      : storage_end(nullptr, alloc) {
+    if (n == 0) {
+      return;
+    }
+    M_parallel_construct(n, policy.threads, [this](pointer p, size_type) {
+      M_allocator().construct(p);
+    });
+  }
+
+  vector(parallel_construct_t policy, size_type n, const T& value,
+         const allocator_type& alloc = allocator_type())
+      : storage_end(nullptr, alloc) {
+    if (n == 0) {
+      return;
+    }
+    M_parallel_construct(n, policy.threads,
+                         [this, &value](pointer p, size_type) {
+                           M_allocator().construct(p, value);
+                         });
+  }
+
+  // 只有随机访问迭代器才能 O(1) 地定位每一块的起点
+  template <class RandomIt,
+            typename = std::enable_if_t<std::is_convertible<
+                typename std::iterator_traits<RandomIt>::iterator_category,
+                std::random_access_iterator_tag>::value>>
+  vector(parallel_construct_t policy, RandomIt first, RandomIt last,
+         const allocator_type& alloc = allocator_type())
+      : storage_end(nullptr, alloc) {
+    size_type n = std::distance(first, last);
+    if (n == 0) {
+      return;
+    }
+    M_parallel_construct(n, policy.threads,
+                         [this, first](pointer p, size_type i) {
+                           M_allocator().construct(p, first[i]);
+                         });
+  }
+
+  vector(const vector& other)
+      : storage_end(nullptr, std::allocator_traits<Alloc>::
+                                 select_on_container_copy_construction(
+                                     other.get_allocator())) {
     if (this != &other) {
-      allocator =
-          std::allocator_traits<Alloc>::select_on_container_copy_construction(
-              other.get_allocator());
       size_type n = other.size();
       this->M_crate_storage(n);
       this->M_construct_ranges(other.begin(), other.end());
     }
   }
 
-  vector(vector&& other) noexcept : allocator(mystl::move(other.allocator)) {
+  vector(vector&& other) noexcept
+      : storage_end(nullptr, mystl::move(other.M_allocator())) {
     this->start = other.start;
     this->finish = other.finish;
-    this->end_of_storage = other.end_of_storage;
+    this->M_end_of_storage() = other.M_end_of_storage();
     other.start = nullptr;
     other.finish = nullptr;
-    other.end_of_storage = nullptr;
+    other.M_end_of_storage() = nullptr;
   }
 
-  vector(const vector& other, const allocator_type& alloc) : allocator(alloc) {
+  vector(const vector& other, const allocator_type& alloc)
+      : storage_end(nullptr, alloc) {
     if (this != &other) {
       size_type n = other.size();
       this->M_crate_storage(n);
@@ -195,35 +544,60 @@ class vector {
   }
 
   vector(vector&& other, const allocator_type& alloc)
-      : allocator(mystl::move(alloc)) {
+      : storage_end(nullptr, mystl::move(alloc)) {
     this->start = other.start;
     this->finish = other.finish;
-    this->end_of_storage = other.end_of_storage;
+    this->M_end_of_storage() = other.M_end_of_storage();
     other.start = nullptr;
     other.finish = nullptr;
-    other.end_of_storage = nullptr;
+    other.M_end_of_storage() = nullptr;
   }
 
   vector(std::initializer_list<T> init,
          const allocator_type& alloc = allocator_type())
-      : allocator(alloc) {
+      : storage_end(nullptr, alloc) {
     size_type n = init.size();
     this->M_crate_storage(n);
     this->M_construct_ranges(init.begin(), init.end());
   }
 
+  vector& operator=(const vector& other) {
+    if (this != &other) {
+      vector tmp(other, M_allocator());
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  vector& operator=(vector&& other) noexcept {
+    if (this != &other) {
+      vector tmp(mystl::move(other));
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  ~vector() {
+    for (auto p = start; p != finish; ++p) {
+      M_allocator().destroy(p);
+    }
+    if (start != nullptr) {
+      M_allocator().deallocate(start, capacity());
+    }
+  }
+
   //===================================================================
   //======================= elements access ===========================
   //===================================================================
   reference at(size_type pos) {
-    if(pos >= this->size()) {
-      throw std::out_of_range("at: pos is out of range!") 
+    if (pos >= this->size()) {
+      throw std::out_of_range("at: pos is out of range!");
     }
     return *(start + pos);
   }
   const_reference at(size_type pos) const {
-    if(pos >= this->size()) {
-      throw std::out_of_range("at: pos is out of range!") 
+    if (pos >= this->size()) {
+      throw std::out_of_range("at: pos is out of range!");
     }
     return *(start + pos);
   }
@@ -250,14 +624,203 @@ class vector {
     return *(finish - 1);
   }
 
-  T* data() {}
+  T* data() noexcept { return start; }
 
-  const T* data() {}
+  const T* data() const noexcept { return start; }
+
+  //===================================================================
+  //=========================== iterators =============================
+  //===================================================================
+  iterator begin() noexcept { return start; }
+  const_iterator begin() const noexcept { return start; }
+  const_iterator cbegin() const noexcept { return start; }
+
+  iterator end() noexcept { return finish; }
+  const_iterator end() const noexcept { return finish; }
+  const_iterator cend() const noexcept { return finish; }
+
+  //===================================================================
+  //=========================== capacity ==============================
+  //===================================================================
+  bool empty() const noexcept { return start == finish; }
 
   size_type size() const { return finish - start; }
 
-  allocator_type get_allocator() const { return allocator; }
+  size_type capacity() const noexcept { return M_end_of_storage() - start; }
+
+  void reserve(size_type n) {
+    if (n > capacity()) {
+      M_reallocate(n);
+    }
+  }
+
+  //===================================================================
+  //=========================== modifiers =============================
+  //===================================================================
+  void resize(size_type n) {
+    if (n <= size()) {
+      M_destroy_tail(start + n);
+    } else {
+      M_append(n - size(), [this](pointer p) { M_allocator().construct(p); });
+    }
+  }
+
+  void resize(size_type n, const T& value) {
+    if (n <= size()) {
+      M_destroy_tail(start + n);
+    } else {
+      // value 可能是 vector 内部的元素，扩容前先拷贝一份
+      T copy(value);
+      M_append(n - size(),
+               [this, &copy](pointer p) { M_allocator().construct(p, copy); });
+    }
+  }
+
+  void resize(size_type n, default_init_t) {
+    if (n <= size()) {
+      M_destroy_tail(start + n);
+    } else {
+      M_append(n - size(), [](pointer p) { ::new (static_cast<void*>(p)) T; });
+    }
+  }
+
+  void clear() noexcept { M_destroy_tail(start); }
+
+  template <class... Args>
+  reference emplace_back(Args&&... args) {
+    if (finish == M_end_of_storage()) {
+      // args 可能引用 vector 内部的元素，先在新存储中构造新元素
+      M_insert_n(finish, 1, [](pointer, size_type, size_type) {},
+                 [&](pointer p, size_type, size_type) {
+                   M_allocator().construct(p, mystl::forward<Args>(args)...);
+                 });
+    } else {
+      M_allocator().construct(finish, mystl::forward<Args>(args)...);
+      ++finish;
+    }
+    return back();
+  }
+
+  void push_back(const T& value) { emplace_back(value); }
+
+  void push_back(T&& value) { emplace_back(mystl::move(value)); }
+
+  void pop_back() {
+    --finish;
+    M_allocator().destroy(finish);
+  }
+
+  iterator insert(const_iterator pos, const T& value) {
+    return insert(pos, size_type(1), value);
+  }
+
+  iterator insert(const_iterator pos, size_type n, const T& value) {
+    // value 可能是 vector 内部的元素，移动之前先拷贝一份
+    T copy(value);
+    return M_insert_n(
+        pos, n,
+        [&copy](pointer dst, size_type, size_type k) {
+          std::fill_n(dst, k, copy);
+        },
+        [this, &copy](pointer dst, size_type, size_type k) {
+          M_uninitialized_init(dst, k, [this, &copy](pointer p, size_type) {
+            M_allocator().construct(p, copy);
+          });
+        });
+  }
+
+  template <class InputIterator,
+            typename = std::enable_if_t<std::is_convertible<
+                typename std::iterator_traits<InputIterator>::iterator_category,
+                std::input_iterator_tag>::value>>
+  iterator insert(const_iterator pos, InputIterator first,
+                  InputIterator last) {
+    using category =
+        typename std::iterator_traits<InputIterator>::iterator_category;
+    if constexpr (std::is_convertible<category,
+                                      std::forward_iterator_tag>::value) {
+      const size_type n = std::distance(first, last);
+      return M_insert_n(
+          pos, n,
+          [first](pointer dst, size_type skip, size_type k) {
+            std::copy_n(std::next(first, skip), k, dst);
+          },
+          [this, first](pointer dst, size_type skip, size_type k) {
+            auto it = std::next(first, skip);
+            M_uninitialized_init(dst, k, [this, &it](pointer p, size_type) {
+              M_allocator().construct(p, *it);
+              ++it;
+            });
+          });
+    } else {
+      // 单遍迭代器无法预先知道长度，先收集到临时 vector 中
+      const size_type offset = pos - start;
+      vector tmp(M_allocator());
+      for (; first != last; ++first) {
+        tmp.emplace_back(*first);
+      }
+      return insert(start + offset, std::make_move_iterator(tmp.begin()),
+                    std::make_move_iterator(tmp.end()));
+    }
+  }
+
+  iterator insert(const_iterator pos, std::initializer_list<T> init) {
+    return insert(pos, init.begin(), init.end());
+  }
+
+  // 删除 [first, last)，后面的元素整体前移一次
+  iterator erase(const_iterator first, const_iterator last) {
+    pointer dst = start + (first - start);
+    if (first != last) {
+      pointer new_finish =
+          std::move(start + (last - start), finish, dst);
+      M_destroy_tail(new_finish);
+    }
+    return dst;
+  }
+
+  iterator erase(const_iterator pos) { return erase(pos, pos + 1); }
+
+  void swap(vector& other) noexcept {
+    using std::swap;
+    swap(start, other.start);
+    swap(finish, other.finish);
+    swap(M_end_of_storage(), other.M_end_of_storage());
+    swap(M_allocator(), other.M_allocator());
+  }
+
+  allocator_type get_allocator() const { return M_allocator(); }
 };
+
+// erase_if: 一遍扫描把保留的元素依次前移（compaction），再统一销毁尾部，
+// 每个保留下来的元素最多移动一次；返回删除的元素个数
+template <class T, class Alloc, class Pred>
+typename vector<T, Alloc>::size_type erase_if(vector<T, Alloc>& v,
+                                              Pred pred) {
+  auto first = v.begin();
+  auto last = v.end();
+  for (; first != last && !pred(*first); ++first) {
+  }
+  if (first == last) {
+    return 0;
+  }
+  auto dst = first;
+  for (++first; first != last; ++first) {
+    if (!pred(*first)) {
+      *dst = mystl::move(*first);
+      ++dst;
+    }
+  }
+  const auto removed = typename vector<T, Alloc>::size_type(last - dst);
+  v.erase(dst, last);
+  return removed;
+}
+
+template <class T, class Alloc, class U>
+typename vector<T, Alloc>::size_type erase(vector<T, Alloc>& v,
+                                           const U& value) {
+  return mystl::erase_if(v, [&value](const T& elem) { return elem == value; });
+}
 }  // namespace mystl
 
 #endif
\ No newline at end of file
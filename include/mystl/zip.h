@@ -0,0 +1,330 @@
+#ifndef __MYSTL_ZIP_H__
+#define __MYSTL_ZIP_H__
+
+#include <algorithm>  // for std::min
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include "mystl/tuple.h"
+#include "mystl/utility.h"
+
+namespace mystl {
+/*
+ * zip(c1, c2, ...): 把几列等长（取最短）的随机访问容器看成一列 tuple
+ *
+ * 解引用得到 zip_reference<T1&, T2&, ...>（派生自 mystl::tuple<T1&, T2&, ...>），
+ * 对它赋值就是对各列对应位置赋值。迭代器满足随机访问迭代器的要求，
+ * 可以直接交给 std::sort 等算法，原地重排平行数组，不需要先拷贝成 vector<pair>：
+ *
+ *   mystl::vector<int> keys = ...;
+ *   mystl::vector<std::string> values = ...;
+ *   auto z = mystl::zip(keys, values);
+ *   std::sort(z.begin(), z.end());          // 按 (key, value) 字典序
+ *   std::sort(z.begin(), z.end(), [](const auto& a, const auto& b) {
+ *     return mystl::get<0>(a) < mystl::get<0>(b);
+ *   });
+ *
+ * 迭代器里存各列的起始迭代器和一个公共下标，移动迭代器只改下标。
+ * value_type 是 zip_value<T1, T2, ...>（派生自 mystl::tuple<T1, T2, ...>），
+ * 从引用 tuple 的右值构造或赋值时移动各列元素，所以算法里的
+ * value_type tmp = std::move(*it) 不会拷贝。zip_reference 之间的右值赋值
+ * *a = std::move(*b) 同样移动被引用的对象，所以排序既不拷贝元素，也能排只能移动的列。
+ * 注意 *it 本身就是右值：value_type tmp = *it 和 *a = *b 也会移动，
+ * 需要拷贝时先绑定到 const 引用，再用它构造或赋值。
+ *
+ * zip 不拥有容器，容器必须比视图和迭代器活得久。
+ */
+/*
+ * zip_iterator 的 value_type
+ *
+ * 引用 tuple 作为右值时 get<I> 得到的仍是左值引用，mystl::tuple 的转换构造只能拷贝。
+ * 这里对 tuple<Refs...>&& 单独处理：移动每个被引用的对象。
+ */
+template <class... Types>
+class zip_value : public mystl::tuple<Types...> {
+  using base = mystl::tuple<Types...>;
+
+  template <class... Refs>
+  static constexpr bool is_refs_v =
+      sizeof...(Refs) == sizeof...(Types) &&
+      (std::is_lvalue_reference<Refs>::value && ...);
+
+  template <class Refs, std::size_t... Is>
+  zip_value(Refs& refs, std::index_sequence<Is...>)
+      : base(mystl::move(mystl::get<Is>(refs))...) {}
+
+  template <class Refs, std::size_t... Is>
+  void M_move_from(Refs& refs, std::index_sequence<Is...>) {
+    ((mystl::get<Is>(static_cast<base&>(*this)) =
+          mystl::move(mystl::get<Is>(refs))),
+     ...);
+  }
+
+ public:
+  using base::base;
+
+  zip_value() = default;
+
+  template <class... Refs,
+            typename std::enable_if<is_refs_v<Refs...>, int>::type = 0>
+  zip_value(mystl::tuple<Refs...>&& refs)
+      : zip_value(refs, std::index_sequence_for<Types...>{}) {}
+
+  template <class... Refs,
+            typename std::enable_if<is_refs_v<Refs...>, int>::type = 0>
+  zip_value& operator=(mystl::tuple<Refs...>&& refs) {
+    M_move_from(refs, std::index_sequence_for<Types...>{});
+    return *this;
+  }
+};
+
+/*
+ * zip_iterator 的 reference
+ *
+ * mystl::tuple<T&...> 的移动赋值对引用元素做的是拷贝赋值（与 mystl::tie 一致）。
+ * zip_reference 的右值赋值改为移动每个被引用的对象；从 const 引用赋值仍然拷贝。
+ * 从 zip_value 等值 tuple 的右值赋值由 mystl::tuple 的转换赋值完成，本来就是移动。
+ */
+template <class... Refs>
+class zip_reference : public mystl::tuple<Refs...> {
+  using base = mystl::tuple<Refs...>;
+
+  template <std::size_t... Is>
+  void M_copy_from(const zip_reference& other, std::index_sequence<Is...>) {
+    ((mystl::get<Is>(static_cast<base&>(*this)) =
+          mystl::get<Is>(static_cast<const base&>(other))),
+     ...);
+  }
+
+  template <std::size_t... Is>
+  void M_move_from(zip_reference& other, std::index_sequence<Is...>) {
+    ((mystl::get<Is>(static_cast<base&>(*this)) =
+          mystl::move(mystl::get<Is>(static_cast<base&>(other)))),
+     ...);
+  }
+
+ public:
+  using base::base;
+  using base::operator=;
+
+  zip_reference(const zip_reference&) = default;
+  zip_reference(zip_reference&&) = default;
+
+  zip_reference& operator=(const zip_reference& other) {
+    M_copy_from(other, std::index_sequence_for<Refs...>{});
+    return *this;
+  }
+
+  zip_reference& operator=(zip_reference&& other) {
+    M_move_from(other, std::index_sequence_for<Refs...>{});
+    return *this;
+  }
+};
+
+template <class... Iters>
+class zip_iterator {
+  static_assert(sizeof...(Iters) >= 1, "zip needs at least one range");
+  static_assert(
+      (std::is_base_of<std::random_access_iterator_tag,
+                       typename std::iterator_traits<
+                           Iters>::iterator_category>::value &&
+       ...),
+      "zip requires random access ranges");
+
+ public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type =
+      zip_value<typename std::iterator_traits<Iters>::value_type...>;
+  using reference =
+      zip_reference<typename std::iterator_traits<Iters>::reference...>;
+  using difference_type = std::ptrdiff_t;
+  using pointer = void;
+
+ private:
+  mystl::tuple<Iters...> firsts;
+  difference_type pos{0};
+
+  template <std::size_t... Is>
+  reference M_deref(difference_type i, std::index_sequence<Is...>) const {
+    return reference(mystl::get<Is>(firsts)[i]...);
+  }
+
+ public:
+  zip_iterator() = default;
+
+  zip_iterator(const mystl::tuple<Iters...>& first, difference_type n)
+      : firsts(first), pos(n) {}
+
+  reference operator*() const {
+    return M_deref(pos, std::index_sequence_for<Iters...>{});
+  }
+
+  reference operator[](difference_type n) const {
+    return M_deref(pos + n, std::index_sequence_for<Iters...>{});
+  }
+
+  // 当前位置的下标，即到 zip 视图开头的距离
+  difference_type index() const noexcept { return pos; }
+
+  zip_iterator& operator++() noexcept {
+    ++pos;
+    return *this;
+  }
+
+  zip_iterator operator++(int) noexcept {
+    zip_iterator tmp = *this;
+    ++pos;
+    return tmp;
+  }
+
+  zip_iterator& operator--() noexcept {
+    --pos;
+    return *this;
+  }
+
+  zip_iterator operator--(int) noexcept {
+    zip_iterator tmp = *this;
+    --pos;
+    return tmp;
+  }
+
+  zip_iterator& operator+=(difference_type n) noexcept {
+    pos += n;
+    return *this;
+  }
+
+  zip_iterator& operator-=(difference_type n) noexcept {
+    pos -= n;
+    return *this;
+  }
+
+  friend zip_iterator operator+(zip_iterator it, difference_type n) noexcept {
+    return it += n;
+  }
+
+  friend zip_iterator operator+(difference_type n, zip_iterator it) noexcept {
+    return it += n;
+  }
+
+  friend zip_iterator operator-(zip_iterator it, difference_type n) noexcept {
+    return it -= n;
+  }
+
+  // 同一个 zip 视图上的迭代器只需要比较下标
+  friend difference_type operator-(const zip_iterator& lhs,
+                                   const zip_iterator& rhs) noexcept {
+    return lhs.pos - rhs.pos;
+  }
+
+  friend bool operator==(const zip_iterator& lhs,
+                         const zip_iterator& rhs) noexcept {
+    return lhs.pos == rhs.pos;
+  }
+
+  friend bool operator!=(const zip_iterator& lhs,
+                         const zip_iterator& rhs) noexcept {
+    return lhs.pos != rhs.pos;
+  }
+
+  friend bool operator<(const zip_iterator& lhs,
+                        const zip_iterator& rhs) noexcept {
+    return lhs.pos < rhs.pos;
+  }
+
+  friend bool operator>(const zip_iterator& lhs,
+                        const zip_iterator& rhs) noexcept {
+    return lhs.pos > rhs.pos;
+  }
+
+  friend bool operator<=(const zip_iterator& lhs,
+                         const zip_iterator& rhs) noexcept {
+    return lhs.pos <= rhs.pos;
+  }
+
+  friend bool operator>=(const zip_iterator& lhs,
+                         const zip_iterator& rhs) noexcept {
+    return lhs.pos >= rhs.pos;
+  }
+};
+
+template <class... Iters>
+class zip_view {
+ public:
+  using iterator = zip_iterator<Iters...>;
+  using value_type = typename iterator::value_type;
+  using reference = typename iterator::reference;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+
+ private:
+  mystl::tuple<Iters...> firsts;
+  size_type count{0};
+
+ public:
+  zip_view() = default;
+
+  zip_view(const mystl::tuple<Iters...>& first, size_type n)
+      : firsts(first), count(n) {}
+
+  iterator begin() const { return iterator(firsts, 0); }
+
+  iterator end() const { return iterator(firsts, difference_type(count)); }
+
+  size_type size() const noexcept { return count; }
+
+  bool empty() const noexcept { return count == 0; }
+
+  reference operator[](size_type pos) const {
+    return begin()[difference_type(pos)];
+  }
+};
+
+namespace detail {
+template <class Tuple, std::size_t... Is>
+void swap_referents(Tuple& lhs, Tuple& rhs, std::index_sequence<Is...>) {
+  using std::swap;
+  (swap(mystl::get<Is>(lhs), mystl::get<Is>(rhs)), ...);
+}
+}  // namespace detail
+
+// 元素都是引用的 tuple 作为右值也能交换，交换的是被引用的对象。
+// zip 迭代器解引用得到的是临时 tuple，std::iter_swap 通过 ADL 找到这个重载。
+template <class... Types>
+void swap(mystl::tuple<Types&...>&& lhs, mystl::tuple<Types&...>&& rhs) {
+  detail::swap_referents(lhs, rhs, std::index_sequence_for<Types...>{});
+}
+
+// zip 只接受左值容器（或其他视图），长度取最短的那一列
+template <class... Ranges>
+zip_view<decltype(std::begin(std::declval<Ranges&>()))...> zip(
+    Ranges&... ranges) {
+  static_assert(sizeof...(Ranges) >= 1, "zip needs at least one range");
+  using view = zip_view<decltype(std::begin(std::declval<Ranges&>()))...>;
+  const std::size_t n = std::min({std::size_t(std::size(ranges))...});
+  return view(mystl::tuple<decltype(std::begin(std::declval<Ranges&>()))...>(
+                  std::begin(ranges)...),
+              n);
+}
+}  // namespace mystl
+
+namespace std {
+// 结构化绑定
+template <class... Types>
+struct tuple_size<mystl::zip_value<Types...>>
+    : std::integral_constant<std::size_t, sizeof...(Types)> {};
+
+template <std::size_t I, class... Types>
+struct tuple_element<I, mystl::zip_value<Types...>>
+    : tuple_element<I, mystl::tuple<Types...>> {};
+
+template <class... Refs>
+struct tuple_size<mystl::zip_reference<Refs...>>
+    : std::integral_constant<std::size_t, sizeof...(Refs)> {};
+
+template <std::size_t I, class... Refs>
+struct tuple_element<I, mystl::zip_reference<Refs...>>
+    : tuple_element<I, mystl::tuple<Refs...>> {};
+}  // namespace std
+
+#endif
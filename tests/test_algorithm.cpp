@@ -0,0 +1,209 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+#include "mystl/algorithm.h"
+#include "mystl/array.h"
+#include "mystl/vector.h"
+#include "mystl/zip.h"
+#include "utils/test_types.h"
+
+namespace {
+// 各种分布的输入，覆盖 pdqsort 的各个分支
+std::vector<std::vector<int>> make_inputs(std::size_t n) {
+  std::mt19937 rng(2024);
+  std::vector<std::vector<int>> inputs;
+  std::vector<int> v(n);
+
+  for (auto& x : v) x = int(rng());
+  inputs.push_back(v);  // 随机
+  std::sort(v.begin(), v.end());
+  inputs.push_back(v);  // 有序
+  std::reverse(v.begin(), v.end());
+  inputs.push_back(v);  // 逆序
+  for (std::size_t i = 0; i < n; ++i) {
+    v[i] = int(i < n / 2 ? i : n - i);
+  }
+  inputs.push_back(v);  // 先升后降
+  for (auto& x : v) x = int(rng() % 4);
+  inputs.push_back(v);  // 少量不同值
+  for (auto& x : v) x = 7;
+  inputs.push_back(v);  // 全部相等
+  for (std::size_t i = 0; i < n; ++i) v[i] = int(i);
+  for (std::size_t i = 0; n > 0 && i < n / 50 + 1; ++i) {
+    std::swap(v[rng() % n], v[rng() % n]);
+  }
+  inputs.push_back(v);  // 几乎有序
+  return inputs;
+}
+
+const std::size_t kSizes[] = {0, 1, 2, 3, 10, 23, 24, 25, 100, 129, 1000, 50000};
+}  // namespace
+
+TEST(AlgorithmTest, SortMatchesStd) {
+  for (std::size_t n : kSizes) {
+    for (const auto& input : make_inputs(n)) {
+      std::vector<int> expected = input;
+      std::sort(expected.begin(), expected.end());
+
+      mystl::vector<int> v(input.begin(), input.end());
+      mystl::sort(v.begin(), v.end());
+      EXPECT_TRUE(std::equal(v.begin(), v.end(), expected.begin(),
+                             expected.end()))
+          << "n = " << n;
+
+      // 带比较器：走分支版本的划分
+      std::vector<int> desc = input;
+      mystl::sort(desc.begin(), desc.end(),
+                  [](int a, int b) { return a > b; });
+      EXPECT_TRUE(std::equal(desc.rbegin(), desc.rend(), expected.begin(),
+                             expected.end()))
+          << "n = " << n;
+    }
+  }
+}
+
+TEST(AlgorithmTest, SortTypes) {
+  mystl::array<double, 6> a = {3.5, -1.0, 2.0, 0.0, -7.25, 2.0};
+  mystl::sort(a.begin(), a.end(), std::greater<>());
+  EXPECT_TRUE(std::is_sorted(a.begin(), a.end(), std::greater<>()));
+
+  std::vector<std::string> s;
+  std::mt19937 rng(1);
+  for (int i = 0; i < 500; ++i) {
+    s.push_back(std::to_string(rng() % 300));
+  }
+  std::vector<std::string> expected = s;
+  std::sort(expected.begin(), expected.end());
+  mystl::sort(s.begin(), s.end());
+  EXPECT_EQ(s, expected);
+
+  // 仅可移动类型
+  std::vector<mystl::test::MoveOnly> mo;
+  for (int i = 0; i < 200; ++i) {
+    mo.emplace_back(int(rng() % 1000));
+  }
+  auto by_value = [](const mystl::test::MoveOnly& a,
+                     const mystl::test::MoveOnly& b) {
+    return a.value() < b.value();
+  };
+  mystl::sort(mo.begin(), mo.end(), by_value);
+  EXPECT_TRUE(std::is_sorted(mo.begin(), mo.end(), by_value));
+}
+
+TEST(AlgorithmTest, SortZipColumns) {
+  std::mt19937 rng(3);
+  mystl::vector<int> keys(5000);
+  mystl::vector<int> ids(5000);
+  for (int i = 0; i < 5000; ++i) {
+    keys[i] = int(rng() % 100);
+    ids[i] = i;
+  }
+  const mystl::vector<int> original = keys;
+  auto z = mystl::zip(keys, ids);
+  mystl::sort(z.begin(), z.end());
+  EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end()));
+  for (int i = 0; i < 5000; ++i) {
+    EXPECT_EQ(original[ids[i]], keys[i]);
+  }
+  // 同 key 内按 id 升序（整行字典序）
+  for (int i = 1; i < 5000; ++i) {
+    if (keys[i] == keys[i - 1]) {
+      EXPECT_LT(ids[i - 1], ids[i]);
+    }
+  }
+}
+
+TEST(AlgorithmTest, StableSort) {
+  for (std::size_t n : kSizes) {
+    for (const auto& input : make_inputs(n)) {
+      // 只按 key / 8 排序，相等的元素必须保持原来的相对顺序
+      std::vector<mystl::pair<int, std::size_t>> v;
+      for (std::size_t i = 0; i < input.size(); ++i) {
+        v.emplace_back(input[i] / 8, i);
+      }
+      auto expected = v;
+      auto by_key = [](const auto& a, const auto& b) {
+        return a.first < b.first;
+      };
+      std::stable_sort(expected.begin(), expected.end(), by_key);
+      mystl::stable_sort(v.begin(), v.end(), by_key);
+      ASSERT_EQ(v.size(), expected.size());
+      for (std::size_t i = 0; i < v.size(); ++i) {
+        EXPECT_EQ(v[i].first, expected[i].first);
+        EXPECT_EQ(v[i].second, expected[i].second) << "n = " << n;
+      }
+    }
+  }
+
+  // 元素只被移动，不被拷贝；缓冲区里构造的元素都被析构
+  using mystl::test::Perfect;
+  std::vector<Perfect> p;
+  std::mt19937 rng(5);
+  for (int i = 0; i < 1000; ++i) {
+    p.emplace_back(int(rng() % 100));
+  }
+  Perfect::counter.reset();
+  mystl::stable_sort(p.begin(), p.end(), [](const Perfect& a, const Perfect& b) {
+    return a.value() < b.value();
+  });
+  EXPECT_EQ(Perfect::counter.copy_constructor, 0);
+  EXPECT_EQ(Perfect::counter.copy_assign, 0);
+  EXPECT_EQ(Perfect::counter.default_constructor +
+                Perfect::counter.move_constructor,
+            Perfect::counter.deconstructor);
+  EXPECT_TRUE(std::is_sorted(p.begin(), p.end(),
+                             [](const Perfect& a, const Perfect& b) {
+                               return a.value() < b.value();
+                             }));
+}
+
+TEST(AlgorithmTest, PartialSort) {
+  for (std::size_t n : kSizes) {
+    for (const auto& input : make_inputs(n)) {
+      std::vector<int> expected = input;
+      std::sort(expected.begin(), expected.end());
+      for (std::size_t k : {std::size_t(0), std::size_t(1), n / 3, n}) {
+        if (k > n) {
+          continue;
+        }
+        std::vector<int> v = input;
+        mystl::partial_sort(v.begin(), v.begin() + k, v.end());
+        EXPECT_TRUE(std::equal(v.begin(), v.begin() + k, expected.begin()))
+            << "n = " << n << " k = " << k;
+        // 剩下的元素还在，只是顺序不定
+        std::sort(v.begin() + k, v.end());
+        EXPECT_EQ(v, expected);
+      }
+    }
+  }
+}
+
+TEST(AlgorithmTest, NthElement) {
+  for (std::size_t n : kSizes) {
+    if (n == 0) {
+      continue;
+    }
+    for (const auto& input : make_inputs(n)) {
+      std::vector<int> expected = input;
+      std::sort(expected.begin(), expected.end());
+      for (std::size_t k : {std::size_t(0), n / 2, n - 1}) {
+        mystl::vector<int> v(input.begin(), input.end());
+        mystl::nth_element(v.begin(), v.begin() + k, v.end());
+        ASSERT_EQ(v[k], expected[k]) << "n = " << n << " k = " << k;
+        for (std::size_t i = 0; i < k; ++i) {
+          EXPECT_LE(v[i], v[k]);
+        }
+        for (std::size_t i = k + 1; i < n; ++i) {
+          EXPECT_GE(v[i], v[k]);
+        }
+      }
+    }
+  }
+
+  std::vector<std::string> s = {"d", "a", "c", "b", "e"};
+  mystl::nth_element(s.begin(), s.begin() + 1, s.end(), std::greater<>());
+  EXPECT_EQ(s[1], "d");
+}
@@ -0,0 +1,92 @@
+#include <cstdint>
+#include <numeric>  // for std::iota
+#include <stdexcept>
+#include "gtest/gtest.h"
+#include "mystl/aligned_array.h"
+
+// --- 测试 mystl::aligned_array ---
+
+TEST(AlignedArrayTest, AlignmentAndPadding) {
+  using A = mystl::aligned_array<float, 10, 32>;
+  static_assert(alignof(A) == 32, "alignment");
+  static_assert(A::lanes * sizeof(float) == A::vector_bytes, "lanes");
+  static_assert(A::vector_bytes <= 32, "vector width never exceeds Align");
+  static_assert(sizeof(A) == 16 * sizeof(float), "padded to whole vectors");
+
+  using B = mystl::aligned_array<double, 16>;
+  static_assert(alignof(B) == 64 && sizeof(B) == 128, "exact multiple");
+
+  using C = mystl::aligned_array<std::uint8_t, 1>;
+  static_assert(sizeof(C) == 64, "a single byte still occupies a vector");
+
+  A a{};
+  EXPECT_EQ(a.size(), 10);
+  EXPECT_EQ(a.padded_size(), 16);
+  EXPECT_EQ(a.vector_count() * a.lanes, 16);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(a.data()) % 32, 0);
+  EXPECT_EQ(a.end() - a.begin(), 10);
+
+  // 数组中的每个元素都对齐
+  mystl::aligned_array<float, 3, 16> many[5];
+  for (auto& x : many) {
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(x.data()) % 16, 0);
+  }
+}
+
+TEST(AlignedArrayTest, ElementAccessAndFill) {
+  mystl::aligned_array<int, 5, 32> a;
+  a.fill(3);
+  EXPECT_EQ(a.front(), 3);
+  EXPECT_EQ(a.back(), 3);
+  // 填充部分被清零
+  for (std::size_t i = a.size(); i < a.padded_size(); ++i) {
+    EXPECT_EQ(a.data()[i], 0);
+  }
+  a.at(4) = 9;
+  EXPECT_EQ(a[4], 9);
+  EXPECT_THROW(a.at(5), std::out_of_range);
+
+  mystl::aligned_array<int, 5, 32> b{};
+  EXPECT_TRUE(a != b);
+  b.fill(3);
+  b[4] = 9;
+  EXPECT_TRUE(a == b);
+  // 填充内容不参与比较
+  b.data()[7] = 42;
+  EXPECT_TRUE(a == b);
+
+  b[0] = -1;
+  std::swap(a, b);
+  EXPECT_EQ(a[0], -1);
+  EXPECT_EQ(b[0], 3);
+}
+
+#if defined(__GNUC__)
+TEST(AlignedArrayTest, LoadStore) {
+  mystl::aligned_array<float, 13, 16> a;
+  std::iota(a.begin(), a.end(), 1.0f);
+  a.clear_padding();
+
+  // 逐块计算 2x + 1，没有尾部循环
+  for (std::size_t b = 0; b < a.vector_count(); ++b) {
+    a.store(b, a.load(b) * 2.0f + 1.0f);
+  }
+  for (std::size_t i = 0; i < a.size(); ++i) {
+    EXPECT_EQ(a[i], 2.0f * float(i + 1) + 1.0f);
+  }
+
+  // 点积：填充为零，不影响结果
+  mystl::aligned_array<float, 13, 16> x, y;
+  x.fill(2.0f);
+  y.fill(3.0f);
+  decltype(x)::vector_type acc = {};
+  for (std::size_t b = 0; b < x.vector_count(); ++b) {
+    acc += x.load(b) * y.load(b);
+  }
+  float sum = 0;
+  for (std::size_t l = 0; l < x.lanes; ++l) {
+    sum += acc[l];
+  }
+  EXPECT_EQ(sum, 13 * 6.0f);
+}
+#endif
@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <cmath>    // for NAN
+#include <cstdint>
 #include <memory>   // for std::unique_ptr
 #include <numeric>  // for std::accumulate
 #include <string>
@@ -210,4 +213,217 @@ TEST(ArrayTest, TupleInterface) {
 
   // 仅仅为了让测试不显示 "empty test" 警告
   EXPECT_TRUE(true);
-}
\ No newline at end of file
+}
+
+namespace {
+// 与 std::equal / std::lexicographical_compare 的结果逐一对照
+template <class T, std::size_t N>
+void expect_same_order(const mystl::array<T, N>& a,
+                       const mystl::array<T, N>& b) {
+  EXPECT_EQ(a == b, std::equal(a.begin(), a.end(), b.begin()));
+  EXPECT_EQ(a < b, std::lexicographical_compare(a.begin(), a.end(), b.begin(),
+                                                b.end()));
+  EXPECT_EQ(b < a, std::lexicographical_compare(b.begin(), b.end(), a.begin(),
+                                                a.end()));
+}
+
+template <class T, std::size_t N>
+void check_every_position(T low, T high) {
+  mystl::array<T, N> a;
+  a.fill(low);
+  for (std::size_t i = 0; i < N; ++i) {
+    mystl::array<T, N> b = a;
+    b[i] = high;
+    expect_same_order(a, b);
+    b[i] = low;
+    expect_same_order(a, b);
+  }
+}
+}  // namespace
+
+TEST(ArrayTest, ArithmeticFastPaths) {
+  // 1. fill：长度不是向量宽度的整数倍
+  mystl::array<char, 37> c;
+  c.fill('x');
+  EXPECT_EQ(std::count(c.begin(), c.end(), 'x'), 37);
+  mystl::array<std::int16_t, 37> s;
+  s.fill(-7);
+  EXPECT_EQ(std::count(s.begin(), s.end(), -7), 37);
+  mystl::array<double, 13> d;
+  d.fill(2.5);
+  EXPECT_EQ(std::count(d.begin(), d.end(), 2.5), 13);
+
+  // 2. swap：长度不是向量宽度的整数倍
+  mystl::array<int, 301> x, y;
+  std::iota(x.begin(), x.end(), 0);
+  std::iota(y.begin(), y.end(), 1000);
+  x.swap(y);
+  EXPECT_EQ(x[0], 1000);
+  EXPECT_EQ(x[300], 1300);
+  EXPECT_EQ(y[300], 300);
+
+  // 3. 比较：每个位置上出现差异都与标准算法一致
+  check_every_position<unsigned char, 70>(1, 200);
+  check_every_position<signed char, 70>(-100, 5);
+  check_every_position<std::uint32_t, 21>(0x01000002u, 0x00FF0003u);
+  check_every_position<int, 21>(-5, 3);
+  check_every_position<std::int64_t, 9>(-1, 1);
+  check_every_position<double, 9>(0.5, 1.5);
+}
+
+TEST(ArrayTest, FloatingPointEquality) {
+  mystl::array<float, 11> a;
+  a.fill(1.0f);
+  mystl::array<float, 11> b = a;
+  EXPECT_TRUE(a == b);
+
+  // +0 和 -0 相等
+  a[9] = 0.0f;
+  b[9] = -0.0f;
+  EXPECT_TRUE(a == b);
+
+  // NaN 不等于任何值，包括它自己
+  a[2] = NAN;
+  EXPECT_FALSE(a == a);
+  EXPECT_TRUE(a != a);
+
+  mystl::array<double, 5> d = {1, 2, 3, 4, NAN};
+  EXPECT_FALSE(d == d);
+  mystl::array<double, 5> e = {1, 2, 3, 4, 5};
+  mystl::array<double, 5> f = {1, 2, 3, 4, 5};
+  EXPECT_TRUE(e == f);
+}
+
+// --- 编译期计算 ---
+
+namespace {
+constexpr std::uint32_t mix32(std::uint32_t x) {
+  x ^= x >> 16;
+  x *= 0x7feb352dU;
+  x ^= x >> 15;
+  x *= 0x846ca68bU;
+  x ^= x >> 16;
+  return x;
+}
+
+constexpr std::uint32_t crc32_entry(std::uint32_t i) {
+  for (int k = 0; k < 8; ++k) {
+    i = (i & 1) ? (i >> 1) ^ 0xEDB88320u : i >> 1;
+  }
+  return i;
+}
+
+constexpr auto kCrcTable =
+    mystl::transform(mystl::iota<std::uint32_t, 256>(0), crc32_entry);
+
+constexpr std::uint32_t crc32(const char* s, std::size_t n) {
+  std::uint32_t crc = 0xFFFFFFFFu;
+  for (std::size_t i = 0; i < n; ++i) {
+    crc = kCrcTable[(crc ^ std::uint8_t(s[i])) & 0xFF] ^ (crc >> 8);
+  }
+  return ~crc;
+}
+
+// base64 解码表：非法字符映射为 -1
+constexpr auto kBase64Decode = mystl::transform(
+    mystl::iota<int, 256>(0), [](int c) {
+      constexpr char kAlphabet[] =
+          "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+      for (int i = 0; i < 64; ++i) {
+        if (kAlphabet[i] == c) {
+          return i;
+        }
+      }
+      return -1;
+    });
+
+// 64K 项的表完全在编译期生成，static_assert 保证没有任何运行时初始化
+constexpr auto kHashTable =
+    mystl::transform(mystl::iota<std::uint32_t, 65536>(0), mix32);
+
+// 编译期排序（堆排序）；GCC 默认的常量求值步数上限不足以排序 64K 项
+constexpr auto kSortedHashes = [] {
+  auto t = mystl::transform(mystl::iota<std::uint32_t, 4096>(0), mix32);
+  mystl::sort(t);
+  return t;
+}();
+
+template <class T, std::size_t N>
+constexpr bool is_sorted(const mystl::array<T, N>& a) {
+  for (std::size_t i = 1; i < N; ++i) {
+    if (a[i] < a[i - 1]) {
+      return false;
+    }
+  }
+  return true;
+}
+}  // namespace
+
+TEST(ArrayTest, ConstexprModifiersAndComparisons) {
+  constexpr auto filled = [] {
+    mystl::array<int, 4> a{};
+    a.fill(7);
+    return a;
+  }();
+  static_assert(filled[0] == 7 && filled[3] == 7, "constexpr fill failed");
+
+  constexpr auto swapped = [] {
+    mystl::array<int, 3> a = {1, 2, 3};
+    mystl::array<int, 3> b = {4, 5, 6};
+    a.swap(b);
+    std::swap(a, b);
+    a.swap(b);
+    return a;
+  }();
+  static_assert(swapped[0] == 4 && swapped[2] == 6, "constexpr swap failed");
+
+  constexpr mystl::array<int, 3> a1 = {1, 2, 3};
+  constexpr mystl::array<int, 3> a2 = {1, 2, 4};
+  static_assert(a1 == a1 && a1 != a2, "constexpr equality failed");
+  static_assert(a1 < a2 && a2 > a1 && a1 <= a1 && a2 >= a1,
+                "constexpr ordering failed");
+  constexpr mystl::array<double, 2> d = {1.0, 2.0};
+  static_assert(d == d, "constexpr floating-point equality failed");
+
+  constexpr auto sorted = [] {
+    mystl::array<int, 7> a = {5, -1, 9, 3, 3, 0, -7};
+    mystl::sort(a);
+    return a;
+  }();
+  static_assert(sorted == mystl::array<int, 7>{-7, -1, 0, 3, 3, 5, 9},
+                "constexpr sort failed");
+  constexpr auto desc = [] {
+    mystl::array<int, 4> a = mystl::iota<int, 4>(1);
+    mystl::sort(a, [](int x, int y) { return x > y; });
+    return a;
+  }();
+  static_assert(desc == mystl::array<int, 4>{4, 3, 2, 1},
+                "constexpr sort with comparator failed");
+
+  // 运行时走快速路径，结果与编译期一致
+  mystl::array<int, 7> r = {5, -1, 9, 3, 3, 0, -7};
+  mystl::sort(r);
+  EXPECT_TRUE(r == sorted);
+  r.fill(7);
+  EXPECT_EQ(r[6], 7);
+}
+
+TEST(ArrayTest, CompileTimeLookupTables) {
+  static_assert(kCrcTable[1] == 0x77073096u, "crc32 table");
+  static_assert(crc32("123456789", 9) == 0xCBF43926u, "crc32 check value");
+  static_assert(kBase64Decode['A'] == 0 && kBase64Decode['/'] == 63 &&
+                    kBase64Decode['='] == -1,
+                "base64 table");
+
+  static_assert(kHashTable.size() == 65536, "table size");
+  static_assert(kHashTable[0] == mix32(0), "first entry");
+  static_assert(kHashTable[65535] == mix32(65535), "last entry");
+  static_assert(is_sorted(kSortedHashes), "compile-time sort");
+
+  // 运行时排序得到相同的结果
+  auto runtime = mystl::transform(mystl::iota<std::uint32_t, 4096>(0), mix32);
+  mystl::sort(runtime);
+  EXPECT_TRUE(runtime == kSortedHashes);
+  const char digits[] = "123456789";
+  EXPECT_EQ(crc32(digits, 9), 0xCBF43926u);
+}
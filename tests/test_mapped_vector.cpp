@@ -0,0 +1,138 @@
+#include <sys/stat.h>
+#include <cstdint>
+#include <cstdio>
+#include <numeric>  // for std::accumulate
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include "gtest/gtest.h"
+#include "mystl/mapped_vector.h"
+
+// --- 测试 mystl::mapped_vector ---
+
+namespace {
+std::string temp_path(const char* name) {
+  return testing::TempDir() + "mystl_" + name;
+}
+
+std::size_t file_size(const std::string& path) {
+  struct stat st;
+  EXPECT_EQ(::stat(path.c_str(), &st), 0);
+  return std::size_t(st.st_size);
+}
+
+struct Record {
+  std::uint32_t id;
+  float score;
+};
+}  // namespace
+
+TEST(MappedVectorTest, CreateAndReopen) {
+  const std::string path = temp_path("mapped_create.bin");
+  {
+    mystl::mapped_vector<std::uint64_t> v(path, mystl::map_mode::create);
+    EXPECT_TRUE(v.is_open());
+    EXPECT_TRUE(v.empty());
+    // 跨越多次扩容
+    for (std::uint64_t i = 0; i < 10000; ++i) {
+      v.push_back(i * i);
+    }
+    EXPECT_EQ(v.size(), 10000);
+    EXPECT_GE(v.capacity(), 10000);
+    v.sync();
+  }
+  // 关闭后文件长度等于 size()，不包含多余的容量
+  EXPECT_EQ(file_size(path), 10000 * sizeof(std::uint64_t));
+
+  const mystl::mapped_vector<std::uint64_t> v(path, mystl::map_mode::read_only);
+  ASSERT_EQ(v.size(), 10000);
+  EXPECT_EQ(v.front(), 0);
+  EXPECT_EQ(v.back(), 9999ull * 9999ull);
+  EXPECT_EQ(v[123], 123ull * 123ull);
+  EXPECT_EQ(v.at(500), 500ull * 500ull);
+  EXPECT_THROW(v.at(10000), std::out_of_range);
+  EXPECT_EQ(v.data(), &v[0]);
+  std::remove(path.c_str());
+}
+
+TEST(MappedVectorTest, ReadWriteAppend) {
+  const std::string path = temp_path("mapped_append.bin");
+  {
+    mystl::mapped_vector<Record> v(path, mystl::map_mode::create);
+    v.push_back({1, 0.5f});
+    v.push_back({2, 1.5f});
+  }
+  {
+    // read_write 打开已有文件，在尾部追加并原地修改
+    mystl::mapped_vector<Record> v(path);
+    ASSERT_EQ(v.size(), 2);
+    v.push_back({3, 2.5f});
+    v[0].score = 10.0f;
+    v.flush_async();
+  }
+  const mystl::mapped_vector<Record> v(path, mystl::map_mode::read_only);
+  ASSERT_EQ(v.size(), 3);
+  EXPECT_EQ(v[0].score, 10.0f);
+  EXPECT_EQ(v.back().id, 3);
+  std::remove(path.c_str());
+}
+
+TEST(MappedVectorTest, ResizeAndShrink) {
+  const std::string path = temp_path("mapped_resize.bin");
+  mystl::mapped_vector<int> v(path, mystl::map_mode::create);
+  v.resize(100);
+  EXPECT_EQ(std::accumulate(v.begin(), v.end(), 0), 0);
+  v.reserve(1000);
+  EXPECT_EQ(v.capacity(), 1000);
+  EXPECT_EQ(file_size(path), 1000 * sizeof(int));
+  v.shrink_to_fit();
+  EXPECT_EQ(v.capacity(), 100);
+  EXPECT_EQ(file_size(path), 100 * sizeof(int));
+  v.pop_back();
+  EXPECT_EQ(v.size(), 99);
+  v.clear();
+  EXPECT_TRUE(v.empty());
+  v.close();
+  EXPECT_FALSE(v.is_open());
+  EXPECT_EQ(file_size(path), 0);
+  std::remove(path.c_str());
+}
+
+TEST(MappedVectorTest, ReadOnlyAndErrors) {
+  const std::string path = temp_path("mapped_ro.bin");
+  {
+    mystl::mapped_vector<int> v(path, mystl::map_mode::create);
+    v.push_back(42);
+  }
+  mystl::mapped_vector<int> v(path, mystl::map_mode::read_only);
+  EXPECT_THROW(v.push_back(1), std::logic_error);
+  EXPECT_THROW(v.resize(10), std::logic_error);
+  // 映射不可写：非 const 访问函数会返回可写引用，直接拒绝
+  EXPECT_THROW(v[0] = 1, std::logic_error);
+  EXPECT_THROW(v.at(0), std::logic_error);
+  EXPECT_THROW(v.front(), std::logic_error);
+  EXPECT_THROW(v.back(), std::logic_error);
+  EXPECT_THROW(v.data(), std::logic_error);
+  EXPECT_THROW(v.begin(), std::logic_error);
+  EXPECT_THROW(v.end(), std::logic_error);
+  EXPECT_THROW(v.rbegin(), std::logic_error);
+  const auto& cv = v;
+  EXPECT_EQ(cv[0], 42);
+  EXPECT_EQ(*cv.begin(), 42);
+  EXPECT_EQ(cv.data(), &cv.front());
+
+  // 文件长度不是 sizeof(T) 的整数倍
+  EXPECT_THROW((mystl::mapped_vector<std::uint64_t>(
+                   path, mystl::map_mode::read_only)),
+               std::runtime_error);
+  // 文件不存在
+  EXPECT_THROW((mystl::mapped_vector<int>(temp_path("mapped_missing.bin"),
+                                          mystl::map_mode::read_only)),
+               std::system_error);
+
+  // 移动后源对象不再持有文件
+  const mystl::mapped_vector<int> moved(mystl::move(v));
+  EXPECT_FALSE(v.is_open());
+  EXPECT_EQ(moved[0], 42);
+  std::remove(path.c_str());
+}
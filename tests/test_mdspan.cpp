@@ -0,0 +1,125 @@
+#include <cstddef>
+#include <stdexcept>
+#include "gtest/gtest.h"
+#include "mystl/mdspan.h"
+
+// --- 测试 mystl::mdspan / mystl::mdarray ---
+
+using E34 = mystl::extents<3, 4>;
+
+TEST(MdspanTest, Extents) {
+  using E = mystl::extents<2, 3, 4>;
+  static_assert(E::rank() == 3, "rank");
+  static_assert(E::extent(0) == 2 && E::extent(2) == 4, "extent");
+  static_assert(E::size() == 24, "size");
+  EXPECT_EQ(mystl::extents<7>::size(), 7);
+}
+
+TEST(MdspanTest, LayoutRightAndLeft) {
+  using R = mystl::layout_right::mapping<mystl::extents<2, 3, 4>>;
+  static_assert(R::stride(0) == 12 && R::stride(1) == 4 && R::stride(2) == 1,
+                "layout_right strides");
+  static_assert(R()(1, 2, 3) == 23, "layout_right offset");
+  static_assert(R::required_span_size() == 24, "layout_right span size");
+
+  using L = mystl::layout_left::mapping<mystl::extents<2, 3, 4>>;
+  static_assert(L::stride(0) == 1 && L::stride(1) == 2 && L::stride(2) == 6,
+                "layout_left strides");
+  static_assert(L()(1, 2, 3) == 1 + 4 + 18, "layout_left offset");
+
+  // 每个下标都映射到不同的位置，且正好覆盖 [0, size)
+  bool seen[24] = {};
+  for (int i = 0; i < 2; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      for (int k = 0; k < 4; ++k) {
+        std::size_t off = L()(i, j, k);
+        ASSERT_LT(off, 24);
+        EXPECT_FALSE(seen[off]);
+        seen[off] = true;
+      }
+    }
+  }
+}
+
+TEST(MdspanTest, LayoutStrideAndTiled) {
+  // 在 6x8 的行主序矩阵中，隔行隔列取出 3x4 的子矩阵
+  using S = mystl::layout_stride<16, 2>::mapping<E34>;
+  static_assert(S()(2, 3) == 38, "layout_stride offset");
+  static_assert(S::required_span_size() == 39, "layout_stride span size");
+
+  // 10x10 的矩阵按 4x4 分块，需要 3x3 个块
+  using T = mystl::layout_tiled<4, 4>::mapping<mystl::extents<10, 10>>;
+  static_assert(T::required_span_size() == 9 * 16, "tiled span size");
+  static_assert(T()(0, 0) == 0 && T()(0, 3) == 3 && T()(1, 0) == 4,
+                "offsets inside the first tile");
+  static_assert(T()(0, 4) == 16, "second tile of the first tile row");
+  static_assert(T()(4, 0) == 3 * 16, "first tile of the second tile row");
+  static_assert(T()(9, 9) == 8 * 16 + 1 * 4 + 1, "last element");
+
+  bool seen[9 * 16] = {};
+  for (int i = 0; i < 10; ++i) {
+    for (int j = 0; j < 10; ++j) {
+      std::size_t off = T()(i, j);
+      ASSERT_LT(off, 9 * 16);
+      EXPECT_FALSE(seen[off]);
+      seen[off] = true;
+    }
+  }
+}
+
+TEST(MdspanTest, MdarrayAccess) {
+  mystl::mdarray<int, E34> a{};
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      a(i, j) = i * 10 + j;
+    }
+  }
+  EXPECT_EQ(a(2, 3), 23);
+  EXPECT_EQ(a.data()[4], 10);  // 行主序
+  EXPECT_EQ(a.at(1, 2), 12);
+  EXPECT_THROW(a.at(3, 0), std::out_of_range);
+  EXPECT_THROW(a.at(0, 4), std::out_of_range);
+
+  mystl::mdarray<int, E34, mystl::layout_left> b{};
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      b(i, j) = a(i, j);
+    }
+  }
+  EXPECT_EQ(b.data()[1], 10);  // 列主序
+  EXPECT_EQ(b(2, 3), 23);
+
+  mystl::mdarray<int, E34, mystl::layout_tiled<2, 2>> t{};
+  static_assert(sizeof(t) == 4 * 4 * sizeof(int), "padded to whole tiles");
+  t.fill(-1);
+  t(2, 3) = 7;
+  EXPECT_EQ(t(2, 3), 7);
+  EXPECT_EQ(t.view()(2, 3), 7);
+
+  // 编译期构造
+  constexpr auto c = [] {
+    mystl::mdarray<int, mystl::extents<2, 2>> m{};
+    m(1, 0) = 5;
+    return m;
+  }();
+  static_assert(c(1, 0) == 5 && c.data()[2] == 5, "constexpr mdarray");
+}
+
+TEST(MdspanTest, ViewOverVector) {
+  mystl::vector<double> v(12, 0.0);
+  mystl::mdspan<double, E34> m(v);
+  m(1, 1) = 3.5;
+  EXPECT_EQ(v[5], 3.5);
+
+  mystl::mdspan<double, E34, mystl::layout_left> col(v);
+  EXPECT_EQ(col(2, 1), 3.5);
+
+  const mystl::vector<double>& cv = v;
+  mystl::mdspan<const double, E34> cm(cv);
+  EXPECT_EQ(cm(1, 1), 3.5);
+  mystl::mdspan<const double, E34> converted = m;
+  EXPECT_EQ(converted.data(), v.data());
+
+  mystl::vector<double> small(11);
+  EXPECT_THROW((mystl::mdspan<double, E34>(small)), std::length_error);
+}
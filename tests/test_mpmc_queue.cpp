@@ -0,0 +1,244 @@
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include "gtest/gtest.h"
+#include "mystl/mpmc_queue.h"
+#include "utils/test_types.h"
+
+using mystl::test::Perfect;
+
+// --- 测试 mystl::mpmc_queue ---
+
+TEST(MpmcQueueTest, CapacityRoundsUpToPowerOfTwo) {
+  EXPECT_EQ(mystl::mpmc_queue<int>(0).capacity(), 2);
+  EXPECT_EQ(mystl::mpmc_queue<int>(2).capacity(), 2);
+  EXPECT_EQ(mystl::mpmc_queue<int>(5).capacity(), 8);
+  EXPECT_EQ(mystl::mpmc_queue<int>(1024).capacity(), 1024);
+}
+
+TEST(MpmcQueueTest, SingleThread) {
+  mystl::mpmc_queue<std::string> q(4);
+  std::string s;
+  EXPECT_FALSE(q.try_pop(s));
+  EXPECT_TRUE(q.try_push("a"));
+  EXPECT_TRUE(q.try_emplace(2, 'b'));
+  EXPECT_TRUE(q.try_push(std::string("c")));
+  EXPECT_TRUE(q.try_push("d"));
+  std::string e = "e";
+  EXPECT_FALSE(q.try_push(std::move(e)));  // 满，不会移走 e
+  EXPECT_EQ(e, "e");
+  EXPECT_EQ(q.size_approx(), 4);
+
+  // 多轮回绕，槽位序号每轮增加 capacity
+  for (int round = 0; round < 10; ++round) {
+    EXPECT_TRUE(q.try_pop(s));
+    EXPECT_TRUE(q.try_push(std::to_string(round)));
+  }
+  const char* expect[4] = {"6", "7", "8", "9"};
+  for (const char* x : expect) {
+    EXPECT_EQ(q.pop(), x);
+  }
+  EXPECT_TRUE(q.empty_approx());
+}
+
+TEST(MpmcQueueTest, DestroysRemainingElements) {
+  Perfect::counter.reset();
+  {
+    mystl::mpmc_queue<Perfect> q(8);
+    for (int i = 0; i < 5; ++i) {
+      q.try_emplace(i);
+    }
+    Perfect out;
+    EXPECT_TRUE(q.try_pop(out));
+    EXPECT_EQ(out.value(), 0);
+  }
+  // 出队的 1 个、队列中剩下的 4 个和 out
+  EXPECT_EQ(Perfect::counter.value_constructor, 5);
+  EXPECT_EQ(Perfect::counter.deconstructor, 6);
+}
+
+TEST(MpmcQueueTest, ManyProducersManyConsumers) {
+  constexpr int kProducers = 4;
+  constexpr int kConsumers = 4;
+  constexpr std::uint64_t kPerProducer = 50000;
+  mystl::mpmc_queue<std::uint64_t> q(64);
+
+  std::vector<std::thread> threads;
+  for (int p = 0; p < kProducers; ++p) {
+    threads.emplace_back([&, p] {
+      for (std::uint64_t i = 0; i < kPerProducer; ++i) {
+        // 高位是生产者编号，低位是序号
+        const std::uint64_t v = (std::uint64_t(p) << 32) | i;
+        while (!q.try_push(v)) {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+
+  std::atomic<std::uint64_t> total{0};
+  std::atomic<bool> ordered{true};
+  for (int c = 0; c < kConsumers; ++c) {
+    threads.emplace_back([&] {
+      // 每个消费者看到的同一生产者的元素必须保持先后顺序
+      std::int64_t last[kProducers] = {-1, -1, -1, -1};
+      std::uint64_t v;
+      while (total.load() < kProducers * kPerProducer) {
+        if (!q.try_pop(v)) {
+          std::this_thread::yield();
+          continue;
+        }
+        const int p = int(v >> 32);
+        const std::int64_t i = std::int64_t(v & 0xffffffffu);
+        if (i <= last[p]) {
+          ordered = false;
+        }
+        last[p] = i;
+        total.fetch_add(1);
+      }
+    });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+  EXPECT_EQ(total.load(), kProducers * kPerProducer);
+  EXPECT_TRUE(ordered.load());
+  EXPECT_TRUE(q.empty_approx());
+}
+
+TEST(MpmcQueueTest, BlockingPushAndPop) {
+  constexpr int kCount = 20000;
+  mystl::mpmc_queue<int> q(2);  // 很小的容量，让两端都经常阻塞
+
+  std::thread consumer([&] {
+    long long sum = 0;
+    for (int i = 0; i < 2 * kCount; ++i) {
+      sum += q.pop();
+    }
+    EXPECT_EQ(sum, 2LL * kCount * (kCount - 1) / 2);
+  });
+  std::vector<std::thread> producers;
+  for (int p = 0; p < 2; ++p) {
+    producers.emplace_back([&] {
+      for (int i = 0; i < kCount; ++i) {
+        q.push(i);
+      }
+    });
+  }
+  for (auto& t : producers) {
+    t.join();
+  }
+  consumer.join();
+  EXPECT_TRUE(q.empty_approx());
+}
+
+namespace {
+// 构造参数为负数时抛出；移动赋值在 fail_assign 为 true 时抛出
+struct Fragile {
+  static inline bool fail_assign = false;
+  static inline std::atomic<int> live{0};
+  int value = 0;
+
+  Fragile() { ++live; }
+  explicit Fragile(int v) : value(v) {
+    if (v < 0) {
+      throw std::runtime_error("negative");
+    }
+    ++live;
+  }
+  Fragile(const Fragile& other) : value(other.value) { ++live; }
+  Fragile& operator=(Fragile&& other) {
+    if (fail_assign) {
+      throw std::runtime_error("assign");
+    }
+    value = other.value;
+    return *this;
+  }
+  ~Fragile() { --live; }
+};
+}  // namespace
+
+TEST(MpmcQueueTest, ThrowingConstructionLeavesQueueUsable) {
+  {
+    mystl::mpmc_queue<Fragile> q(4);
+    EXPECT_TRUE(q.try_emplace(1));
+    EXPECT_THROW(q.try_emplace(-1), std::runtime_error);
+    EXPECT_TRUE(q.try_emplace(2));
+
+    // 抛出异常的位置被跳过，后面的元素照常取出
+    Fragile out;
+    EXPECT_TRUE(q.try_pop(out));
+    EXPECT_EQ(out.value, 1);
+    EXPECT_TRUE(q.try_pop(out));
+    EXPECT_EQ(out.value, 2);
+    EXPECT_FALSE(q.try_pop(out));
+
+    // 空洞占用的槽位已经交还，整个容量都可以再次使用
+    for (int round = 0; round < 3; ++round) {
+      for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(q.try_emplace(i));
+      }
+      EXPECT_FALSE(q.try_emplace(9));
+      for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(q.try_pop(out));
+        EXPECT_EQ(out.value, i);
+      }
+    }
+
+    // 队列析构时不会销毁空洞里不存在的对象
+    EXPECT_TRUE(q.try_emplace(3));
+    EXPECT_THROW(q.try_emplace(-1), std::runtime_error);
+  }
+  EXPECT_EQ(Fragile::live, 0);
+
+  // 睡在 pop 上的消费者不会被空洞卡住
+  mystl::mpmc_queue<Fragile> q(2);
+  std::thread consumer([&] {
+    Fragile out;
+    q.pop(out);
+    EXPECT_EQ(out.value, 7);
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  EXPECT_THROW(q.try_emplace(-1), std::runtime_error);
+  EXPECT_TRUE(q.try_emplace(7));
+  consumer.join();
+}
+
+TEST(MpmcQueueTest, ThrowingPopReleasesSlot) {
+  {
+    mystl::mpmc_queue<Fragile> q(2);
+    EXPECT_TRUE(q.try_emplace(1));
+    EXPECT_TRUE(q.try_emplace(2));
+    Fragile out;
+    Fragile::fail_assign = true;
+    EXPECT_THROW(q.try_pop(out), std::runtime_error);
+    Fragile::fail_assign = false;
+
+    // 元素 1 被丢弃，槽位交还给生产者
+    EXPECT_TRUE(q.try_emplace(3));
+    EXPECT_TRUE(q.try_pop(out));
+    EXPECT_EQ(out.value, 2);
+    EXPECT_TRUE(q.try_pop(out));
+    EXPECT_EQ(out.value, 3);
+    EXPECT_FALSE(q.try_pop(out));
+  }
+  EXPECT_EQ(Fragile::live, 0);
+}
+
+TEST(MpmcQueueTest, PopWakesUpAfterLatePush) {
+  mystl::mpmc_queue<int> q(4);
+  std::atomic<bool> got{false};
+  std::thread consumer([&] {
+    EXPECT_EQ(q.pop(), 42);
+    got = true;
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  EXPECT_FALSE(got.load());
+  q.push(42);
+  consumer.join();
+  EXPECT_TRUE(got.load());
+}
@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+#include "mystl/packed_tuple.h"
+#include "utils/test_types.h"
+
+using namespace mystl::test;
+
+namespace {
+struct Empty {};
+}  // namespace
+
+TEST(PackedTupleTest, Layout) {
+  using Record = mystl::packed_tuple<char, double, char, int>;
+  static_assert(sizeof(mystl::tuple<char, double, char, int>) == 24);
+  static_assert(sizeof(Record) == 16);
+  // 存储顺序: double, int, char, char
+  static_assert(Record::storage_index(0) == 2);
+  static_assert(Record::storage_index(1) == 0);
+  static_assert(Record::storage_index(2) == 3);
+  static_assert(Record::storage_index(3) == 1);
+
+  static_assert(sizeof(mystl::packed_tuple<std::uint8_t, std::uint64_t,
+                                           std::uint16_t, std::uint32_t>) ==
+                16);
+  static_assert(sizeof(mystl::packed_tuple<char, Empty, std::int64_t>) == 16);
+  static_assert(sizeof(mystl::packed_tuple<double>) == sizeof(double));
+  static_assert(std::is_same<std::tuple_element_t<1, Record>, double>::value);
+  static_assert(std::tuple_size<Record>::value == 4);
+  static_assert(std::is_trivially_copyable<Record>::value);
+}
+
+TEST(PackedTupleTest, GetInDeclarationOrder) {
+  mystl::packed_tuple<char, double, char, int> r('a', 2.5, 'b', 42);
+  EXPECT_EQ(mystl::get<0>(r), 'a');
+  EXPECT_DOUBLE_EQ(mystl::get<1>(r), 2.5);
+  EXPECT_EQ(mystl::get<2>(r), 'b');
+  EXPECT_EQ(mystl::get<3>(r), 42);
+
+  mystl::get<3>(r) = 7;
+  mystl::get<0>(r) = 'z';
+  EXPECT_EQ(mystl::get<3>(r), 7);
+  EXPECT_EQ(mystl::get<0>(r), 'z');
+  EXPECT_EQ(mystl::get<2>(r), 'b');
+
+  const auto& cr = r;
+  EXPECT_DOUBLE_EQ(mystl::get<1>(cr), 2.5);
+
+  auto [c0, d, c1, i] = r;
+  EXPECT_EQ(c0, 'z');
+  EXPECT_DOUBLE_EQ(d, 2.5);
+  EXPECT_EQ(c1, 'b');
+  EXPECT_EQ(i, 7);
+
+  mystl::packed_tuple<char, double, char, int> def;
+  EXPECT_EQ(mystl::get<3>(def), 0);
+  EXPECT_DOUBLE_EQ(mystl::get<1>(def), 0.0);
+}
+
+TEST(PackedTupleTest, ConstructionForwardsOnce) {
+  Perfect::counter.reset();
+  {
+    Perfect p(1);
+    mystl::packed_tuple<char, Perfect, std::string> t('x', mystl::move(p),
+                                                      "hello");
+    EXPECT_EQ(Perfect::counter.move_constructor, 1);
+    EXPECT_EQ(Perfect::counter.copy_constructor, 0);
+    EXPECT_EQ(mystl::get<1>(t).value(), 1);
+    EXPECT_EQ(mystl::get<2>(t), "hello");
+
+    Perfect q(2);
+    mystl::packed_tuple<char, Perfect, std::string> u('y', q, "world");
+    EXPECT_EQ(Perfect::counter.copy_constructor, 1);
+
+    Perfect moved = mystl::get<1>(mystl::move(u));
+    EXPECT_EQ(moved.value(), 2);
+    EXPECT_EQ(Perfect::counter.move_constructor, 2);
+  }
+  const auto& c = Perfect::counter;
+  EXPECT_EQ(c.value_constructor + c.move_constructor + c.copy_constructor,
+            c.deconstructor);
+
+  mystl::packed_tuple<MoveOnly, char> m(MoveOnly(5), 'c');
+  auto m2 = mystl::move(m);
+  EXPECT_EQ(mystl::get<0>(m2).value(), 5);
+}
+
+TEST(PackedTupleTest, CompareAndSwap) {
+  using Record = mystl::packed_tuple<char, double, int>;
+  std::vector<Record> v = {Record('b', 1.0, 3), Record('a', 2.0, 1),
+                           Record('a', 1.0, 2), Record('a', 1.0, 1)};
+  std::sort(v.begin(), v.end());
+  // 按声明顺序比较：先 char，再 double，最后 int
+  EXPECT_EQ(v[0], Record('a', 1.0, 1));
+  EXPECT_EQ(v[1], Record('a', 1.0, 2));
+  EXPECT_EQ(v[2], Record('a', 2.0, 1));
+  EXPECT_EQ(v[3], Record('b', 1.0, 3));
+  EXPECT_TRUE(v[0] < v[1]);
+  EXPECT_TRUE(v[3] > v[2]);
+  EXPECT_TRUE(v[0] <= v[0]);
+  EXPECT_TRUE(v[0] != v[1]);
+
+  auto a = mystl::make_packed_tuple(std::string("x"), 1);
+  auto b = mystl::make_packed_tuple(std::string("y"), 2);
+  swap(a, b);
+  EXPECT_EQ(mystl::get<0>(a), "y");
+  EXPECT_EQ(mystl::get<1>(b), 1);
+}
+
+TEST(PackedTupleTest, CompareMatchesTuple) {
+  // 标量走不分支的路径：NaN 视为等价，继续比较后面的元素，和 tuple 一致
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  using Scalars = mystl::packed_tuple<char, double, int>;
+  EXPECT_TRUE(Scalars('a', nan, 1) < Scalars('a', nan, 2));
+  EXPECT_FALSE(Scalars('a', nan, 2) < Scalars('a', nan, 1));
+  EXPECT_FALSE(Scalars('a', nan, 1) == Scalars('a', nan, 1));
+  EXPECT_EQ(Scalars('a', nan, 1) < Scalars('a', nan, 2),
+            mystl::make_tuple('a', nan, 1) < mystl::make_tuple('a', nan, 2));
+
+  // 非标量：按声明顺序逐个比较，而不是按存储顺序（double 存在 string 之后）
+  using Mixed = mystl::packed_tuple<std::string, char, double>;
+  EXPECT_TRUE(Mixed("a", 'z', 9.0) < Mixed("b", 'a', 0.0));
+  EXPECT_TRUE(Mixed("a", 'a', 9.0) < Mixed("a", 'b', 0.0));
+  EXPECT_FALSE(Mixed("a", 'a', 1.0) < Mixed("a", 'a', 1.0));
+  EXPECT_TRUE(Mixed("a", 'a', 1.0) == Mixed("a", 'a', 1.0));
+  EXPECT_TRUE(Mixed("a", 'a', 1.0) != Mixed("a", 'a', 2.0));
+
+  EXPECT_TRUE(mystl::packed_tuple<>() == mystl::packed_tuple<>());
+  EXPECT_FALSE(mystl::packed_tuple<>() < mystl::packed_tuple<>());
+}
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include <algorithm>
+#include <cstring>
 #include <string>
 #include <vector>
 #include "mystl/utility.h"
@@ -514,4 +515,87 @@ TEST(PairTest, MakePairAndCompare) {
   std::vector<mystl::pair<int, std::string>> v1 = {
       {1, "foo"}, {2, "bar"}, {2, "baz"}};
   EXPECT_EQ(v, v1);
-}
\ No newline at end of file
+}
+
+namespace {
+struct EmptyLess {
+  bool operator()(int a, int b) const { return a < b; }
+};
+struct FinalEmpty final {};
+}  // namespace
+
+TEST(PairTest, CompressedPair) {
+  static_assert(sizeof(mystl::compressed_pair<int*, EmptyLess>) ==
+                sizeof(int*));
+  static_assert(sizeof(mystl::compressed_pair<EmptyLess, int*>) ==
+                sizeof(int*));
+  static_assert(std::is_empty<mystl::compressed_pair<EmptyLess, std::less<>>>::value);
+  // 两个相同的空类需要不同的地址，只能占 2 个字节
+  static_assert(sizeof(mystl::compressed_pair<EmptyLess, EmptyLess>) == 2);
+  static_assert(sizeof(mystl::compressed_pair<FinalEmpty, int*>) ==
+                2 * sizeof(int*));
+
+  mystl::compressed_pair<int, EmptyLess> p;
+  EXPECT_EQ(p.first(), 0);
+  EXPECT_TRUE(p.second()(1, 2));
+
+  mystl::compressed_pair<std::string, EmptyLess> q("hello", EmptyLess{});
+  mystl::compressed_pair<std::string, EmptyLess> r("world", EmptyLess{});
+  q.swap(r);
+  EXPECT_EQ(q.first(), "world");
+  EXPECT_EQ(r.first(), "hello");
+
+  auto moved = mystl::move(q);
+  EXPECT_EQ(moved.first(), "world");
+  const auto& cref = moved;
+  EXPECT_FALSE(cref.second()(2, 1));
+
+  mystl::compressed_pair<MoveOnly, EmptyLess> m(MoveOnly(7), EmptyLess{});
+  auto m2 = mystl::move(m);
+  EXPECT_EQ(m2.first().value(), 7);
+
+  // 嵌套的空 compressed_pair 按普通成员存储，外层的基类不会有歧义
+  mystl::compressed_pair<EmptyLess,
+                         mystl::compressed_pair<EmptyLess, EmptyLess>>
+      nested;
+  EXPECT_TRUE(nested.first()(1, 2));
+  EXPECT_TRUE(nested.second().first()(1, 2));
+  EXPECT_FALSE(nested.second().second()(2, 1));
+}
+
+// 成员可平凡拷贝时 pair 也可平凡拷贝；引用成员的赋值作用在被引用的对象上
+TEST(PairTest, TriviallyCopyable) {
+  static_assert(std::is_trivially_copyable<mystl::pair<int, int>>::value);
+  static_assert(
+      std::is_trivially_copy_assignable<mystl::pair<int, double>>::value);
+  static_assert(
+      std::is_trivially_move_assignable<mystl::pair<int, double>>::value);
+  static_assert(
+      std::is_trivially_copy_constructible<mystl::pair<int, double>>::value);
+  static_assert(
+      !std::is_trivially_copyable<mystl::pair<int, std::string>>::value);
+  static_assert(
+      std::is_nothrow_move_assignable<mystl::pair<int, std::string>>::value);
+
+  // 可赋值性依然跟随成员
+  static_assert(!std::is_copy_assignable<mystl::pair<const int, int>>::value);
+  static_assert(!std::is_copy_assignable<mystl::pair<MoveOnly, int>>::value);
+  static_assert(std::is_move_assignable<mystl::pair<MoveOnly, int>>::value);
+  static_assert(
+      !std::is_copy_assignable<mystl::pair<const int&, int>>::value);
+  static_assert(std::is_copy_assignable<mystl::pair<int&, int&>>::value);
+
+  int a = 1, b = 2, c = 3, d = 4;
+  mystl::pair<int&, int&> lhs(a, b);
+  mystl::pair<int&, int&> rhs(c, d);
+  lhs = rhs;
+  EXPECT_EQ(a, 3);
+  EXPECT_EQ(b, 4);
+  EXPECT_EQ(&lhs.first, &a);
+
+  mystl::pair<int, int> src[3] = {{1, 2}, {3, 4}, {5, 6}};
+  mystl::pair<int, int> dst[3];
+  std::memcpy(dst, src, sizeof(src));
+  EXPECT_EQ(dst[2].first, 5);
+  EXPECT_EQ(dst[2].second, 6);
+}
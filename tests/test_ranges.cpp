@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "mystl/array.h"
+#include "mystl/ranges.h"
+#include "mystl/vector.h"
+#include "utils/test_types.h"
+
+namespace views = mystl::views;
+
+template <class R>
+static std::vector<std::decay_t<decltype(*std::begin(std::declval<R&>()))>>
+collect(R&& r) {
+  std::vector<std::decay_t<decltype(*std::begin(r))>> out;
+  for (auto&& x : r) {
+    out.push_back(x);
+  }
+  return out;
+}
+
+TEST(RangesTest, TransformAndFilter) {
+  mystl::vector<int> v = {1, 2, 3, 4, 5, 6};
+  auto squares = v | views::transform([](int x) { return x * x; });
+  EXPECT_EQ(collect(squares), (std::vector<int>{1, 4, 9, 16, 25, 36}));
+  EXPECT_EQ(squares.size(), 6u);
+  EXPECT_EQ(squares.begin()[2], 9);
+  EXPECT_EQ(squares.end() - squares.begin(), 6);
+
+  auto evens = v | views::filter([](int x) { return x % 2 == 0; });
+  EXPECT_EQ(collect(evens), (std::vector<int>{2, 4, 6}));
+
+  // filter 保留对原元素的引用，可以写回
+  for (int& x : evens) {
+    x = -x;
+  }
+  EXPECT_EQ(v[1], -2);
+  EXPECT_EQ(v[0], 1);
+
+  auto it = evens.end();
+  --it;
+  EXPECT_EQ(*it, -6);
+}
+
+TEST(RangesTest, TakeDrop) {
+  mystl::array<int, 5> a = {10, 20, 30, 40, 50};
+  EXPECT_EQ(collect(a | views::take(2)), (std::vector<int>{10, 20}));
+  EXPECT_EQ(collect(a | views::take(9)).size(), 5u);
+  EXPECT_EQ((a | views::take(3)).size(), 3u);
+  EXPECT_TRUE(collect(a | views::take(0)).empty());
+  EXPECT_EQ(collect(a | views::drop(3)), (std::vector<int>{40, 50}));
+  EXPECT_TRUE(collect(a | views::drop(7)).empty());
+  EXPECT_EQ((a | views::drop(7)).size(), 0u);
+
+  // 随机访问且有大小时 take 直接返回底层迭代器
+  static_assert(std::is_same<decltype((a | views::take(2)).begin()),
+                             mystl::array<int, 5>::iterator>::value);
+
+  // 不可随机访问的底层（filter 之后）用计数截断
+  auto odd_tens = a | views::filter([](int x) { return x / 10 % 2 == 1; }) |
+                  views::take(2);
+  EXPECT_EQ(collect(odd_tens), (std::vector<int>{10, 30}));
+  auto few = a | views::filter([](int x) { return x > 35; }) | views::take(5);
+  EXPECT_EQ(collect(few), (std::vector<int>{40, 50}));
+  auto skipped = a | views::filter([](int x) { return x != 20; }) |
+                 views::drop(1);
+  EXPECT_EQ(collect(skipped), (std::vector<int>{30, 40, 50}));
+}
+
+TEST(RangesTest, ChunkAndStride) {
+  mystl::vector<int> v = {1, 2, 3, 4, 5, 6, 7};
+  auto chunks = v | views::chunk(3);
+  EXPECT_EQ(chunks.size(), 3u);
+  std::vector<std::vector<int>> got;
+  for (auto c : chunks) {
+    got.push_back(collect(c));
+  }
+  EXPECT_EQ(got, (std::vector<std::vector<int>>{{1, 2, 3}, {4, 5, 6}, {7}}));
+
+  EXPECT_EQ(collect(v | views::stride(3)), (std::vector<int>{1, 4, 7}));
+  EXPECT_EQ((v | views::stride(2)).size(), 4u);
+  EXPECT_EQ(collect(v | views::stride(10)), (std::vector<int>{1}));
+
+  // 块内求和：每块是一个子区间，可以继续套适配器
+  std::vector<int> sums;
+  for (auto c : v | views::chunk(2)) {
+    int s = 0;
+    for (int x : c | views::transform([](int x) { return x * 10; })) {
+      s += x;
+    }
+    sums.push_back(s);
+  }
+  EXPECT_EQ(sums, (std::vector<int>{30, 70, 110, 70}));
+}
+
+TEST(RangesTest, Enumerate) {
+  mystl::vector<std::string> v = {"a", "b", "c"};
+  std::vector<std::size_t> idx;
+  for (auto [i, s] : v | views::enumerate) {
+    idx.push_back(i);
+    s += "!";
+  }
+  EXPECT_EQ(idx, (std::vector<std::size_t>{0, 1, 2}));
+  EXPECT_EQ(v[2], "c!");
+
+  auto r = v | views::drop(1) | views::enumerate;
+  EXPECT_EQ(r.size(), 2u);
+  EXPECT_EQ(mystl::get<0>(*r.begin()), 0u);
+  EXPECT_EQ(mystl::get<1>(*r.begin()), "b!");
+}
+
+TEST(RangesTest, PipelineComposition) {
+  mystl::vector<int> v;
+  for (int i = 0; i < 100; ++i) {
+    v.push_back(i);
+  }
+  auto stage = views::filter([](int x) { return x % 3 == 0; }) |
+               views::transform([](int x) { return x + 1; });
+  auto r = v | stage | views::drop(2) | views::take(4);
+  EXPECT_EQ(collect(r), (std::vector<int>{7, 10, 13, 16}));
+
+  // 同一个组合可以用在不同的容器上
+  mystl::array<int, 4> a = {3, 4, 5, 6};
+  EXPECT_EQ(collect(a | stage), (std::vector<int>{4, 7}));
+}
+
+TEST(RangesTest, LazyAndNoCopies) {
+  // 只有被取到的元素才会调用函数
+  mystl::vector<int> v = {1, 2, 3, 4, 5, 6, 7, 8};
+  int calls = 0;
+  auto r = v | views::transform([&](int x) {
+             ++calls;
+             return x * 2;
+           }) |
+           views::take(3);
+  EXPECT_EQ(calls, 0);
+  EXPECT_EQ(collect(r), (std::vector<int>{2, 4, 6}));
+  EXPECT_EQ(calls, 3);
+
+  // 左值容器按引用保存，整个管道不拷贝元素
+  using mystl::test::Perfect;
+  mystl::vector<Perfect> ps;
+  ps.reserve(4);
+  for (int i = 0; i < 4; ++i) {
+    ps.emplace_back(i);
+  }
+  Perfect::counter.reset();
+  int sum = 0;
+  for (const Perfect& p :
+       ps | views::filter([](const Perfect& p) { return p.value() > 0; }) |
+           views::stride(2) | views::take(5)) {
+    sum += p.value();
+  }
+  EXPECT_EQ(sum, 1 + 3);
+  EXPECT_EQ(Perfect::counter.copy_constructor, 0);
+  EXPECT_EQ(Perfect::counter.move_constructor, 0);
+}
+
+TEST(RangesTest, OwnsRvalueContainers) {
+  auto make = [] {
+    mystl::vector<int> v = {5, 6, 7};
+    return v;
+  };
+  auto r = make() | views::transform([](int x) { return x - 5; });
+  EXPECT_EQ(collect(r), (std::vector<int>{0, 1, 2}));
+  EXPECT_EQ(r.size(), 3u);
+}
@@ -0,0 +1,114 @@
+#include <cstring>
+#include <memory>
+#include <string>
+#include "gtest/gtest.h"
+#include "mystl/ring_buffer.h"
+
+// --- 测试 mystl::ring_buffer ---
+
+TEST(RingBufferTest, PushPopPeek) {
+  mystl::ring_buffer<int, 4> rb;
+  static_assert(rb.capacity() == 4, "capacity");
+  EXPECT_TRUE(rb.empty());
+  EXPECT_EQ(rb.peek(), nullptr);
+  EXPECT_FALSE(rb.pop());
+
+  EXPECT_TRUE(rb.push(1));
+  EXPECT_TRUE(rb.push(2));
+  EXPECT_TRUE(rb.emplace(3));
+  EXPECT_TRUE(rb.push(4));
+  EXPECT_TRUE(rb.full());
+  // reject 模式：满了以后拒绝写入
+  EXPECT_FALSE(rb.push(5));
+  EXPECT_EQ(rb.size(), 4);
+  EXPECT_EQ(*rb.peek(), 1);
+  EXPECT_EQ(rb.back(), 4);
+  EXPECT_EQ(rb[2], 3);
+
+  int x = 0;
+  EXPECT_TRUE(rb.pop(x));
+  EXPECT_EQ(x, 1);
+  EXPECT_TRUE(rb.push(5));  // 回绕到存储的开头
+  EXPECT_EQ(rb.front(), 2);
+  EXPECT_EQ(rb.back(), 5);
+  for (int expect = 2; expect <= 5; ++expect) {
+    EXPECT_TRUE(rb.pop(x));
+    EXPECT_EQ(x, expect);
+  }
+  EXPECT_TRUE(rb.empty());
+
+  rb.push(7);
+  rb.clear();
+  EXPECT_TRUE(rb.empty());
+}
+
+TEST(RingBufferTest, OverwriteOldest) {
+  mystl::ring_buffer<std::string, 4, mystl::ring_mode::overwrite> rb;
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_TRUE(rb.push(std::to_string(i)));
+  }
+  EXPECT_EQ(rb.size(), 4);
+  EXPECT_EQ(rb.front(), "6");
+  EXPECT_EQ(rb.back(), "9");
+
+  // 批量写入超过容量时只保留最后 N 个
+  const std::string src[6] = {"a", "b", "c", "d", "e", "f"};
+  EXPECT_EQ(rb.push_n(src, 6), 4);
+  std::string out[4];
+  EXPECT_EQ(rb.pop_n(out, 10), 4);
+  EXPECT_EQ(out[0], "c");
+  EXPECT_EQ(out[3], "f");
+
+  rb.push("x");
+  rb.push("y");
+  auto w = rb.push_n(3);  // 丢弃 "x"
+  EXPECT_EQ(w.first.size() + w.second.size(), 3);
+  EXPECT_EQ(rb.front(), "y");
+}
+
+TEST(RingBufferTest, BulkSpans) {
+  mystl::ring_buffer<char, 8> rb;
+  // 移动到存储中间，使后面的批量操作回绕
+  EXPECT_EQ(rb.push_n("abcdef", 6), 6);
+  char tmp[8];
+  EXPECT_EQ(rb.pop_n(tmp, 5), 5);
+  EXPECT_EQ(std::memcmp(tmp, "abcde", 5), 0);
+
+  // 剩余空间 7 个，预留 10 个只能得到 7 个，分成两段
+  auto w = rb.push_n(10);
+  EXPECT_EQ(w.first.size(), 2);
+  EXPECT_EQ(w.second.size(), 5);
+  EXPECT_EQ(w.second.data(), &rb[0] - 5);  // 第二段从存储开头开始
+  std::memcpy(w.first.data(), "gh", 2);
+  std::memcpy(w.second.data(), "ijklm", 5);
+  EXPECT_TRUE(rb.full());
+
+  auto p = rb.peek_n(100);
+  EXPECT_EQ(p.first.size(), 3);
+  EXPECT_EQ(p.second.size(), 5);
+  EXPECT_EQ(std::string(p.first.begin(), p.first.end()) +
+                std::string(p.second.begin(), p.second.end()),
+            "fghijklm");
+  EXPECT_EQ(rb.size(), 8);  // peek 不取出
+
+  auto r = rb.pop_n(4);
+  EXPECT_EQ(std::string(r.first.begin(), r.first.end()), "fgh");
+  EXPECT_EQ(std::string(r.second.begin(), r.second.end()), "i");
+  EXPECT_EQ(rb.size(), 4);
+  EXPECT_EQ(rb.front(), 'j');
+
+  // reject 模式下空间不足时只写入一部分
+  EXPECT_EQ(rb.push_n("0123456789", 10), 4);
+  EXPECT_TRUE(rb.full());
+  EXPECT_EQ(rb.push_n(1).first.size(), 0);
+}
+
+TEST(RingBufferTest, MoveOnlyElements) {
+  mystl::ring_buffer<std::unique_ptr<int>, 2> rb;
+  EXPECT_TRUE(rb.push(std::make_unique<int>(1)));
+  EXPECT_TRUE(rb.emplace(new int(2)));
+  std::unique_ptr<int> p;
+  EXPECT_TRUE(rb.pop(p));
+  EXPECT_EQ(*p, 1);
+  EXPECT_EQ(**rb.peek(), 2);
+}
@@ -0,0 +1,275 @@
+#include <cstdint>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "gtest/gtest.h"
+#include "mystl/robin_hood.h"
+#include "utils/test_types.h"
+
+using mystl::test::Perfect;
+
+// --- 测试 mystl::robin_hood_set / robin_hood_map ---
+
+TEST(RobinHoodTest, SetBasicOperations) {
+  mystl::robin_hood_set<int> s;
+  EXPECT_TRUE(s.empty());
+  EXPECT_EQ(s.begin(), s.end());
+  EXPECT_EQ(s.find(1), s.end());
+
+  EXPECT_TRUE(s.insert(1).second);
+  EXPECT_FALSE(s.insert(1).second);
+  EXPECT_TRUE(s.emplace(2).second);
+  s.insert({3, 4, 5});
+  EXPECT_EQ(s.size(), 5);
+  EXPECT_TRUE(s.contains(4));
+  EXPECT_EQ(s.count(6), 0);
+  EXPECT_EQ(*s.find(3), 3);
+
+  EXPECT_EQ(s.erase(4), 1);
+  EXPECT_EQ(s.erase(4), 0);
+  int sum = 0;
+  for (int x : s) {
+    sum += x;
+  }
+  EXPECT_EQ(sum, 1 + 2 + 3 + 5);
+
+  s.clear();
+  EXPECT_TRUE(s.empty());
+  EXPECT_EQ(s.begin(), s.end());
+}
+
+TEST(RobinHoodTest, MapBasicOperations) {
+  mystl::robin_hood_map<std::string, int> m = {{"a", 1}, {"b", 2}};
+  EXPECT_EQ(m.size(), 2);
+  m["c"] = 3;
+  EXPECT_TRUE(m.try_emplace("d", 4).second);
+  EXPECT_FALSE(m.try_emplace("d", 40).second);
+  EXPECT_EQ(m.at("d"), 4);
+  EXPECT_FALSE(m.insert_or_assign("a", 10).second);
+  EXPECT_EQ(m.at("a"), 10);
+  EXPECT_THROW(m.at("z"), std::out_of_range);
+
+  auto it = m.find("b");
+  ASSERT_NE(it, m.end());
+  it->second = 20;
+  EXPECT_EQ(m["b"], 20);
+
+  mystl::robin_hood_map<std::string, int> copy(m);
+  EXPECT_EQ(copy.at("b"), 20);
+  mystl::robin_hood_map<std::string, int> moved(std::move(copy));
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(moved.size(), 4);
+  copy = moved;
+  EXPECT_EQ(copy.at("c"), 3);
+}
+
+TEST(RobinHoodTest, MapIteratorKeyIsReadOnly) {
+  mystl::robin_hood_map<std::string, int> m = {{"a", 1}, {"b", 2}};
+  auto it = m.find("a");
+  // 迭代器只能修改 second，改键不能通过编译
+  static_assert(!std::is_assignable<decltype((it->first)), std::string>::value);
+  static_assert(!std::is_assignable<decltype(((*it).first)), std::string>::value);
+  static_assert(std::is_assignable<decltype((it->second)), int>::value);
+  it->second = 10;
+  for (auto&& [key, value] : m) {
+    static_assert(std::is_same<decltype(key), const std::string&>::value);
+    value += 100;
+  }
+  EXPECT_EQ(m.at("a"), 110);
+  EXPECT_EQ(m.at("b"), 102);
+  const mystl::pair<std::string, int> kv = *m.find("b");
+  EXPECT_EQ(kv.first, "b");
+  EXPECT_EQ(kv.second, 102);
+}
+
+// 与 std 容器对照的随机操作，分别在默认负载因子和 0.95 下运行
+class RobinHoodLoadTest : public ::testing::TestWithParam<float> {};
+
+TEST_P(RobinHoodLoadTest, RandomOperationsMatchStd) {
+  std::mt19937_64 rng(1234);
+  mystl::robin_hood_map<std::uint64_t, std::uint64_t> m;
+  m.max_load_factor(GetParam());
+  std::unordered_map<std::uint64_t, std::uint64_t> ref;
+  for (int step = 0; step < 200000; ++step) {
+    const std::uint64_t key = rng() % 3000;
+    switch (rng() % 4) {
+      case 0:
+      case 1:
+        m[key] = step;
+        ref[key] = step;
+        break;
+      case 2:
+        ASSERT_EQ(m.erase(key), ref.erase(key));
+        break;
+      default: {
+        auto it = m.find(key);
+        auto rit = ref.find(key);
+        ASSERT_EQ(it == m.end(), rit == ref.end());
+        if (rit != ref.end()) {
+          ASSERT_EQ(it->second, rit->second);
+        }
+      }
+    }
+    ASSERT_EQ(m.size(), ref.size());
+    ASSERT_LE(m.load_factor(), m.max_load_factor());
+  }
+  std::size_t visited = 0;
+  for (const auto& kv : m) {
+    ASSERT_EQ(ref.at(kv.first), kv.second);
+    ++visited;
+  }
+  EXPECT_EQ(visited, ref.size());
+}
+
+INSTANTIATE_TEST_SUITE_P(LoadFactors, RobinHoodLoadTest,
+                         ::testing::Values(0.5f, 0.875f, 0.95f));
+
+TEST(RobinHoodTest, MaxLoadFactorIsClampedAndApplied) {
+  mystl::robin_hood_set<int> s;
+  s.max_load_factor(1.5f);
+  EXPECT_FLOAT_EQ(s.max_load_factor(), 0.95f);
+  s.max_load_factor(0.0f);
+  EXPECT_FLOAT_EQ(s.max_load_factor(), 0.2f);
+
+  s.max_load_factor(0.95f);
+  for (int i = 0; i < 972; ++i) {  // 1024 * 0.95 = 972.8
+    s.insert(i);
+  }
+  EXPECT_EQ(s.capacity(), 1024);
+  s.insert(972);
+  EXPECT_EQ(s.capacity(), 2048);
+
+  // 调低负载因子立即扩容
+  s.max_load_factor(0.25f);
+  EXPECT_LE(s.load_factor(), 0.25f);
+  for (int i = 0; i <= 972; ++i) {
+    ASSERT_TRUE(s.contains(i));
+  }
+}
+
+TEST(RobinHoodTest, ReserveAndMemoryUsage) {
+  mystl::robin_hood_map<std::uint32_t, std::uint32_t> m;
+  EXPECT_EQ(m.memory_usage(), 0);
+  m.max_load_factor(0.95f);
+  m.reserve(1000);
+  EXPECT_EQ(m.capacity(), 2048);  // 1024 * 0.95 < 1000
+  const std::size_t cap = m.capacity();
+  for (std::uint32_t i = 0; i < 1000; ++i) {
+    m[i] = i;
+  }
+  EXPECT_EQ(m.capacity(), cap);
+  // 每个槽位一个元素加一个字节的探测距离，外加一个哨兵字节
+  EXPECT_EQ(m.memory_usage(), cap * (sizeof(mystl::pair<std::uint32_t,
+                                                        std::uint32_t>) + 1) +
+                                  1);
+}
+
+// 缩小容量时所有键落到同一个理想位置，探测距离超过一个字节能表示的范围
+struct ShrinkHash {
+  static inline std::vector<std::size_t> values;
+  std::size_t operator()(int x) const noexcept { return values[x]; }
+};
+
+TEST(RobinHoodTest, ShrinkingRehashKeepsLargerCapacityWhenItOverflows) {
+  // 300 个哈希值在 512 个槽位的表里理想位置都是 0，在 2048 个槽位的表里分散到 4 处
+  ShrinkHash::values.clear();
+  for (std::size_t h = 0; ShrinkHash::values.size() < 300; ++h) {
+    if ((mystl::detail::hash_mix(h) & 511) == 0) {
+      ShrinkHash::values.push_back(h);
+    }
+  }
+  mystl::robin_hood_set<int, ShrinkHash> s;
+  s.reserve(1700);
+  ASSERT_EQ(s.capacity(), 2048);
+  for (int i = 0; i < 300; ++i) {
+    s.insert(i);
+  }
+  EXPECT_NO_THROW(s.rehash(0));
+  EXPECT_LT(s.capacity(), 2048);
+  EXPECT_GT(s.capacity(), 512);
+  EXPECT_EQ(s.size(), 300);
+  for (int i = 0; i < 300; ++i) {
+    ASSERT_TRUE(s.contains(i));
+  }
+}
+
+// 哈希值只有 4 种，每条探测链都很长，删除时后移会跨越很多槽位
+struct FewBucketsHash {
+  std::size_t operator()(int x) const noexcept { return std::size_t(x % 4); }
+};
+
+TEST(RobinHoodTest, BackwardShiftWithLongChains) {
+  mystl::robin_hood_set<int, FewBucketsHash> s;
+  std::unordered_set<int> ref;
+  for (int i = 0; i < 200; ++i) {
+    s.insert(i);
+    ref.insert(i);
+  }
+  std::mt19937 rng(5);
+  for (int round = 0; round < 2000; ++round) {
+    const int x = int(rng() % 300);
+    if (rng() % 2) {
+      EXPECT_EQ(s.erase(x), ref.erase(x));
+    } else {
+      EXPECT_EQ(s.insert(x).second, ref.insert(x).second);
+    }
+  }
+  EXPECT_EQ(s.size(), ref.size());
+  for (int x = 0; x < 300; ++x) {
+    ASSERT_EQ(s.contains(x), ref.count(x) == 1) << x;
+  }
+}
+
+TEST(RobinHoodTest, EraseWhileIterating) {
+  mystl::robin_hood_set<int> s;
+  for (int i = 0; i < 1000; ++i) {
+    s.insert(i);
+  }
+  std::size_t erased = 0;
+  for (auto it = s.begin(); it != s.end();) {
+    if (*it % 2 == 0) {
+      it = s.erase(it);
+      ++erased;
+    } else {
+      ++it;
+    }
+  }
+  EXPECT_EQ(erased, 500);
+  EXPECT_EQ(s.size(), 500);
+  for (int x : s) {
+    EXPECT_EQ(x % 2, 1);
+  }
+}
+
+TEST(RobinHoodTest, ElementsAreDestroyedOnce) {
+  Perfect::counter.reset();
+  {
+    mystl::robin_hood_map<int, Perfect> m;
+    for (int i = 0; i < 500; ++i) {
+      m.try_emplace(i, i);
+    }
+    for (int i = 0; i < 500; i += 3) {
+      m.erase(i);
+    }
+    EXPECT_EQ(m.at(1).value(), 1);
+  }
+  const auto& c = Perfect::counter;
+  EXPECT_EQ(c.value_constructor + c.default_constructor + c.move_constructor +
+                c.copy_constructor,
+            c.deconstructor);
+}
+
+TEST(RobinHoodTest, PolicyStorage) {
+  // 空的哈希函数、比较函数和分配器和 max_elements 压缩在一起
+  static_assert(sizeof(mystl::robin_hood_set<int>) ==
+                6 * sizeof(std::size_t));
+  mystl::robin_hood_set<int> s = {1, 2, 3};
+  mystl::robin_hood_set<int> t(s);
+  mystl::robin_hood_set<int> u(std::move(s));
+  t.swap(u);
+  EXPECT_EQ(t.size(), 3u);
+  EXPECT_TRUE(u.contains(2));
+}
@@ -0,0 +1,213 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include "gtest/gtest.h"
+#include "mystl/mapped_vector.h"
+#include "mystl/serialization.h"
+
+// --- 测试 mystl 序列化 ---
+
+namespace {
+template <class T>
+T round_trip(const T& value) {
+  std::stringstream ss;
+  mystl::serialize(ss, value);
+  EXPECT_EQ(ss.str().size(), mystl::serialized_size(value));
+  return mystl::deserialize<T>(ss);
+}
+}  // namespace
+
+TEST(SerializationTest, RawContiguousBlocks) {
+  // 1. vector<int>：头部 + 一整块原始字节
+  mystl::vector<int> v = {1, 2, 3, 4, 5};
+  mystl::vector<int> v2 = round_trip(v);
+  ASSERT_EQ(v2.size(), 5);
+  for (std::size_t i = 0; i < v.size(); ++i) {
+    EXPECT_EQ(v2[i], v[i]);
+  }
+  EXPECT_EQ(mystl::serialized_size(v), 40 + 24);
+
+  // 2. 空 vector
+  EXPECT_TRUE(round_trip(mystl::vector<double>()).empty());
+
+  // 3. array<double, 4>
+  mystl::array<double, 4> a = {0.5, 1.5, 2.5, 3.5};
+  EXPECT_TRUE(round_trip(a) == a);
+}
+
+TEST(SerializationTest, PairAndTuple) {
+  mystl::pair<int, double> p(7, 2.5);
+  mystl::pair<int, double> p2 = round_trip(p);
+  EXPECT_EQ(p2.first, 7);
+  EXPECT_EQ(p2.second, 2.5);
+
+  mystl::tuple<int, char, double> t(1, 'x', 3.25);
+  EXPECT_TRUE(round_trip(t) == t);
+
+  // vector 中的 tuple
+  mystl::vector<mystl::tuple<int, float>> vt(3, mystl::tuple<int, float>(4, 1.5f));
+  mystl::vector<mystl::tuple<int, float>> vt2 = round_trip(vt);
+  ASSERT_EQ(vt2.size(), 3);
+  EXPECT_TRUE(vt2[2] == vt[2]);
+}
+
+TEST(SerializationTest, ElementWiseFallback) {
+  // tuple 中含有 vector，不是 trivially copyable，通过 tuple_size/get<I> 逐元素编码
+  using Record = mystl::tuple<int, mystl::vector<int>>;
+  Record r(42, mystl::vector<int>{7, 8, 9});
+  Record r2 = round_trip(r);
+  EXPECT_EQ(mystl::get<0>(r2), 42);
+  ASSERT_EQ(mystl::get<1>(r2).size(), 3);
+  EXPECT_EQ(mystl::get<1>(r2)[2], 9);
+
+  // 嵌套 vector
+  mystl::vector<mystl::vector<int>> nested(2, mystl::vector<int>{1, 2});
+  mystl::vector<mystl::vector<int>> nested2 = round_trip(nested);
+  ASSERT_EQ(nested2.size(), 2);
+  EXPECT_EQ(nested2[1][1], 2);
+}
+
+TEST(SerializationTest, ZeroCopyViewFromMappedFile) {
+  const std::string path = testing::TempDir() + "mystl_serial_view.bin";
+  mystl::vector<std::uint32_t> v(1000);
+  for (std::size_t i = 0; i < v.size(); ++i) {
+    v[i] = std::uint32_t(i * 3);
+  }
+  mystl::array<float, 3> a = {1.0f, 2.0f, 3.0f};
+  {
+    std::stringstream ss;
+    mystl::serialize(ss, v);
+    mystl::serialize(ss, a);
+    const std::string bytes = ss.str();
+    mystl::mapped_vector<char> file(path, mystl::map_mode::create);
+    for (char c : bytes) {
+      file.push_back(c);
+    }
+  }
+
+  // 视图直接指向 mmap 的页面
+  const mystl::mapped_vector<char> file(path, mystl::map_mode::read_only);
+  std::size_t used = 0;
+  auto view = mystl::deserialize_view<mystl::vector<std::uint32_t>>(
+      file.data(), file.size(), &used);
+  ASSERT_EQ(view.size(), 1000);
+  EXPECT_EQ(view[999], 999u * 3);
+  EXPECT_GE(static_cast<const void*>(view.data()),
+            static_cast<const void*>(file.data()));
+  EXPECT_LT(static_cast<const void*>(view.data()),
+            static_cast<const void*>(file.data() + file.size()));
+
+  auto view2 = mystl::deserialize_view<mystl::array<float, 3>>(
+      file.data() + used, file.size() - used);
+  ASSERT_EQ(view2.size(), 3);
+  EXPECT_EQ(view2[2], 3.0f);
+  std::remove(path.c_str());
+}
+
+TEST(SerializationTest, Errors) {
+  std::stringstream ss;
+  mystl::serialize(ss, mystl::vector<int>{1, 2, 3});
+  const std::string bytes = ss.str();
+
+  // 类型指纹不一致
+  EXPECT_THROW(mystl::deserialize<mystl::vector<float>>(bytes.data(),
+                                                        bytes.size()),
+               mystl::serialization_error);
+  EXPECT_THROW(mystl::deserialize<mystl::vector<unsigned>>(bytes.data(),
+                                                           bytes.size()),
+               mystl::serialization_error);
+  // 数据被截断
+  EXPECT_THROW(mystl::deserialize<mystl::vector<int>>(bytes.data(),
+                                                      bytes.size() - 8),
+               mystl::serialization_error);
+  // 头部损坏
+  std::string broken = bytes;
+  broken[0] = 'X';
+  EXPECT_THROW(mystl::deserialize<mystl::vector<int>>(broken.data(),
+                                                      broken.size()),
+               mystl::serialization_error);
+  // length 与 payload 字节数不符，乘法溢出也不能绕过检查
+  for (std::uint64_t length : {std::uint64_t(5), std::uint64_t(1) << 62}) {
+    broken = bytes;
+    std::memcpy(&broken[offsetof(mystl::serial_header, length)], &length,
+                sizeof(length));
+    EXPECT_THROW(mystl::deserialize<mystl::vector<int>>(broken.data(),
+                                                        broken.size()),
+                 mystl::serialization_error);
+    EXPECT_THROW(mystl::deserialize_view<mystl::vector<int>>(broken.data(),
+                                                             broken.size()),
+                 mystl::serialization_error);
+  }
+  // 元素大小不符
+  broken = bytes;
+  const std::uint32_t elem_size = 8;
+  std::memcpy(&broken[offsetof(mystl::serial_header, elem_size)], &elem_size,
+              sizeof(elem_size));
+  EXPECT_THROW(mystl::deserialize<mystl::vector<int>>(broken.data(),
+                                                      broken.size()),
+               mystl::serialization_error);
+  // 逐元素编码时每个元素至少占 8 字节的长度前缀
+  std::stringstream nested;
+  mystl::serialize(nested, mystl::vector<mystl::vector<int>>(2));
+  broken = nested.str();
+  const std::uint64_t length = std::uint64_t(1) << 62;
+  std::memcpy(&broken[offsetof(mystl::serial_header, length)], &length,
+              sizeof(length));
+  EXPECT_THROW(mystl::deserialize<mystl::vector<mystl::vector<int>>>(
+                   broken.data(), broken.size()),
+               mystl::serialization_error);
+
+  // length 和 bytes 一起被改大：bytes 超过缓冲区剩余长度，不能先按 length 分配
+  broken = bytes;
+  const std::uint64_t huge_length = std::uint64_t(1) << 37;
+  const std::uint64_t huge_bytes = std::uint64_t(1) << 40;
+  std::memcpy(&broken[offsetof(mystl::serial_header, length)], &huge_length,
+              sizeof(huge_length));
+  std::memcpy(&broken[offsetof(mystl::serial_header, bytes)], &huge_bytes,
+              sizeof(huge_bytes));
+  EXPECT_THROW(mystl::deserialize<mystl::vector<int>>(broken.data(),
+                                                      broken.size()),
+               mystl::serialization_error);
+
+  std::size_t used = 0;
+  auto v = mystl::deserialize<mystl::vector<int>>(bytes.data(), bytes.size(),
+                                                  &used);
+  EXPECT_EQ(used, bytes.size());
+  EXPECT_EQ(v[2], 3);
+}
+
+TEST(SerializationTest, CorruptedNestedLength) {
+  using Nested = mystl::vector<mystl::vector<int>>;
+  std::stringstream ss;
+  mystl::serialize(ss, Nested{{1, 2}, {3}});
+  const std::string bytes = ss.str();
+  // payload 紧跟在头部之后，开头是第一个内层 vector 的长度
+  const std::size_t inner = sizeof(mystl::serial_header);
+  std::uint64_t n = 0;
+  std::memcpy(&n, &bytes[inner], sizeof(n));
+  ASSERT_EQ(n, 2);
+
+  for (std::uint64_t length : {std::uint64_t(3), std::uint64_t(1) << 40,
+                               std::uint64_t(1) << 62}) {
+    std::string broken = bytes;
+    std::memcpy(&broken[inner], &length, sizeof(length));
+    EXPECT_THROW(mystl::deserialize<Nested>(broken.data(), broken.size()),
+                 mystl::serialization_error);
+    std::stringstream in(broken);
+    EXPECT_THROW(mystl::deserialize<Nested>(in), mystl::serialization_error);
+  }
+
+  // 逐元素编码的 tuple 里嵌套的 vector 同样受 payload 字节数限制
+  using Row = mystl::pair<int, mystl::vector<double>>;
+  std::stringstream rows;
+  mystl::serialize(rows, mystl::vector<Row>{Row(1, {0.5, 1.5})});
+  std::string broken = rows.str();
+  const std::uint64_t length = std::uint64_t(1) << 40;
+  std::memcpy(&broken[inner + sizeof(int)], &length, sizeof(length));
+  EXPECT_THROW(mystl::deserialize<mystl::vector<Row>>(broken.data(),
+                                                      broken.size()),
+               mystl::serialization_error);
+}
@@ -0,0 +1,217 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <random>
+#include <string>
+#include <utility>
+#include "gtest/gtest.h"
+#include "mystl/array.h"
+#include "mystl/sorting_network.h"
+
+// --- 测试排序网络与小数组上的 sort / nth_element / min / max / median ---
+
+namespace {
+// 0-1 原理：网络能排好所有 2^N 个 0/1 序列，就能排好任意输入
+template <std::size_t N>
+bool sorts_all_zero_one_inputs() {
+  for (std::uint32_t bits = 0; bits < (std::uint32_t(1) << N); ++bits) {
+    std::uint8_t v[N == 0 ? 1 : N];
+    for (std::size_t i = 0; i < N; ++i) {
+      v[i] = (bits >> i) & 1;
+    }
+    mystl::network_sort<N>(v, std::less<std::uint8_t>());
+    if (!std::is_sorted(v, v + N)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <std::size_t... Ns>
+void check_zero_one(std::index_sequence<Ns...>) {
+  bool ok[] = {sorts_all_zero_one_inputs<Ns + 1>()...};
+  for (std::size_t i = 0; i < sizeof...(Ns); ++i) {
+    EXPECT_TRUE(ok[i]) << "N = " << i + 1;
+  }
+}
+
+// 随机输入与 std::sort / std::nth_element 对照
+template <std::size_t N>
+void check_random(std::mt19937& rng) {
+  std::uniform_int_distribution<int> dist(-20, 20);  // 有大量重复元素
+  for (int round = 0; round < 200; ++round) {
+    mystl::array<float, N> a;
+    for (auto& x : a) {
+      x = float(dist(rng));
+    }
+    mystl::array<float, N> expect = a;
+    std::sort(expect.begin(), expect.end());
+
+    mystl::array<float, N> s = a;
+    mystl::sort(s);
+    ASSERT_TRUE(s == expect) << "N = " << N;
+
+    EXPECT_EQ(mystl::median(a), expect[(N - 1) / 2]);
+    EXPECT_EQ(mystl::select<N - 1>(a), expect[N - 1]);
+    EXPECT_EQ(mystl::min(a), expect[0]);
+    EXPECT_EQ(mystl::max(a), expect[N - 1]);
+
+    const std::size_t k = std::size_t(round) % N;
+    mystl::array<float, N> nth = a;
+    mystl::nth_element(nth, k);
+    EXPECT_EQ(nth[k], expect[k]);
+    for (std::size_t i = 0; i < N; ++i) {
+      if (i < k) {
+        EXPECT_LE(nth[i], nth[k]);
+      } else {
+        EXPECT_GE(nth[i], nth[k]);
+      }
+    }
+  }
+}
+
+template <std::size_t... Ns>
+void check_random_all(std::mt19937& rng, std::index_sequence<Ns...>) {
+  (check_random<Ns + 1>(rng), ...);
+}
+}  // namespace
+
+TEST(SortingNetworkTest, NetworkSizes) {
+  // Batcher 奇偶归并排序的比较器个数
+  static_assert(mystl::sorting_network_size<1>() == 0, "N = 1");
+  static_assert(mystl::sorting_network_size<2>() == 1, "N = 2");
+  static_assert(mystl::sorting_network_size<4>() == 5, "N = 4");
+  static_assert(mystl::sorting_network_size<8>() == 19, "N = 8");
+  static_assert(mystl::sorting_network_size<16>() == 63, "N = 16");
+  static_assert(mystl::sorting_network_size<32>() == 191, "N = 32");
+
+  // 选择网络比完整的排序网络短
+  static_assert(mystl::selection_network_size<16, 0>() <
+                    mystl::sorting_network_size<16>(),
+                "min needs fewer comparators");
+  static_assert(mystl::selection_network_size<9, 4>() <
+                    mystl::sorting_network_size<9>(),
+                "median needs fewer comparators");
+  EXPECT_TRUE(true);
+}
+
+TEST(SortingNetworkTest, ZeroOnePrinciple) {
+  check_zero_one(std::make_index_sequence<16>());
+}
+
+TEST(SortingNetworkTest, RandomInputsUpTo32) {
+  std::mt19937 rng(12345);
+  check_random_all(rng, std::make_index_sequence<32>());
+}
+
+TEST(SortingNetworkTest, ComparatorsAndNonArithmeticTypes) {
+  mystl::array<int, 6> a = {3, 1, 4, 1, 5, 9};
+  mystl::sort(a, std::greater<int>());
+  EXPECT_TRUE(a == (mystl::array<int, 6>{9, 5, 4, 3, 1, 1}));
+
+  mystl::array<std::string, 5> s = {"pear", "apple", "fig", "kiwi", "date"};
+  EXPECT_EQ(mystl::median(s), "fig");
+  EXPECT_EQ(mystl::min(s), "apple");
+  EXPECT_EQ(mystl::max(s), "pear");
+  mystl::sort(s);
+  EXPECT_EQ(s[0], "apple");
+  EXPECT_EQ(s[4], "pear");
+
+  // 相等的元素返回最靠前的那个
+  mystl::array<mystl::pair<int, int>, 4> p = {
+      mystl::pair<int, int>(2, 0), mystl::pair<int, int>(1, 1),
+      mystl::pair<int, int>(1, 2), mystl::pair<int, int>(3, 3)};
+  auto by_first = [](const mystl::pair<int, int>& x,
+                     const mystl::pair<int, int>& y) {
+    return x.first < y.first;
+  };
+  EXPECT_EQ(mystl::min(p, by_first).second, 1);
+  auto mm = mystl::minmax(mystl::array<int, 5>{4, -2, 8, 0, 8});
+  EXPECT_EQ(mm.first, -2);
+  EXPECT_EQ(mm.second, 8);
+
+  // 长度超过 32 时退回 std::sort
+  mystl::array<int, 40> big;
+  for (std::size_t i = 0; i < big.size(); ++i) {
+    big[i] = int(big.size() - i);
+  }
+  mystl::sort(big);
+  EXPECT_TRUE(std::is_sorted(big.begin(), big.end()));
+}
+
+TEST(SortingNetworkTest, EquivalentElementsArePermuted) {
+  // 比较器认为等价但值不同的元素：输出必须是输入的一个排列
+  auto abs_less = [](int x, int y) { return std::abs(x) < std::abs(y); };
+  mystl::array<int, 4> a = {-1, 1, 2, -2};
+  mystl::array<int, 4> sorted = a;
+  mystl::sort(sorted, abs_less);
+  EXPECT_TRUE(std::is_permutation(sorted.begin(), sorted.end(), a.begin()));
+  EXPECT_TRUE(std::is_sorted(sorted.begin(), sorted.end(), abs_less));
+
+  std::mt19937 rng(2024);
+  std::uniform_int_distribution<int> dist(-4, 4);
+  for (int round = 0; round < 200; ++round) {
+    mystl::array<int, 16> b;
+    for (auto& x : b) {
+      x = dist(rng);
+    }
+    mystl::array<int, 16> s = b;
+    mystl::sort(s, abs_less);
+    ASSERT_TRUE(std::is_permutation(s.begin(), s.end(), b.begin()));
+    ASSERT_TRUE(std::is_sorted(s.begin(), s.end(), abs_less));
+  }
+
+  // -0.0 与 +0.0 等价，两个都要保留
+  mystl::array<double, 5> z = {0.0, -0.0, 1.0, -0.0, 0.0};
+  mystl::sort(z);
+  EXPECT_EQ(std::count_if(z.begin(), z.end(),
+                          [](double x) { return std::signbit(x); }),
+            2);
+}
+
+TEST(SortingNetworkTest, NaNIsNotDuplicated) {
+  // 含 NaN 时 operator< 不是严格弱序，结果顺序不确定，但不能丢失或复制元素
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  mystl::array<double, 3> a = {nan, 1.0, 2.0};
+  mystl::sort(a);
+  EXPECT_EQ(std::count_if(a.begin(), a.end(),
+                          [](double x) { return std::isnan(x); }),
+            1);
+  EXPECT_EQ(std::count(a.begin(), a.end(), 1.0), 1);
+  EXPECT_EQ(std::count(a.begin(), a.end(), 2.0), 1);
+
+  mystl::array<double, 8> b = {3.0, nan, -1.0, nan, 0.5, 7.0, -0.0, 2.0};
+  mystl::sort(b);
+  EXPECT_EQ(std::count_if(b.begin(), b.end(),
+                          [](double x) { return std::isnan(x); }),
+            2);
+  for (double x : {3.0, -1.0, 0.5, 7.0, 0.0, 2.0}) {
+    EXPECT_EQ(std::count(b.begin(), b.end(), x), 1) << x;
+  }
+
+  mystl::array<float, 5> c = {1.0f, float(nan), -0.0f, 0.0f, 2.0f};
+  mystl::sort(c, std::greater<float>());
+  EXPECT_EQ(std::count_if(c.begin(), c.end(),
+                          [](float x) { return std::isnan(x); }),
+            1);
+  EXPECT_EQ(std::count_if(c.begin(), c.end(),
+                          [](float x) { return std::signbit(x); }),
+            1);
+  EXPECT_EQ(std::count(c.begin(), c.end(), 0.0f), 2);
+}
+
+TEST(SortingNetworkTest, Constexpr) {
+  constexpr mystl::array<int, 9> a = {7, 3, 9, 1, 5, 8, 2, 6, 4};
+  static_assert(mystl::median(a) == 5, "constexpr median");
+  static_assert(mystl::min(a) == 1 && mystl::max(a) == 9, "constexpr min/max");
+  constexpr auto sorted = [] {
+    mystl::array<int, 9> s = {7, 3, 9, 1, 5, 8, 2, 6, 4};
+    mystl::sort(s);
+    return s;
+  }();
+  static_assert(sorted == mystl::iota<int, 9>(1), "constexpr network sort");
+  EXPECT_TRUE(true);
+}
@@ -0,0 +1,112 @@
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "gtest/gtest.h"
+#include "mystl/spsc_queue.h"
+
+// --- 测试 mystl::spsc_queue ---
+
+TEST(SpscQueueTest, Layout) {
+  using Q = mystl::spsc_queue<int, 8>;
+  // 生产者下标、消费者下标和数据各占独立的缓存行
+  static_assert(alignof(Q) == MYSTL_CACHE_LINE_SIZE, "cache-line aligned");
+  static_assert(sizeof(Q) >= 3 * MYSTL_CACHE_LINE_SIZE, "three cache lines");
+  auto q = std::make_unique<Q>();
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(q.get()) % MYSTL_CACHE_LINE_SIZE,
+            0);
+}
+
+TEST(SpscQueueTest, SingleThread) {
+  mystl::spsc_queue<std::string, 4> q;
+  EXPECT_EQ(q.capacity(), 4);
+  std::string s;
+  EXPECT_FALSE(q.try_pop(s));
+  EXPECT_EQ(q.front(), nullptr);
+
+  EXPECT_TRUE(q.try_push("a"));
+  EXPECT_TRUE(q.try_emplace(3, 'b'));
+  EXPECT_TRUE(q.try_push(std::string("c")));
+  EXPECT_TRUE(q.try_push("d"));
+  EXPECT_FALSE(q.try_push("e"));  // 满
+  EXPECT_EQ(q.size_approx(), 4);
+
+  EXPECT_TRUE(q.try_pop(s));
+  EXPECT_EQ(s, "a");
+  ASSERT_NE(q.front(), nullptr);
+  EXPECT_EQ(*q.front(), "bbb");
+  EXPECT_TRUE(q.pop());
+  EXPECT_TRUE(q.try_push("e"));  // 回绕
+  std::string out[8];
+  EXPECT_EQ(q.try_pop_n(out, 8), 3);
+  EXPECT_EQ(out[0], "c");
+  EXPECT_EQ(out[2], "e");
+  EXPECT_TRUE(q.empty_approx());
+  EXPECT_FALSE(q.pop());
+}
+
+TEST(SpscQueueTest, Batches) {
+  mystl::spsc_queue<int, 8> q;
+  int src[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  EXPECT_EQ(q.try_push_n(src, 5), 5);
+  int dst[10] = {};
+  EXPECT_EQ(q.try_pop_n(dst, 3), 3);
+  // 只剩 6 个空位，且跨过存储末尾
+  EXPECT_EQ(q.try_push_n(src + 5, 5), 5);
+  EXPECT_EQ(q.try_push_n(src, 10), 1);
+  EXPECT_EQ(q.try_push_n(src, 1), 0);
+  EXPECT_EQ(q.try_pop_n(dst, 10), 8);
+  const int expect[8] = {3, 4, 5, 6, 7, 8, 9, 0};
+  for (int i = 0; i < 8; ++i) {
+    EXPECT_EQ(dst[i], expect[i]);
+  }
+  EXPECT_EQ(q.try_pop_n(dst, 10), 0);
+}
+
+TEST(SpscQueueTest, TwoThreadsPreserveOrder) {
+  constexpr std::uint64_t kCount = 200000;
+  auto q = std::make_unique<mystl::spsc_queue<std::uint64_t, 64>>();
+
+  std::thread producer([&] {
+    std::uint64_t next = 0;
+    std::uint64_t batch[16];
+    while (next < kCount) {
+      if (next % 3 == 0) {
+        // 单个写入
+        if (q->try_push(next)) {
+          ++next;
+        } else {
+          std::this_thread::yield();
+        }
+        continue;
+      }
+      std::size_t n = 0;
+      for (; n < 16 && next + n < kCount; ++n) {
+        batch[n] = next + n;
+      }
+      std::size_t pushed = q->try_push_n(batch, n);
+      next += pushed;
+      if (pushed == 0) {
+        std::this_thread::yield();
+      }
+    }
+  });
+
+  std::uint64_t expect = 0;
+  std::uint64_t buf[32];
+  bool ordered = true;
+  while (expect < kCount) {
+    std::size_t n = q->try_pop_n(buf, 1 + expect % 32);
+    if (n == 0) {
+      std::this_thread::yield();
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+      ordered = ordered && buf[i] == expect;
+      ++expect;
+    }
+  }
+  producer.join();
+  EXPECT_TRUE(ordered);
+  EXPECT_TRUE(q->empty_approx());
+}
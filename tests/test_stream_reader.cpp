@@ -0,0 +1,117 @@
+#include <cstdint>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include "gtest/gtest.h"
+#include "mystl/stream_reader.h"
+
+// --- 测试 mystl::chunked_file_reader / read_file_into ---
+
+namespace {
+// 写一个包含 0, 1, 2, ... n-1 (uint32) 的临时文件
+std::string make_file(const char* name, std::size_t n) {
+  const std::string path = testing::TempDir() + "mystl_" + name;
+  std::FILE* f = std::fopen(path.c_str(), "wb");
+  for (std::uint32_t i = 0; i < n; ++i) {
+    std::fwrite(&i, sizeof(i), 1, f);
+  }
+  std::fclose(f);
+  return path;
+}
+}  // namespace
+
+TEST(StreamReaderTest, ForEachChunk) {
+  // 文件长度不是块大小的整数倍
+  const std::size_t n = 10000;
+  const std::string path = make_file("stream_chunks.bin", n);
+
+  mystl::stream_options opts;
+  opts.chunk_size = 4096;
+  mystl::chunked_file_reader reader(path, opts);
+  EXPECT_EQ(reader.size(), n * 4);
+  EXPECT_EQ(reader.chunk_size(), 4096);
+
+  std::size_t chunks = 0;
+  std::uint64_t sum = 0;
+  std::size_t total = reader.for_each_chunk(
+      [&](const unsigned char* p, std::size_t bytes) {
+        ++chunks;
+        const std::uint32_t* values = reinterpret_cast<const std::uint32_t*>(p);
+        for (std::size_t i = 0; i < bytes / 4; ++i) {
+          sum += values[i];
+        }
+      });
+  EXPECT_EQ(total, n * 4);
+  EXPECT_EQ(chunks, (n * 4 + 4095) / 4096);
+  EXPECT_EQ(sum, std::uint64_t(n) * (n - 1) / 2);
+  std::remove(path.c_str());
+}
+
+TEST(StreamReaderTest, ReadFileIntoVector) {
+  // 长度恰好是块大小的整数倍，以及不是整数倍两种情况
+  for (std::size_t n : {std::size_t(4096), std::size_t(12345)}) {
+    const std::string path = make_file("stream_into.bin", n);
+    mystl::vector<std::uint32_t> v = {7, 7};
+    mystl::stream_options opts;
+    opts.chunk_size = 4096;
+    std::size_t seen = 0;
+    std::size_t got = mystl::read_file_into(
+        path, v, opts, [&](mystl::span<std::uint32_t> chunk) {
+          // 回调拿到的是已经落到 vector 中的那一段
+          EXPECT_EQ(chunk.front(), seen);
+          seen += chunk.size();
+        });
+    EXPECT_EQ(got, n);
+    EXPECT_EQ(seen, n);
+    ASSERT_EQ(v.size(), n + 2);
+    EXPECT_EQ(v[0], 7);
+    for (std::size_t i = 0; i < n; ++i) {
+      ASSERT_EQ(v[i + 2], i);
+    }
+    std::remove(path.c_str());
+  }
+}
+
+TEST(StreamReaderTest, DirectIo) {
+  // 不支持 O_DIRECT 的文件系统（例如 tmpfs）会自动退回普通读
+  const std::size_t n = 5000;
+  const std::string path = make_file("stream_direct.bin", n);
+  mystl::vector<std::uint32_t> v;
+  mystl::stream_options opts;
+  opts.chunk_size = 8192;
+  opts.direct_io = true;
+  EXPECT_EQ(mystl::read_file_into(path, v, opts), n);
+  ASSERT_EQ(v.size(), n);
+  EXPECT_EQ(v.back(), n - 1);
+  std::remove(path.c_str());
+}
+
+TEST(StreamReaderTest, Errors) {
+  const std::string path = make_file("stream_errors.bin", 3000);
+  mystl::vector<std::uint32_t> v = {1, 2, 3};
+  mystl::stream_options opts;
+  opts.chunk_size = 4096;
+
+  // 回调抛出的异常会传播出来，读取线程正常退出，vector 恢复原长度
+  int calls = 0;
+  EXPECT_THROW(mystl::read_file_into(path, v, opts,
+                                     [&](mystl::span<std::uint32_t>) {
+                                       if (++calls == 2) {
+                                         throw std::runtime_error("parse");
+                                       }
+                                     }),
+               std::runtime_error);
+  EXPECT_EQ(v.size(), 3);
+
+  // 文件长度不是 sizeof(T) 的整数倍
+  mystl::vector<std::uint64_t> v64;
+  std::FILE* f = std::fopen(path.c_str(), "ab");
+  std::fputc(0, f);
+  std::fclose(f);
+  EXPECT_THROW(mystl::read_file_into(path, v64), std::runtime_error);
+
+  EXPECT_THROW(mystl::chunked_file_reader(testing::TempDir() + "missing"),
+               std::system_error);
+  std::remove(path.c_str());
+}
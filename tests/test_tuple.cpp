@@ -1,7 +1,13 @@
 #include <gtest/gtest.h>
+#include <functional>
+#include <limits>
 #include <memory>
 #include <string>
+#include <tuple>
 #include <vector>
+#include "mystl/allocator.h"
+#include "mystl/array.h"
+#include "mystl/hash.h"
 #include "mystl/tuple.h"
 #include "utils/test_types.h"
 
@@ -410,6 +416,87 @@ TEST(TupleTest, TupleCat) {
   EXPECT_EQ(mystl::get<4>(cat3), 100L);
 }
 
+TEST(TupleTest, TupleCatMovesEachElementOnce) {
+  using mystl::test::Perfect;
+  mystl::tuple<Perfect, Perfect> a(Perfect(1), Perfect(2));
+  mystl::tuple<Perfect> b(Perfect(3));
+  mystl::tuple<Perfect, Perfect> c(Perfect(4), Perfect(5));
+
+  // 右值参数：每个元素恰好移动一次，没有中间结果
+  Perfect::counter.reset();
+  auto moved = mystl::tuple_cat(mystl::move(a), mystl::move(b),
+                                mystl::move(c));
+  EXPECT_EQ(Perfect::counter.move_constructor, 5);
+  EXPECT_EQ(Perfect::counter.copy_constructor, 0);
+  EXPECT_EQ(Perfect::counter.move_assign, 0);
+  EXPECT_EQ(mystl::get<0>(moved).value(), 1);
+  EXPECT_EQ(mystl::get<4>(moved).value(), 5);
+
+  // 左值参数：每个元素恰好拷贝一次
+  Perfect::counter.reset();
+  auto copied = mystl::tuple_cat(moved, moved);
+  EXPECT_EQ(Perfect::counter.copy_constructor, 10);
+  EXPECT_EQ(Perfect::counter.move_constructor, 0);
+  EXPECT_EQ(mystl::get<9>(copied).value(), 5);
+
+  // 左右值混合
+  mystl::tuple<Perfect> d(Perfect(6));
+  Perfect::counter.reset();
+  auto mixed = mystl::tuple_cat(moved, mystl::move(d));
+  EXPECT_EQ(Perfect::counter.copy_constructor, 5);
+  EXPECT_EQ(Perfect::counter.move_constructor, 1);
+  EXPECT_EQ(mystl::get<5>(mixed).value(), 6);
+}
+
+TEST(TupleTest, TupleCatReferencesAndPairs) {
+  int x = 1;
+  double y = 2.0;
+  // 引用元素保持为引用
+  auto refs = mystl::tuple_cat(mystl::tie(x), mystl::tie(y),
+                               mystl::make_tuple('c'));
+  static_assert(std::is_same<decltype(refs),
+                             mystl::tuple<int&, double&, char>>::value,
+                "tuple_cat keeps reference element types");
+  mystl::get<0>(refs) = 10;
+  EXPECT_EQ(x, 10);
+
+  // pair 也是类 tuple 的参数
+  auto with_pair =
+      mystl::tuple_cat(mystl::make_pair(1, std::string("a")), mystl::tuple<>());
+  static_assert(std::is_same<decltype(with_pair),
+                             mystl::tuple<int, std::string>>::value,
+                "tuple_cat accepts pair");
+  EXPECT_EQ(mystl::get<1>(with_pair), "a");
+
+  auto none = mystl::tuple_cat();
+  static_assert(std::is_same<decltype(none), mystl::tuple<>>::value,
+                "tuple_cat() is an empty tuple");
+}
+
+TEST(TupleTest, TypeIndexing) {
+  static_assert(std::is_same<mystl::NthType_t<0, int, char, double>, int>::value);
+  static_assert(
+      std::is_same<mystl::NthType_t<2, int, char, double>, double>::value);
+  static_assert(std::is_same<mystl::NthType_t<1, int, int&, int>, int&>::value);
+  static_assert(mystl::TypeIndex_v<char, int, char, double> == 1);
+  static_assert(mystl::TypeIndex_v<double, int, char, double> == 2);
+  static_assert(mystl::TypeIndex_v<long, int, char> == 2);  // 不存在
+  static_assert(mystl::CountType_v<int, int, char, int> == 2);
+  static_assert(mystl::CountType_v<long, int, char> == 0);
+  static_assert(mystl::CountType_v<int> == 0);
+
+  // 宽 tuple 上的 get<I> 和 get<T>
+  using Wide = mystl::tuple<int, int, int, int, int, int, int, int, int, int,
+                            int, int, int, int, int, int, int, int, int, int,
+                            int, int, int, int, int, int, int, int, int, int,
+                            int, int, int, int, int, int, int, int, int, long>;
+  Wide w{};
+  mystl::get<39>(w) = 7L;
+  mystl::get<20>(w) = 3;
+  EXPECT_EQ(mystl::get<long>(w), 7L);
+  EXPECT_EQ(mystl::get<20>(w), 3);
+}
+
 TEST(TupleTest, StdSwap) {
   mystl::tuple<int, double, char> t1(1, 2.2, 'a');
   mystl::tuple<int, double, char> t2(99, 8.8, 'z');
@@ -741,4 +828,405 @@ TEST(TupleTest, ExampleTest) {
     EXPECT_EQ(mystl::get<0>(p1), mystl::get<0>(p1_original));
     EXPECT_EQ(mystl::get<0>(p2), mystl::get<0>(p2_original));
   }
-}
\ No newline at end of file
+}
+
+namespace {
+struct EmptyPolicy {
+  int operator()(int x) const { return x + 1; }
+};
+struct OtherEmptyPolicy {};
+struct FinalEmptyPolicy final {};
+struct DerivedTuple : mystl::tuple<EmptyPolicy> {};
+}  // namespace
+
+TEST(TupleTest, EmptyBaseOptimization) {
+  // 非 final 的空类不占空间
+  static_assert(sizeof(mystl::tuple<EmptyPolicy, int*>) == sizeof(int*));
+  static_assert(sizeof(mystl::tuple<int*, EmptyPolicy, OtherEmptyPolicy>) ==
+                sizeof(int*));
+  static_assert(
+      sizeof(mystl::tuple<std::hash<int>, std::equal_to<int>,
+                          mystl::allocator<int>, int*>) == sizeof(int*));
+  static_assert(std::is_empty<mystl::tuple<EmptyPolicy, OtherEmptyPolicy>>::value);
+  // final 类不能作为基类，按普通成员存储
+  static_assert(sizeof(mystl::tuple<FinalEmptyPolicy, int*>) == 2 * sizeof(int*));
+  // 空基类优化是私有的，tuple 不会隐式转换成元素类型
+  static_assert(!std::is_convertible<mystl::tuple<EmptyPolicy>, EmptyPolicy>::value);
+
+  mystl::tuple<EmptyPolicy, int, EmptyPolicy> t(EmptyPolicy{}, 41, EmptyPolicy{});
+  EXPECT_EQ(mystl::get<0>(t)(mystl::get<1>(t)), 42);
+  EXPECT_EQ(mystl::get<2>(t)(1), 2);
+  // 同一个空类出现两次时仍然是两个不同的对象
+  EXPECT_NE(static_cast<void*>(&mystl::get<0>(t)),
+            static_cast<void*>(&mystl::get<2>(t)));
+
+  mystl::tuple<EmptyPolicy, std::string> u(EmptyPolicy{}, "abc");
+  auto v = u;
+  auto w = mystl::move(u);
+  EXPECT_EQ(mystl::get<1>(v), "abc");
+  EXPECT_EQ(mystl::get<1>(w), "abc");
+  EXPECT_EQ(mystl::get<EmptyPolicy>(w)(0), 1);
+  EmptyPolicy&& moved = mystl::get<0>(mystl::move(w));
+  EXPECT_EQ(moved(1), 2);
+
+  // 嵌套的空 tuple 按普通成员存储，外层的 TupleLeaf<0, EmptyPolicy> 仍然唯一
+  mystl::tuple<EmptyPolicy, mystl::tuple<EmptyPolicy>> nested;
+  EXPECT_EQ(mystl::get<0>(nested)(1), 2);
+  EXPECT_EQ(mystl::get<0>(mystl::get<1>(nested))(2), 3);
+  EXPECT_NE(static_cast<void*>(&mystl::get<0>(nested)),
+            static_cast<void*>(&mystl::get<0>(mystl::get<1>(nested))));
+  mystl::tuple<EmptyPolicy, DerivedTuple> derived;
+  EXPECT_EQ(mystl::get<0>(derived)(3), 4);
+  EXPECT_EQ(mystl::get<0>(mystl::get<1>(derived))(4), 5);
+  // 非空的嵌套 tuple 布局不受影响
+  static_assert(sizeof(mystl::tuple<mystl::tuple<int>>) == sizeof(int));
+}
+
+TEST(TupleTest, TriviallyCopyable) {
+  static_assert(
+      std::is_trivially_copyable<mystl::tuple<int, double, char>>::value);
+  static_assert(
+      std::is_trivially_copy_assignable<mystl::tuple<int, double>>::value);
+  static_assert(
+      std::is_trivially_move_assignable<mystl::tuple<int, double>>::value);
+  static_assert(std::is_trivially_copyable<mystl::tuple<>>::value);
+  static_assert(
+      !std::is_trivially_copyable<mystl::tuple<int, std::string>>::value);
+
+  static_assert(!std::is_copy_assignable<mystl::tuple<const int, int>>::value);
+  static_assert(!std::is_copy_assignable<mystl::tuple<MoveOnly>>::value);
+  static_assert(std::is_move_assignable<mystl::tuple<MoveOnly>>::value);
+  static_assert(!std::is_copy_assignable<mystl::tuple<const int&>>::value);
+  static_assert(!std::is_move_assignable<mystl::tuple<const int&>>::value);
+  static_assert(std::is_copy_assignable<mystl::tuple<int&, int&>>::value);
+  static_assert(std::is_nothrow_move_assignable<
+                mystl::tuple<int, std::string>>::value);
+
+  // 同类型的引用 tuple 之间赋值：写入被引用的对象
+  int a = 1, b = 2, c = 3, d = 4;
+  mystl::tuple<int&, int&> lhs(a, b);
+  mystl::tuple<int&, int&> rhs(c, d);
+  lhs = rhs;
+  EXPECT_EQ(a, 3);
+  EXPECT_EQ(b, 4);
+  EXPECT_EQ(&mystl::get<0>(lhs), &a);
+
+  // 右值引用成员：移动赋值转发为右值
+  std::string s1 = "x", s2 = "y";
+  mystl::tuple<std::string&&> r1(std::move(s1));
+  mystl::tuple<std::string&&> r2(std::move(s2));
+  r1 = std::move(r2);
+  EXPECT_EQ(s1, "y");
+}
+
+TEST(TupleTest, ThreeWayCompare) {
+  using T = mystl::tuple<int, std::string, double>;
+  EXPECT_EQ(mystl::three_way_compare(T(1, "a", 1.0), T(1, "a", 1.0)), 0);
+  EXPECT_LT(mystl::three_way_compare(T(1, "a", 1.0), T(2, "a", 0.0)), 0);
+  EXPECT_GT(mystl::three_way_compare(T(1, "b", 1.0), T(1, "a", 9.0)), 0);
+  EXPECT_LT(mystl::three_way_compare(T(1, "a", 1.0), T(1, "a", 2.0)), 0);
+  EXPECT_EQ(mystl::three_way_compare(mystl::tuple<>(), mystl::tuple<>()), 0);
+  EXPECT_TRUE(mystl::tuple<>() == mystl::tuple<>());
+  EXPECT_FALSE(mystl::tuple<>() < mystl::tuple<>());
+
+  // 嵌套的 tuple 和 pair 递归地做三路比较
+  using Nested = mystl::tuple<mystl::pair<int, int>, mystl::tuple<char, int>>;
+  Nested a(mystl::pair<int, int>(1, 2), mystl::tuple<char, int>('x', 1));
+  Nested b(mystl::pair<int, int>(1, 2), mystl::tuple<char, int>('x', 2));
+  EXPECT_LT(mystl::three_way_compare(a, b), 0);
+  EXPECT_TRUE(a < b);
+  EXPECT_TRUE(a != b);
+  EXPECT_TRUE(a == a);
+
+  // 标量走不短路的分支，语义不变：NaN 与任何值都不相等
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  EXPECT_FALSE(mystl::make_tuple(1, nan) == mystl::make_tuple(1, nan));
+  EXPECT_TRUE(mystl::make_tuple(1, 2.5, 'c') == mystl::make_tuple(1, 2.5, 'c'));
+  // < 按 !(b < a) 判断等价：NaN 不小于也不大于任何值，继续比较后面的元素
+  EXPECT_TRUE(mystl::make_tuple(nan, 1) < mystl::make_tuple(nan, 2));
+  EXPECT_FALSE(mystl::make_tuple(nan, 2) < mystl::make_tuple(nan, 1));
+  EXPECT_TRUE(mystl::make_tuple(1, nan, 1) < mystl::make_tuple(1, 0.0, 2));
+  EXPECT_TRUE(mystl::make_pair(nan, 1) < mystl::make_pair(nan, 2));
+  EXPECT_FALSE(mystl::make_pair(nan, 2) < mystl::make_pair(nan, 1));
+  EXPECT_EQ(mystl::make_tuple(nan, 1) < mystl::make_tuple(nan, 2),
+            std::make_tuple(nan, 1) < std::make_tuple(nan, 2));
+
+  // 引用和值混合比较
+  int x = 3, y = 4;
+  EXPECT_TRUE(mystl::tie(x, y) == mystl::make_tuple(3, 4));
+  EXPECT_TRUE(mystl::tie(x, y) < mystl::make_tuple(3, 5));
+}
+
+namespace {
+// 统计 < 的调用次数；compare() 只应该被三路比较调用
+struct LessCounted {
+  static inline int less_calls = 0;
+  static inline int compare_calls = 0;
+  int v;
+
+  int compare(const LessCounted& other) const {
+    ++compare_calls;
+    return v - other.v;
+  }
+  friend bool operator<(const LessCounted& a, const LessCounted& b) {
+    ++less_calls;
+    return a.v < b.v;
+  }
+};
+}  // namespace
+
+TEST(TupleTest, LessUsesOnlyOperatorLess) {
+  using T = mystl::tuple<LessCounted, LessCounted, LessCounted>;
+  LessCounted::less_calls = LessCounted::compare_calls = 0;
+  // 第一个元素就分出大小：只比较一次
+  EXPECT_TRUE(T({1}, {9}, {9}) < T({2}, {0}, {0}));
+  EXPECT_EQ(LessCounted::less_calls, 1);
+  // a > b：两次比较后停止
+  LessCounted::less_calls = 0;
+  EXPECT_FALSE(T({2}, {0}, {0}) < T({1}, {9}, {9}));
+  EXPECT_EQ(LessCounted::less_calls, 2);
+  // 前两个等价，第三个 a < b：2 + 2 + 1 次
+  LessCounted::less_calls = 0;
+  EXPECT_TRUE(T({1}, {1}, {1}) < T({1}, {1}, {2}));
+  EXPECT_EQ(LessCounted::less_calls, 5);
+  EXPECT_EQ(LessCounted::compare_calls, 0);
+
+  using P = mystl::pair<LessCounted, LessCounted>;
+  LessCounted::less_calls = 0;
+  EXPECT_TRUE(P({1}, {5}) < P({2}, {0}));
+  EXPECT_EQ(LessCounted::less_calls, 1);
+  LessCounted::less_calls = 0;
+  EXPECT_FALSE(P({1}, {5}) < P({1}, {5}));
+  EXPECT_EQ(LessCounted::less_calls, 3);
+  EXPECT_EQ(LessCounted::compare_calls, 0);
+
+  // three_way_compare 仍然用 compare() 一次得到结果
+  EXPECT_GT(mystl::three_way_compare(P({1}, {5}), P({1}, {4})), 0);
+  EXPECT_EQ(LessCounted::compare_calls, 2);
+}
+
+TEST(TupleTest, Hash) {
+  using T = mystl::tuple<int, std::string>;
+  mystl::hash<T> h;
+  EXPECT_EQ(h(T(1, "abc")), h(T(1, "abc")));
+  EXPECT_NE(h(T(1, "abc")), h(T(2, "abc")));
+  mystl::hash<mystl::tuple<int, int>> h2;
+  EXPECT_NE(h2(mystl::make_tuple(1, 2)), h2(mystl::make_tuple(2, 1)));
+  EXPECT_NE(h(T(0, "")), 0u);
+
+  mystl::hash<mystl::pair<int, int>> hp;
+  EXPECT_EQ(hp(mystl::pair<int, int>(1, 2)), hp(mystl::pair<int, int>(1, 2)));
+  EXPECT_NE(hp(mystl::pair<int, int>(1, 2)), hp(mystl::pair<int, int>(2, 1)));
+
+  // 默认的 mystl::hash<int> 与 std::hash<int> 一致
+  EXPECT_EQ(mystl::hash<int>()(42), std::hash<int>()(42));
+}
+
+namespace {
+// 记录收到的参数的值类别，不做任何拷贝
+struct ValueCategory {
+  int operator()(const Perfect&) const { return 0; }
+  int operator()(Perfect&) const { return 1; }
+  int operator()(Perfect&&) const { return 2; }
+};
+
+struct Aggregate2 {
+  Perfect a;
+  Perfect b;
+  Aggregate2(Perfect&& x, const Perfect& y) : a(std::move(x)), b(y) {}
+};
+
+struct Widget {
+  int base;
+  int add(int x) const { return base + x; }
+  int& scale(int k) & {
+    base *= k;
+    return base;
+  }
+  int take() && { return base; }
+};
+
+struct DerivedWidget : Widget {};
+}  // namespace
+
+TEST(TupleTest, ApplyForwardsWithoutCopies) {
+  mystl::tuple<Perfect, Perfect> t(Perfect(1), Perfect(2));
+
+  Perfect::counter.reset();
+  // 左值 tuple 传左值引用，右值 tuple 传右值引用，两者都不拷贝也不移动
+  int lv = mystl::apply(
+      [](Perfect& a, Perfect& b) { return a.value() + b.value(); }, t);
+  int rv = mystl::apply(
+      [](Perfect&& a, Perfect&& b) { return a.value() * b.value(); },
+      mystl::move(t));
+  const auto& ct = t;
+  int cv = mystl::apply(
+      [](const Perfect& a, const Perfect& b) { return a.value() - b.value(); },
+      ct);
+  EXPECT_EQ(lv, 3);
+  EXPECT_EQ(rv, 2);
+  EXPECT_EQ(cv, -1);
+  EXPECT_EQ(Perfect::counter.copy_constructor, 0);
+  EXPECT_EQ(Perfect::counter.move_constructor, 0);
+
+  // 返回引用时保持引用
+  decltype(auto) first = mystl::apply(
+      [](Perfect& a, Perfect&) -> Perfect& { return a; }, t);
+  static_assert(std::is_same<decltype(first), Perfect&>::value,
+                "apply preserves reference return types");
+  EXPECT_EQ(&first, &mystl::get<0>(t));
+
+  // 成员函数指针
+  Widget w{10};
+  EXPECT_EQ(mystl::apply(&Widget::add, mystl::make_tuple(&w, 5)), 15);
+
+  // 仅可移动类型
+  mystl::tuple<MoveOnly> mo(MoveOnly(7));
+  MoveOnly::counter.reset();
+  MoveOnly taken = mystl::apply([](MoveOnly&& m) { return std::move(m); },
+                                mystl::move(mo));
+  EXPECT_EQ(MoveOnly::counter.move_constructor, 1);  // 只有 return 时的一次
+  EXPECT_EQ(taken.value(), 7);
+}
+
+TEST(TupleTest, ApplyMemberPointers) {
+  // 成员函数指针：对象本身、派生类对象、指针、智能指针、reference_wrapper
+  Widget w{10};
+  EXPECT_EQ(mystl::apply(&Widget::add, mystl::make_tuple(w, 1)), 11);
+  EXPECT_EQ(mystl::apply(&Widget::add, mystl::make_tuple(DerivedWidget{{20}}, 1)),
+            21);
+  EXPECT_EQ(mystl::apply(&Widget::add, mystl::make_tuple(&w, 2)), 12);
+  auto up = std::make_unique<Widget>(Widget{30});
+  EXPECT_EQ(mystl::apply(&Widget::add, mystl::forward_as_tuple(up, 3)), 33);
+  EXPECT_EQ(mystl::apply(&Widget::add, mystl::make_tuple(std::cref(w), 4)), 14);
+
+  // 引用限定的成员函数按对象的值类别选择
+  int& scaled = mystl::apply(&Widget::scale, mystl::forward_as_tuple(w, 2));
+  EXPECT_EQ(&scaled, &w.base);
+  EXPECT_EQ(w.base, 20);
+  EXPECT_EQ(mystl::apply(&Widget::take, mystl::make_tuple(Widget{5})), 5);
+
+  // 数据成员指针：左值对象得到左值引用，右值对象得到右值引用
+  decltype(auto) base = mystl::apply(&Widget::base, mystl::forward_as_tuple(w));
+  static_assert(std::is_same<decltype(base), int&>::value,
+                "data member of an lvalue is an lvalue");
+  EXPECT_EQ(&base, &w.base);
+  static_assert(std::is_same<decltype(mystl::apply(
+                                 &Widget::base, mystl::make_tuple(Widget{1}))),
+                             int&&>::value,
+                "data member of an rvalue is an xvalue");
+  EXPECT_EQ(mystl::apply(&Widget::base, mystl::make_tuple(&w)), 20);
+
+  // 常量表达式中也能调用成员指针
+  static constexpr mystl::array<mystl::pair<int, int>, 1> cp = {
+      mystl::pair<int, int>(1, 2)};
+  static_assert(mystl::apply(&mystl::pair<int, int>::second, cp) == 2,
+                "member pointers in constant expressions");
+}
+
+TEST(TupleTest, ApplyOnPairAndArray) {
+  mystl::pair<int, std::string> p(3, "abc");
+  EXPECT_EQ(mystl::apply(
+                [](int n, const std::string& s) { return s.size() + n; }, p),
+            6u);
+
+  mystl::array<int, 4> a = {1, 2, 3, 4};
+  EXPECT_EQ(mystl::apply([](auto... xs) { return (0 + ... + xs); }, a), 10);
+
+  // 在常量表达式中使用
+  constexpr mystl::array<int, 3> ca = {1, 2, 3};
+  static_assert(mystl::apply([](int x, int y, int z) { return x * y * z; },
+                             ca) == 6,
+                "apply is constexpr");
+  static_assert(mystl::make_from_tuple<mystl::pair<int, int>>(
+                    mystl::array<int, 2>{{4, 5}})
+                        .second == 5,
+                "make_from_tuple is constexpr");
+
+  // 值类别逐元素转发
+  mystl::pair<Perfect, Perfect> pp(Perfect(1), Perfect(2));
+  int categories[2] = {};
+  int i = 0;
+  mystl::tuple_for_each(mystl::move(pp), [&](auto&& e) {
+    categories[i++] = ValueCategory()(std::forward<decltype(e)>(e));
+  });
+  EXPECT_EQ(categories[0], 2);
+  EXPECT_EQ(categories[1], 2);
+}
+
+TEST(TupleTest, MakeFromTupleConstructsInPlace) {
+  Perfect a(1), b(2);
+  Perfect::counter.reset();
+  // 参数直接转发给构造函数：a 移动一次，b 拷贝一次，没有别的
+  auto agg = mystl::make_from_tuple<Aggregate2>(
+      mystl::forward_as_tuple(std::move(a), b));
+  EXPECT_EQ(Perfect::counter.move_constructor, 1);
+  EXPECT_EQ(Perfect::counter.copy_constructor, 1);
+  EXPECT_EQ(agg.a.value(), 1);
+  EXPECT_EQ(agg.b.value(), 2);
+
+  auto s = mystl::make_from_tuple<std::string>(mystl::make_tuple(3, 'x'));
+  EXPECT_EQ(s, "xxx");
+}
+
+TEST(TupleTest, TupleForEach) {
+  mystl::tuple<Perfect, Perfect, Perfect> t(Perfect(1), Perfect(2),
+                                            Perfect(3));
+  Perfect::counter.reset();
+  std::vector<int> seen;
+  mystl::tuple_for_each(t, [&](Perfect& p) { seen.push_back(p.value()); });
+  EXPECT_EQ(seen, (std::vector<int>{1, 2, 3}));  // 按元素顺序
+  EXPECT_EQ(Perfect::counter.copy_constructor, 0);
+  EXPECT_EQ(Perfect::counter.move_constructor, 0);
+
+  // 可以修改元素，也能处理异构类型
+  auto mixed = mystl::make_tuple(1, 2.5, std::string("a"));
+  mystl::tuple_for_each(mixed, [](auto& e) { e = e + e; });
+  EXPECT_EQ(mystl::get<0>(mixed), 2);
+  EXPECT_DOUBLE_EQ(mystl::get<1>(mixed), 5.0);
+  EXPECT_EQ(mystl::get<2>(mixed), "aa");
+
+  mystl::tuple_for_each(mystl::tuple<>(), [](auto&) { FAIL(); });
+}
+
+TEST(TupleTest, TupleTransform) {
+  auto t = mystl::make_tuple(1, 2.5, 'c');
+  auto doubled = mystl::tuple_transform(t, [](auto x) { return x * 2; });
+  static_assert(
+      std::is_same<decltype(doubled), mystl::tuple<int, double, int>>::value,
+      "element types are the return types of f");
+  EXPECT_EQ(mystl::get<0>(doubled), 2);
+  EXPECT_DOUBLE_EQ(mystl::get<1>(doubled), 5.0);
+  EXPECT_EQ(mystl::get<2>(doubled), 'c' * 2);
+
+  // 返回引用时结果存引用，不拷贝元素
+  mystl::tuple<Perfect, Perfect> p(Perfect(1), Perfect(2));
+  Perfect::counter.reset();
+  auto refs = mystl::tuple_transform(p, [](Perfect& e) -> Perfect& {
+    return e;
+  });
+  static_assert(
+      std::is_same<decltype(refs), mystl::tuple<Perfect&, Perfect&>>::value,
+      "reference results are kept as references");
+  EXPECT_EQ(&mystl::get<1>(refs), &mystl::get<1>(p));
+  EXPECT_EQ(Perfect::counter.copy_constructor, 0);
+  EXPECT_EQ(Perfect::counter.move_constructor, 0);
+
+  // 按值返回时每个元素只移动一次进结果
+  Perfect::counter.reset();
+  auto moved = mystl::tuple_transform(
+      mystl::move(p), [](Perfect&& e) { return Perfect(e.value() + 10); });
+  EXPECT_EQ(Perfect::counter.copy_constructor, 0);
+  EXPECT_EQ(Perfect::counter.move_constructor, 2);
+  EXPECT_EQ(mystl::get<1>(moved).value(), 12);
+
+  // 按顺序调用 f
+  std::vector<int> order;
+  mystl::array<int, 3> a = {7, 8, 9};
+  auto r = mystl::tuple_transform(a, [&](int x) {
+    order.push_back(x);
+    return x;
+  });
+  EXPECT_EQ(order, (std::vector<int>{7, 8, 9}));
+  EXPECT_EQ(mystl::get<2>(r), 9);
+}
@@ -0,0 +1,359 @@
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+#include "gtest/gtest.h"
+#include "mystl/unordered_flat_map.h"
+#include "utils/test_types.h"
+
+using mystl::test::Perfect;
+
+// --- 测试 mystl::unordered_flat_map ---
+
+TEST(UnorderedFlatMapTest, GroupMatchAgreesWithPortable) {
+  std::mt19937 rng(7);
+  const mystl::detail::ctrl_t kinds[] = {mystl::detail::kCtrlEmpty,
+                                         mystl::detail::kCtrlDeleted, 0, 5,
+                                         127};
+  for (int round = 0; round < 1000; ++round) {
+    mystl::detail::ctrl_t bytes[mystl::detail::kGroupWidth];
+    for (auto& b : bytes) {
+      b = kinds[rng() % 5];
+    }
+    const mystl::detail::ctrl_group g(bytes);
+    const mystl::detail::group_portable p(bytes);
+    EXPECT_EQ(g.match(5), p.match(5));
+    EXPECT_EQ(g.match_empty(), p.match_empty());
+    EXPECT_EQ(g.match_empty_or_deleted(), p.match_empty_or_deleted());
+  }
+  EXPECT_EQ(mystl::detail::group_leading_zeros(0), 16u);
+  EXPECT_EQ(mystl::detail::group_leading_zeros(1u << 15), 0u);
+  EXPECT_EQ(mystl::detail::group_leading_zeros(1u), 15u);
+}
+
+TEST(UnorderedFlatMapTest, BasicOperations) {
+  mystl::unordered_flat_map<std::string, int> m;
+  EXPECT_TRUE(m.empty());
+  EXPECT_EQ(m.capacity(), 0);
+  EXPECT_EQ(m.find("a"), m.end());
+  EXPECT_EQ(m.begin(), m.end());
+
+  EXPECT_TRUE(m.insert(mystl::pair<const std::string, int>("a", 1)).second);
+  EXPECT_FALSE(m.insert(mystl::pair<const std::string, int>("a", 2)).second);
+  EXPECT_TRUE(m.try_emplace("b", 2).second);
+  EXPECT_TRUE(m.emplace("c", 3).second);
+  m["d"] = 4;
+  EXPECT_EQ(m.size(), 4);
+  EXPECT_EQ(m.capacity(), 16);
+  EXPECT_EQ(m.at("a"), 1);
+  EXPECT_EQ(m["d"], 4);
+  EXPECT_TRUE(m.contains("c"));
+  EXPECT_EQ(m.count("z"), 0);
+  EXPECT_THROW(m.at("z"), std::out_of_range);
+
+  EXPECT_FALSE(m.insert_or_assign("a", 10).second);
+  EXPECT_EQ(m.at("a"), 10);
+
+  EXPECT_EQ(m.erase("b"), 1);
+  EXPECT_EQ(m.erase("b"), 0);
+  EXPECT_FALSE(m.contains("b"));
+  EXPECT_EQ(m.size(), 3);
+
+  int sum = 0;
+  for (const auto& kv : m) {
+    sum += kv.second;
+  }
+  EXPECT_EQ(sum, 10 + 3 + 4);
+
+  m.clear();
+  EXPECT_TRUE(m.empty());
+  EXPECT_EQ(m.capacity(), 16);
+  EXPECT_EQ(m.begin(), m.end());
+}
+
+TEST(UnorderedFlatMapTest, GrowsAndKeepsLoadFactorBelowSevenEighths) {
+  mystl::unordered_flat_map<int, int> m;
+  for (int i = 0; i < 100000; ++i) {
+    m[i] = i * 2;
+    ASSERT_LE(m.load_factor(), m.max_load_factor());
+  }
+  EXPECT_EQ(m.size(), 100000);
+  for (int i = 0; i < 100000; ++i) {
+    ASSERT_EQ(m.at(i), i * 2);
+  }
+  EXPECT_FALSE(m.contains(-1));
+  EXPECT_FALSE(m.contains(100000));
+}
+
+// 与 std::unordered_map 对照的随机操作，键的范围很小，插入和删除频繁交替，
+// 会产生大量墓碑和原地重新散列
+TEST(UnorderedFlatMapTest, RandomOperationsMatchStd) {
+  std::mt19937_64 rng(42);
+  mystl::unordered_flat_map<std::uint64_t, std::uint64_t> m;
+  std::unordered_map<std::uint64_t, std::uint64_t> ref;
+  for (int step = 0; step < 200000; ++step) {
+    const std::uint64_t key = rng() % 2000;
+    switch (rng() % 4) {
+      case 0:
+      case 1:
+        m[key] = step;
+        ref[key] = step;
+        break;
+      case 2:
+        ASSERT_EQ(m.erase(key), ref.erase(key));
+        break;
+      default: {
+        auto it = m.find(key);
+        auto rit = ref.find(key);
+        ASSERT_EQ(it == m.end(), rit == ref.end());
+        if (rit != ref.end()) {
+          ASSERT_EQ(it->second, rit->second);
+        }
+      }
+    }
+    ASSERT_EQ(m.size(), ref.size());
+  }
+  std::size_t visited = 0;
+  for (const auto& kv : m) {
+    ASSERT_EQ(ref.at(kv.first), kv.second);
+    ++visited;
+  }
+  EXPECT_EQ(visited, ref.size());
+  // 活跃元素不超过 2000 个，容量不应该无限增长
+  EXPECT_LE(m.capacity(), 4096);
+}
+
+// 所有键的哈希值相同，探测序列需要跨越很多组
+struct ConstantHash {
+  std::size_t operator()(int) const noexcept { return 12345; }
+};
+
+TEST(UnorderedFlatMapTest, FullCollisions) {
+  mystl::unordered_flat_map<int, int, ConstantHash> m;
+  for (int i = 0; i < 300; ++i) {
+    m[i] = -i;
+  }
+  for (int i = 0; i < 300; i += 2) {
+    EXPECT_EQ(m.erase(i), 1);
+  }
+  for (int i = 0; i < 300; ++i) {
+    EXPECT_EQ(m.contains(i), i % 2 == 1) << i;
+  }
+  for (int i = 0; i < 300; i += 2) {
+    m[i] = i;
+  }
+  EXPECT_EQ(m.size(), 300);
+  for (int i = 0; i < 300; ++i) {
+    EXPECT_EQ(m.at(i), i % 2 == 0 ? i : -i);
+  }
+}
+
+TEST(UnorderedFlatMapTest, EraseWhileIterating) {
+  mystl::unordered_flat_map<int, int> m;
+  for (int i = 0; i < 1000; ++i) {
+    m.try_emplace(i, i);
+  }
+  for (auto it = m.begin(); it != m.end();) {
+    if (it->first % 3 == 0) {
+      it = m.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  EXPECT_EQ(m.size(), 666);
+  for (const auto& kv : m) {
+    EXPECT_NE(kv.first % 3, 0);
+  }
+  m.erase(m.begin(), m.end());
+  EXPECT_TRUE(m.empty());
+}
+
+TEST(UnorderedFlatMapTest, CopyMoveAndCompare) {
+  mystl::unordered_flat_map<std::string, std::string> a = {
+      {"x", "1"}, {"y", "2"}, {"z", "3"}};
+  mystl::unordered_flat_map<std::string, std::string> b(a);
+  EXPECT_EQ(a, b);
+  b["x"] = "changed";
+  EXPECT_NE(a, b);
+
+  mystl::unordered_flat_map<std::string, std::string> c(std::move(b));
+  EXPECT_TRUE(b.empty());
+  EXPECT_EQ(c.at("x"), "changed");
+
+  b = a;
+  EXPECT_EQ(a, b);
+  c = std::move(b);
+  EXPECT_EQ(c, a);
+
+  std::swap(a, b);
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(b.size(), 3);
+}
+
+TEST(UnorderedFlatMapTest, ReserveAndRehash) {
+  mystl::unordered_flat_map<int, int> m;
+  m.reserve(1000);
+  const std::size_t cap = m.capacity();
+  EXPECT_GE(cap * 7 / 8, 1000);
+  for (int i = 0; i < 1000; ++i) {
+    m[i] = i;
+  }
+  EXPECT_EQ(m.capacity(), cap);  // 没有重新散列
+  for (int i = 0; i < 990; ++i) {
+    m.erase(i);
+  }
+  m.rehash(0);
+  EXPECT_EQ(m.capacity(), 16);
+  EXPECT_EQ(m.size(), 10);
+  EXPECT_EQ(m.at(995), 995);
+}
+
+TEST(UnorderedFlatMapTest, ElementsAreConstructedAndDestroyedOnce) {
+  Perfect::counter.reset();
+  {
+    mystl::unordered_flat_map<int, Perfect> m;
+    for (int i = 0; i < 100; ++i) {
+      m.try_emplace(i, i);
+    }
+    EXPECT_EQ(Perfect::counter.value_constructor, 100);
+    EXPECT_EQ(Perfect::counter.copy_constructor, 0);
+    // 已存在的键不会构造 mapped_type
+    m.try_emplace(5, 5);
+    EXPECT_EQ(Perfect::counter.value_constructor, 100);
+    for (int i = 0; i < 50; ++i) {
+      m.erase(i);
+    }
+  }
+  const auto& c = Perfect::counter;
+  EXPECT_EQ(c.value_constructor + c.move_constructor + c.copy_constructor,
+            c.deconstructor);
+}
+
+namespace {
+struct PerfectHash {
+  std::size_t operator()(const Perfect& p) const noexcept {
+    return std::hash<int>()(p.value());
+  }
+};
+
+// 移动可能抛异常（不是 noexcept），countdown 减到 0 时拷贝抛异常
+struct FragileKey {
+  static inline int countdown = -1;
+  int value;
+
+  explicit FragileKey(int v) : value(v) {}
+  FragileKey(const FragileKey& other) : value(other.value) {
+    if (countdown >= 0 && countdown-- == 0) {
+      throw std::runtime_error("FragileKey copy");
+    }
+  }
+  FragileKey(FragileKey&& other) : FragileKey(other) {}
+
+  bool operator==(const FragileKey& other) const { return value == other.value; }
+};
+
+struct FragileKeyHash {
+  std::size_t operator()(const FragileKey& k) const noexcept {
+    return std::hash<int>()(k.value);
+  }
+};
+}  // namespace
+
+TEST(UnorderedFlatMapTest, RehashMovesKeys) {
+  Perfect::counter.reset();
+  {
+    mystl::unordered_flat_map<Perfect, int, PerfectHash> m;
+    for (int i = 0; i < 1000; ++i) {
+      m.try_emplace(Perfect(i), i);
+    }
+    EXPECT_GT(m.capacity(), 16);  // 扩容过很多次
+    EXPECT_EQ(Perfect::counter.copy_constructor, 0);
+    EXPECT_EQ(m.at(Perfect(999)), 999);
+  }
+  const auto& c = Perfect::counter;
+  EXPECT_EQ(c.value_constructor + c.move_constructor + c.copy_constructor,
+            c.deconstructor);
+}
+
+TEST(UnorderedFlatMapTest, RehashRollsBackWhenCopyThrows) {
+  mystl::unordered_flat_map<FragileKey, std::string, FragileKeyHash> m;
+  for (int i = 0; i < 100; ++i) {
+    m.try_emplace(FragileKey(i), std::to_string(i));
+  }
+  const std::size_t cap = m.capacity();
+  FragileKey::countdown = 50;
+  EXPECT_THROW(m.rehash(4 * cap), std::runtime_error);
+  FragileKey::countdown = -1;
+  EXPECT_EQ(m.capacity(), cap);
+  ASSERT_EQ(m.size(), 100);
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_EQ(m.at(FragileKey(i)), std::to_string(i));
+  }
+  m.rehash(4 * cap);
+  EXPECT_EQ(m.at(FragileKey(42)), "42");
+}
+
+TEST(UnorderedFlatMapTest, RangeConstructorTakesOnlyIterators) {
+  using Map = mystl::unordered_flat_map<int, int>;
+  static_assert(!std::is_constructible<Map, int, int>::value);
+  static_assert(std::is_constructible<Map, const Map::value_type*,
+                                      const Map::value_type*>::value);
+  const Map::value_type init[] = {{1, 10}, {2, 20}};
+  Map m(std::begin(init), std::end(init));
+  EXPECT_EQ(m.at(2), 20);
+}
+
+namespace {
+// 带状态的哈希函数，用来检查拷贝、移动和交换时策略对象跟着表走
+struct SeededHash {
+  std::size_t seed{0};
+  std::size_t operator()(int key) const noexcept {
+    return std::hash<int>()(key) ^ seed;
+  }
+};
+}  // namespace
+
+TEST(UnorderedFlatMapTest, PolicyStorage) {
+  // 空的哈希函数、比较函数和分配器不占空间
+  static_assert(sizeof(mystl::unordered_flat_map<int, int>) ==
+                5 * sizeof(std::size_t));
+  static_assert(sizeof(mystl::unordered_flat_map<int, int, SeededHash>) ==
+                6 * sizeof(std::size_t));
+
+  mystl::unordered_flat_map<int, int, SeededHash> a(0, SeededHash{7});
+  mystl::unordered_flat_map<int, int, SeededHash> b(0, SeededHash{9});
+  for (int i = 0; i < 100; ++i) {
+    a[i] = i;
+  }
+  auto copy = a;
+  EXPECT_EQ(copy.hash_function().seed, 7u);
+  EXPECT_EQ(copy.at(42), 42);
+
+  a.swap(b);
+  EXPECT_EQ(a.hash_function().seed, 9u);
+  EXPECT_EQ(b.hash_function().seed, 7u);
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(b.at(99), 99);
+
+  auto moved = std::move(b);
+  EXPECT_EQ(moved.hash_function().seed, 7u);
+  EXPECT_EQ(moved.size(), 100u);
+}
+
+TEST(UnorderedFlatMapTest, TupleKeys) {
+  // 默认的 mystl::hash 支持 pair/tuple 作为键
+  mystl::unordered_flat_map<mystl::pair<int, int>, int> grid;
+  mystl::unordered_flat_map<mystl::tuple<int, std::string>, int> named;
+  for (int i = 0; i < 100; ++i) {
+    grid[mystl::pair<int, int>(i, -i)] = i;
+    named[mystl::tuple<int, std::string>(i, std::to_string(i))] = i;
+  }
+  EXPECT_EQ(grid.size(), 100u);
+  EXPECT_EQ(grid.at(mystl::pair<int, int>(7, -7)), 7);
+  EXPECT_FALSE(grid.contains(mystl::pair<int, int>(-7, 7)));
+  EXPECT_EQ(named.at(mystl::tuple<int, std::string>(42, "42")), 42);
+}
@@ -0,0 +1,361 @@
+#include <atomic>
+#include <iterator>
+#include <list>
+#include <numeric>  // for std::iota
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include "gtest/gtest.h"
+#include "mystl/vector.h"
+#include "utils/test_types.h"
+
+using mystl::test::Perfect;
+
+// --- 测试 mystl::vector ---
+
+namespace {
+// 追踪存活对象个数，并在构造出特定值时抛异常，用于测试并行构造的异常安全
+struct Tracked {
+  static inline std::atomic<int> alive{0};
+  static inline int throw_on = -1;
+
+  int value;
+
+  Tracked() : value(0) { ++alive; }
+  Tracked(int v) : value(v) {
+    if (v == throw_on) {
+      throw std::runtime_error("Tracked: throw on construction");
+    }
+    ++alive;
+  }
+  Tracked(const Tracked& other) : Tracked(other.value) {}
+  ~Tracked() { --alive; }
+};
+}  // namespace
+
+TEST(VectorTest, Construction) {
+  // 1. 默认构造
+  mystl::vector<int> v1;
+  EXPECT_EQ(v1.size(), 0);
+  EXPECT_TRUE(v1.empty());
+
+  // 2. n 个值初始化的元素
+  mystl::vector<int> v2(5);
+  EXPECT_EQ(v2.size(), 5);
+  EXPECT_EQ(v2.capacity(), 5);
+  for (int x : v2) {
+    EXPECT_EQ(x, 0);
+  }
+
+  // 3. n 个 value
+  mystl::vector<std::string> v3(3, "abc");
+  EXPECT_EQ(v3.size(), 3);
+  EXPECT_EQ(v3[2], "abc");
+
+  // 4. 迭代器区间和初始化列表
+  int raw[] = {1, 2, 3, 4};
+  mystl::vector<int> v4(raw, raw + 4);
+  mystl::vector<int> v5 = {1, 2, 3, 4};
+  EXPECT_EQ(v4.size(), 4);
+  EXPECT_EQ(v5.size(), 4);
+  for (std::size_t i = 0; i < 4; ++i) {
+    EXPECT_EQ(v4[i], v5[i]);
+  }
+
+  // 5. 拷贝与移动
+  mystl::vector<int> v6(v5);
+  EXPECT_EQ(v6.size(), 4);
+  EXPECT_NE(v6.data(), v5.data());
+  mystl::vector<int> v7(mystl::move(v6));
+  EXPECT_EQ(v7.size(), 4);
+  EXPECT_EQ(v6.data(), nullptr);
+}
+
+TEST(VectorTest, ElementAccess) {
+  mystl::vector<int> v = {10, 20, 30};
+  const mystl::vector<int>& cv = v;
+
+  EXPECT_EQ(v.at(1), 20);
+  EXPECT_EQ(cv.at(2), 30);
+  EXPECT_THROW(v.at(3), std::out_of_range);
+  EXPECT_THROW(cv.at(3), std::out_of_range);
+
+  EXPECT_EQ(v.front(), 10);
+  EXPECT_EQ(cv.back(), 30);
+  EXPECT_EQ(v.data(), &v[0]);
+  EXPECT_EQ(cv.end() - cv.begin(), 3);
+}
+
+TEST(VectorTest, ReserveAndResize) {
+  mystl::vector<std::string> v = {"a", "b"};
+  v.reserve(10);
+  EXPECT_EQ(v.capacity(), 10);
+  EXPECT_EQ(v.size(), 2);
+  EXPECT_EQ(v[1], "b");
+
+  // 缩小时销毁尾部元素，增大时值初始化
+  v.resize(1);
+  EXPECT_EQ(v.size(), 1);
+  v.resize(3);
+  EXPECT_EQ(v[2], "");
+  v.resize(20, "z");
+  EXPECT_EQ(v.size(), 20);
+  EXPECT_EQ(v[19], "z");
+  EXPECT_EQ(v[0], "a");
+
+  // 默认初始化，只保证长度正确
+  mystl::vector<int> vi = {1, 2};
+  vi.resize(1000, mystl::default_init);
+  EXPECT_EQ(vi.size(), 1000);
+  EXPECT_EQ(vi[1], 2);
+}
+
+TEST(VectorTest, ParallelConstruction) {
+  // 1. 强制多线程，数据量小于一页时也能正确切块
+  mystl::vector<int> v1(mystl::parallel_construct_t{4}, 100000, 7);
+  EXPECT_EQ(v1.size(), 100000);
+  for (int x : v1) {
+    ASSERT_EQ(x, 7);
+  }
+
+  // 2. 值初始化
+  mystl::vector<double> v2(mystl::parallel_construct_t{3}, 50000);
+  EXPECT_EQ(v2.size(), 50000);
+  for (double x : v2) {
+    ASSERT_EQ(x, 0.0);
+  }
+
+  // 3. 随机访问迭代器区间，需要保持顺序
+  mystl::vector<int> src(200001);
+  std::iota(src.begin(), src.end(), 0);
+  mystl::vector<int> v3(mystl::parallel_construct_t{8}, src.begin(),
+                        src.end());
+  ASSERT_EQ(v3.size(), src.size());
+  for (std::size_t i = 0; i < v3.size(); ++i) {
+    ASSERT_EQ(v3[i], src[i]);
+  }
+
+  // 4. 自动选择线程数，非平凡类型
+  mystl::vector<std::string> v4(mystl::parallel_construct, 1000, "x");
+  EXPECT_EQ(v4.size(), 1000);
+  EXPECT_EQ(v4.back(), "x");
+
+  // 5. 线程数多于元素个数，以及空 vector
+  mystl::vector<int> v5(mystl::parallel_construct_t{16}, 3, 1);
+  EXPECT_EQ(v5.size(), 3);
+  mystl::vector<int> v6(mystl::parallel_construct, 0, 1);
+  EXPECT_TRUE(v6.empty());
+}
+
+TEST(VectorTest, ParallelConstructionExceptionSafety) {
+  mystl::vector<int> src(50000);
+  std::iota(src.begin(), src.end(), 0);
+
+  // 中间某一块构造失败，所有已构造的元素都要被销毁
+  Tracked::alive = 0;
+  Tracked::throw_on = 31234;
+  EXPECT_THROW((mystl::vector<Tracked>(mystl::parallel_construct_t{4},
+                                        src.begin(), src.end())),
+               std::runtime_error);
+  EXPECT_EQ(Tracked::alive, 0);
+
+  // 第一块失败
+  Tracked::throw_on = 5;
+  EXPECT_THROW((mystl::vector<Tracked>(mystl::parallel_construct_t{4},
+                                        src.begin(), src.end())),
+               std::runtime_error);
+  EXPECT_EQ(Tracked::alive, 0);
+
+  // 不抛异常时，析构后全部释放
+  Tracked::throw_on = -1;
+  {
+    mystl::vector<Tracked> v(mystl::parallel_construct_t{4}, src.begin(),
+                             src.end());
+    EXPECT_EQ(Tracked::alive, 50000);
+    EXPECT_EQ(v[31234].value, 31234);
+  }
+  EXPECT_EQ(Tracked::alive, 0);
+}
+
+namespace {
+mystl::vector<Perfect> make_perfect(int n, std::size_t cap) {
+  mystl::vector<Perfect> v;
+  v.reserve(cap);
+  for (int i = 0; i < n; ++i) {
+    v.emplace_back(i);
+  }
+  return v;
+}
+
+std::string dump(const mystl::vector<Perfect>& v) {
+  std::string s;
+  for (const auto& x : v) {
+    s += std::to_string(x.value()) + ",";
+  }
+  return s;
+}
+}  // namespace
+
+TEST(VectorTest, PushBackAndEmplaceBack) {
+  mystl::vector<std::string> v;
+  for (int i = 0; i < 100; ++i) {
+    v.push_back(std::to_string(i));
+  }
+  EXPECT_EQ(v.size(), 100);
+  EXPECT_EQ(v[57], "57");
+
+  // 扩容时参数引用自身元素
+  mystl::vector<std::string> w = {"self"};
+  EXPECT_EQ(w.capacity(), 1);
+  w.push_back(w[0]);
+  EXPECT_EQ(w[1], "self");
+  EXPECT_EQ(w.emplace_back(3, 'c'), "ccc");
+
+  w.pop_back();
+  EXPECT_EQ(w.size(), 2);
+  w.clear();
+  EXPECT_TRUE(w.empty());
+}
+
+TEST(VectorTest, InsertFillShiftsTailOnce) {
+  // 1. elems_after > n：尾部 7 个元素每个只移动一次
+  auto v = make_perfect(10, 20);
+  Perfect::counter.reset();
+  auto it = v.insert(v.begin() + 3, 2, Perfect(100));
+  EXPECT_EQ(it, v.begin() + 3);
+  EXPECT_EQ(dump(v), "0,1,2,100,100,3,4,5,6,7,8,9,");
+  EXPECT_EQ(Perfect::counter.move_constructor + Perfect::counter.move_assign,
+            7);
+
+  // 2. elems_after <= n
+  v = make_perfect(10, 20);
+  Perfect::counter.reset();
+  v.insert(v.begin() + 8, 5, Perfect(-1));
+  EXPECT_EQ(dump(v), "0,1,2,3,4,5,6,7,-1,-1,-1,-1,-1,8,9,");
+  EXPECT_EQ(Perfect::counter.move_constructor + Perfect::counter.move_assign,
+            2);
+
+  // 3. 容量不足：一遍完成，原有元素每个移动一次
+  v = make_perfect(10, 10);
+  Perfect::counter.reset();
+  v.insert(v.begin() + 5, 3, Perfect(7));
+  EXPECT_EQ(dump(v), "0,1,2,3,4,7,7,7,5,6,7,8,9,");
+  EXPECT_EQ(Perfect::counter.move_constructor, 10);
+  EXPECT_EQ(Perfect::counter.move_assign, 0);
+
+  // 4. 插入的值来自 vector 自身
+  mystl::vector<int> vi = {1, 2, 3};
+  vi.reserve(10);
+  vi.insert(vi.begin(), 2, vi[2]);
+  EXPECT_EQ(vi.size(), 5);
+  EXPECT_EQ(vi[0], 3);
+  EXPECT_EQ(vi[4], 3);
+  vi.insert(vi.end(), 0, 42);
+  EXPECT_EQ(vi.size(), 5);
+}
+
+TEST(VectorTest, InsertRange) {
+  // 1. 前向迭代器，容量足够
+  auto v = make_perfect(6, 20);
+  mystl::vector<Perfect> src = make_perfect(3, 3);
+  Perfect::counter.reset();
+  v.insert(v.begin() + 1, src.begin(), src.end());
+  EXPECT_EQ(dump(v), "0,0,1,2,1,2,3,4,5,");
+  EXPECT_EQ(Perfect::counter.move_constructor + Perfect::counter.move_assign,
+            5);
+  EXPECT_EQ(Perfect::counter.copy_constructor + Perfect::counter.copy_assign,
+            3);
+
+  // 2. 非随机访问的前向迭代器，插入到末尾并触发扩容
+  std::list<int> lst = {7, 8, 9};
+  mystl::vector<int> vi = {1, 2};
+  vi.insert(vi.end(), lst.begin(), lst.end());
+  ASSERT_EQ(vi.size(), 5);
+  EXPECT_EQ(vi[2], 7);
+  EXPECT_EQ(vi[4], 9);
+
+  // 3. 单遍输入迭代器
+  std::istringstream in("10 20 30");
+  vi.insert(vi.begin() + 1, std::istream_iterator<int>(in),
+            std::istream_iterator<int>());
+  ASSERT_EQ(vi.size(), 8);
+  EXPECT_EQ(vi[1], 10);
+  EXPECT_EQ(vi[3], 30);
+  EXPECT_EQ(vi[4], 2);
+
+  // 4. 初始化列表和单个元素
+  vi.insert(vi.begin(), {-2, -1});
+  vi.insert(vi.begin() + 2, 0);
+  EXPECT_EQ(vi[0], -2);
+  EXPECT_EQ(vi[2], 0);
+  EXPECT_EQ(vi.size(), 11);
+}
+
+TEST(VectorTest, InsertStrongGuaranteeOnReallocation) {
+  mystl::vector<Tracked> v;
+  v.reserve(3);
+  v.emplace_back(1);
+  v.emplace_back(2);
+  v.emplace_back(3);
+  Tracked::alive = 3;
+  // Tracked 没有 noexcept 的移动构造，扩容时拷贝旧元素，拷贝 2 时抛出异常
+  Tracked::throw_on = 2;
+  EXPECT_THROW(v.insert(v.begin() + 2, Tracked(9)), std::runtime_error);
+  Tracked::throw_on = -1;
+  EXPECT_EQ(Tracked::alive, 3);
+  ASSERT_EQ(v.size(), 3);
+  EXPECT_EQ(v[1].value, 2);
+  EXPECT_EQ(v.capacity(), 3);
+}
+
+TEST(VectorTest, EraseRange) {
+  auto v = make_perfect(10, 10);
+  Perfect::counter.reset();
+  auto it = v.erase(v.begin() + 2, v.begin() + 5);
+  EXPECT_EQ(it, v.begin() + 2);
+  EXPECT_EQ(dump(v), "0,1,5,6,7,8,9,");
+  // 后面 5 个元素整体前移一次，销毁尾部 3 个
+  EXPECT_EQ(Perfect::counter.move_assign, 5);
+  EXPECT_EQ(Perfect::counter.deconstructor, 3);
+
+  v.erase(v.begin());
+  EXPECT_EQ(dump(v), "1,5,6,7,8,9,");
+  v.erase(v.begin() + 1, v.begin() + 1);
+  EXPECT_EQ(v.size(), 6);
+  v.erase(v.begin() + 3, v.end());
+  EXPECT_EQ(dump(v), "1,5,6,");
+}
+
+TEST(VectorTest, EraseIf) {
+  auto v = make_perfect(10, 10);
+  Perfect::counter.reset();
+  auto removed = mystl::erase_if(
+      v, [](const Perfect& p) { return p.value() % 3 == 0; });
+  EXPECT_EQ(removed, 4);
+  EXPECT_EQ(dump(v), "1,2,4,5,7,8,");
+  // 第一个被删除的元素之后，每个保留的元素只移动一次
+  EXPECT_EQ(Perfect::counter.move_assign, 6);
+
+  mystl::vector<int> vi = {1, 2, 1, 3, 1};
+  EXPECT_EQ(mystl::erase(vi, 1), 3);
+  EXPECT_EQ(vi.size(), 2);
+  EXPECT_EQ(vi[1], 3);
+  EXPECT_EQ(mystl::erase(vi, 42), 0);
+}
+
+// 无状态的分配器和 end_of_storage 压缩在一起，不占空间
+TEST(VectorTest, StatelessAllocatorTakesNoSpace) {
+  static_assert(sizeof(mystl::vector<int>) == 3 * sizeof(int*));
+  static_assert(sizeof(mystl::vector<std::string>) ==
+                3 * sizeof(std::string*));
+
+  mystl::vector<int> v{1, 2, 3};
+  mystl::vector<int> copy(v);
+  mystl::vector<int> moved(std::move(v));
+  EXPECT_EQ(copy.capacity(), 3);
+  EXPECT_EQ(moved.capacity(), 3);
+  EXPECT_EQ(v.capacity(), 0);
+  copy.swap(v);
+  EXPECT_EQ(v.size(), 3);
+  EXPECT_EQ(copy.capacity(), 0);
+}
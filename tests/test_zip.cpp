@@ -0,0 +1,232 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <string>
+#include <type_traits>
+#include "mystl/algorithm.h"
+#include "mystl/array.h"
+#include "mystl/vector.h"
+#include "mystl/zip.h"
+#include "utils/test_types.h"
+
+using mystl::test::Perfect;
+
+template <class T>
+static bool equals(const mystl::vector<T>& v, std::initializer_list<T> expected) {
+  return std::equal(v.begin(), v.end(), expected.begin(), expected.end());
+}
+
+TEST(ZipTest, IteratorTraits) {
+  mystl::vector<int> a = {1, 2, 3};
+  mystl::vector<std::string> b = {"a", "b", "c"};
+  auto z = mystl::zip(a, b);
+  using It = decltype(z.begin());
+  static_assert(std::is_same<std::iterator_traits<It>::iterator_category,
+                             std::random_access_iterator_tag>::value);
+  static_assert(std::is_same<std::iterator_traits<It>::reference,
+                             mystl::zip_reference<int&, std::string&>>::value);
+  static_assert(std::is_base_of<mystl::tuple<int&, std::string&>,
+                                std::iterator_traits<It>::reference>::value);
+  static_assert(std::is_same<std::iterator_traits<It>::value_type,
+                             mystl::zip_value<int, std::string>>::value);
+  static_assert(std::is_base_of<mystl::tuple<int, std::string>,
+                                std::iterator_traits<It>::value_type>::value);
+
+  EXPECT_EQ(z.size(), 3u);
+  EXPECT_EQ(z.end() - z.begin(), 3);
+  auto it = z.begin() + 2;
+  EXPECT_EQ(mystl::get<0>(*it), 3);
+  EXPECT_EQ(mystl::get<1>(it[-1]), "b");
+  EXPECT_TRUE(z.begin() < it);
+  EXPECT_EQ(--it - z.begin(), 1);
+}
+
+TEST(ZipTest, WritesThroughToColumns) {
+  mystl::vector<int> a = {1, 2, 3};
+  mystl::array<double, 3> b = {0.5, 1.5, 2.5};
+  for (auto row : mystl::zip(a, b)) {
+    mystl::get<0>(row) *= 10;
+    mystl::get<1>(row) += 1;
+  }
+  EXPECT_EQ(a[2], 30);
+  EXPECT_DOUBLE_EQ(b[0], 1.5);
+
+  // 与 tie 一样可以整行赋值
+  auto z = mystl::zip(a, b);
+  z[0] = mystl::make_tuple(7, 7.5);
+  EXPECT_EQ(a[0], 7);
+  EXPECT_DOUBLE_EQ(b[0], 7.5);
+}
+
+TEST(ZipTest, ShortestRangeAndConst) {
+  mystl::vector<int> a = {1, 2, 3, 4};
+  const mystl::vector<char> b = {'x', 'y'};
+  auto z = mystl::zip(a, b);
+  EXPECT_EQ(z.size(), 2u);
+  static_assert(
+      std::is_same<decltype(*z.begin()),
+                   mystl::zip_reference<int&, const char&>>::value);
+  EXPECT_EQ(mystl::get<1>(z[1]), 'y');
+
+  mystl::vector<int> empty;
+  EXPECT_TRUE(mystl::zip(a, empty).empty());
+}
+
+TEST(ZipTest, SortPermutesColumnsInPlace) {
+  mystl::vector<int> keys = {5, 3, 9, 1, 3};
+  mystl::vector<std::string> values = {"five", "three-b", "nine", "one",
+                                       "three-a"};
+  auto z = mystl::zip(keys, values);
+  std::sort(z.begin(), z.end());
+  EXPECT_TRUE(equals(keys, {1, 3, 3, 5, 9}));
+  EXPECT_TRUE(equals<std::string>(
+      values, {"one", "three-a", "three-b", "five", "nine"}));
+
+  // 只按 key 降序，稳定排序保持 value 的原有相对顺序
+  std::stable_sort(z.begin(), z.end(), [](const auto& l, const auto& r) {
+    return mystl::get<0>(l) > mystl::get<0>(r);
+  });
+  EXPECT_TRUE(equals(keys, {9, 5, 3, 3, 1}));
+  EXPECT_EQ(values[2], "three-a");
+  EXPECT_EQ(values[3], "three-b");
+}
+
+TEST(ZipTest, SortLargeMatchesPairSort) {
+  std::mt19937 rng(42);
+  const std::size_t n = 10000;
+  mystl::vector<unsigned> keys(n);
+  mystl::vector<std::size_t> ids(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    keys[i] = rng() % 1000;
+    ids[i] = i;
+  }
+  const mystl::vector<unsigned> original = keys;
+
+  auto z = mystl::zip(keys, ids);
+  std::sort(z.begin(), z.end());
+  EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end()));
+  // ids 随 keys 一起移动：每一行仍然对应原来的那一对
+  for (std::size_t i = 0; i < n; ++i) {
+    EXPECT_EQ(original[ids[i]], keys[i]);
+  }
+
+  std::reverse(z.begin(), z.end());
+  EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end(), std::greater<>()));
+}
+
+TEST(ZipTest, ValueTypeMovesFromColumns) {
+  mystl::vector<Perfect> a;
+  mystl::vector<int> b = {1, 2};
+  a.emplace_back(10);
+  a.emplace_back(20);
+  auto z = mystl::zip(a, b);
+  using Value = decltype(z)::value_type;
+
+  // value_type tmp = std::move(*it)：移动被引用的对象，不拷贝
+  Perfect::counter.reset();
+  Value tmp = std::move(*z.begin());
+  EXPECT_EQ(Perfect::counter.move_constructor, 1);
+  EXPECT_EQ(Perfect::counter.copy_constructor, 0);
+  EXPECT_EQ(mystl::get<0>(tmp).value(), 10);
+  EXPECT_EQ(a[0].value(), 0);
+
+  // 赋值同样移动
+  Perfect::counter.reset();
+  tmp = std::move(z[1]);
+  EXPECT_EQ(Perfect::counter.move_assign, 1);
+  EXPECT_EQ(Perfect::counter.copy_assign, 0);
+  auto& [p, i] = tmp;
+  EXPECT_EQ(p.value(), 20);
+  EXPECT_EQ(i, 2);
+
+  // 从 const 引用构造时拷贝
+  const auto ref = z[0];
+  Perfect::counter.reset();
+  Value copy(ref);
+  EXPECT_EQ(Perfect::counter.copy_constructor, 1);
+  EXPECT_EQ(Perfect::counter.move_constructor, 0);
+
+  // 引用之间：右值赋值移动，const 引用赋值拷贝
+  Perfect::counter.reset();
+  z[1] = std::move(z[0]);
+  EXPECT_EQ(Perfect::counter.move_assign, 1);
+  EXPECT_EQ(Perfect::counter.copy_assign, 0);
+  EXPECT_EQ(a[1].value(), 0);
+  z[0] = ref;
+  EXPECT_EQ(Perfect::counter.copy_assign, 1);
+
+  // 值赋回引用：移动
+  Perfect::counter.reset();
+  z[1] = std::move(tmp);
+  EXPECT_EQ(Perfect::counter.move_assign, 1);
+  EXPECT_EQ(Perfect::counter.copy_assign, 0);
+  EXPECT_EQ(a[1].value(), 20);
+}
+
+TEST(ZipTest, SortDoesNotCopyElements) {
+  const int n = 1000;
+  std::mt19937 rng(7);
+  mystl::vector<int> keys(n);
+  mystl::vector<Perfect> values;
+  for (int i = 0; i < n; ++i) {
+    keys[i] = int(rng() % 100);
+    values.emplace_back(keys[i]);
+  }
+  auto z = mystl::zip(keys, values);
+  auto by_key = [](const auto& l, const auto& r) {
+    return mystl::get<0>(l) < mystl::get<0>(r);
+  };
+
+  Perfect::counter.reset();
+  std::sort(z.begin(), z.end(), by_key);
+  std::stable_sort(z.begin(), z.end(), by_key);
+  std::shuffle(z.begin(), z.end(), rng);
+  mystl::sort(z.begin(), z.end(), by_key);
+  // 临时值从引用移动构造，*a = std::move(*b) 移动赋值
+  EXPECT_EQ(Perfect::counter.copy_constructor, 0);
+  EXPECT_EQ(Perfect::counter.copy_assign, 0);
+  EXPECT_GT(Perfect::counter.move_constructor, 0);
+  EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end()));
+  for (int i = 0; i < n; ++i) {
+    EXPECT_EQ(values[i].value(), keys[i]);
+  }
+
+}
+
+TEST(ZipTest, SortMoveOnlyColumn) {
+  auto make = [](mystl::vector<int>& keys,
+                 mystl::vector<std::unique_ptr<int>>& owned) {
+    keys = {5, 3, 9, 1, 7, 2};
+    owned.clear();
+    for (int k : keys) {
+      owned.push_back(std::make_unique<int>(k));
+    }
+  };
+  auto check = [](const mystl::vector<int>& keys,
+                  const mystl::vector<std::unique_ptr<int>>& owned) {
+    EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end()));
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+      ASSERT_NE(owned[i], nullptr);
+      EXPECT_EQ(*owned[i], keys[i]);
+    }
+  };
+  auto by_key = [](const auto& l, const auto& r) {
+    return mystl::get<0>(l) < mystl::get<0>(r);
+  };
+
+  mystl::vector<int> keys;
+  mystl::vector<std::unique_ptr<int>> owned;
+  make(keys, owned);
+  auto z = mystl::zip(keys, owned);
+  std::sort(z.begin(), z.end(), by_key);
+  check(keys, owned);
+
+  make(keys, owned);
+  auto z2 = mystl::zip(keys, owned);
+  mystl::sort(z2.begin(), z2.end(), by_key);
+  check(keys, owned);
+}